@@ -0,0 +1,52 @@
+/**
+ * @file bench_chrono.cpp
+ * @brief SystemChrono::steady_clock::now() vs. micros64() and std::chrono.
+ *
+ * now() wraps one micros64() call, so the first two lines should match.
+ * std::chrono::steady_clock (nanosecond clock_gettime) is shown for reference.
+ */
+
+#include <stdio.h>
+
+#include <chrono>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/Chrono.h"
+#include "SystemChrono/CycleClock.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  static const steady_clock::time_point start = steady_clock::now();
+
+  runAndPrint("micros64", [] { doNotOptimize(micros64()); });
+  runAndPrint("steady_clock::now", [] { doNotOptimize(steady_clock::now()); });
+  runAndPrint("std::chrono::steady_clock", [] {
+    doNotOptimize(std::chrono::steady_clock::now());
+  });
+  runAndPrint("now() - t0 -> milliseconds", [] {
+    doNotOptimize(
+        std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start));
+  });
+  runAndPrint("millisSince(micros)", [] {
+    doNotOptimize(microsSince(steady_clock::to_micros64(start)) / 1000LL);
+  });
+  return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file bench_clock_source.cpp
+ * @brief Templated ClockSource variants vs. the classic non-template API.
+ *
+ * The SystemClock instantiations should cost the same as the classic
+ * functions: both end in exactly one call to micros64().
+ */
+
+#include <stdio.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/ClockSource.h"
+#include "SystemChrono/CycleClock.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+int64_t g_stampUs = 0;
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  g_stampUs = micros64();
+
+  runAndPrint("microsSince", [] { doNotOptimize(microsSince(g_stampUs)); });
+  runAndPrint("microsSince<SystemClock>", [] {
+    doNotOptimize(microsSince<SystemClock>(g_stampUs));
+  });
+
+  static Stopwatch sw;
+  static BasicStopwatch<SystemClock> basicSw;
+  runAndPrint("Stopwatch start+stop", [] {
+    sw.start();
+    sw.stop();
+    doNotOptimize(sw);
+  });
+  runAndPrint("BasicStopwatch start+stop", [] {
+    basicSw.start();
+    basicSw.stop();
+    doNotOptimize(basicSw);
+  });
+
+  static ElapsedMillis64 elapsed;
+  static BasicElapsedMillis64<SystemClock> basicElapsed;
+  runAndPrint("ElapsedMillis64 read", [] { doNotOptimize(static_cast<int64_t>(elapsed)); });
+  runAndPrint("BasicElapsedMillis64 read", [] {
+    doNotOptimize(static_cast<int64_t>(basicElapsed));
+  });
+  runAndPrint("ElapsedMillis64 = 0", [] {
+    elapsed = 0;
+    doNotOptimize(elapsed);
+  });
+  runAndPrint("BasicElapsedMillis64 = 0", [] {
+    basicElapsed = 0;
+    doNotOptimize(basicElapsed);
+  });
+  return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file bench_coarse_clock.cpp
+ * @brief Coarse cached reads vs. precise reads, with a background updater.
+ *
+ * An updater thread refreshes the cache every 1 ms (the host stand-in for
+ * the ESP32 esp_timer callback). Besides the per-read cost, the benchmark
+ * reports the observed staleness millis64() - millis64Coarse().
+ */
+
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CoarseClock.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/detail/Int64Cell.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+std::atomic<bool> g_stop(false);
+detail::SeqlockInt64Cell g_seqlockCell;
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  updateCoarseClock();
+  std::thread updater([] {
+    while (!g_stop.load(std::memory_order_relaxed)) {
+      updateCoarseClock();
+      g_seqlockCell.store(micros64());
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  static ElapsedMillis64 precise;
+  static CoarseElapsedMillis64 coarse;
+  runAndPrint("millis64", [] { doNotOptimize(millis64()); });
+  runAndPrint("millis64Coarse", [] { doNotOptimize(millis64Coarse()); });
+  runAndPrint("seconds64Coarse", [] { doNotOptimize(seconds64Coarse()); });
+  runAndPrint("ElapsedMillis64 read", [] { doNotOptimize(static_cast<int64_t>(precise)); });
+  runAndPrint("CoarseElapsedMillis64 read", [] {
+    doNotOptimize(static_cast<int64_t>(coarse));
+  });
+  runAndPrint("seqlock cell load", [] { doNotOptimize(g_seqlockCell.load()); });
+
+  int64_t worstLagMs = 0;
+  for (int i = 0; i < 200000; ++i) {
+    const int64_t coarseMs = millis64Coarse();
+    const int64_t lag = millis64() - coarseMs;
+    if (lag > worstLagMs) {
+      worstLagMs = lag;
+    }
+  }
+  g_stop.store(true);
+  updater.join();
+  printf("observed staleness (1 ms updater): max %lld ms\n", static_cast<long long>(worstLagMs));
+  return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file bench_core.cpp
+ * @brief Native benchmark of every public SystemChrono core function.
+ *
+ * Host counterpart of the CLI example's `bench` command. Prints one
+ * min/median/MAD line per benchmark, overhead-subtracted, per call.
+ */
+
+#include <stdio.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/ClockCalibration.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/SystemChrono.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+int64_t g_stampUs = 0;
+
+/// Smallest non-zero step between consecutive reads of a clock.
+template <typename ReadFn>
+int64_t measureResolution(ReadFn read, uint32_t reads) {
+  int64_t best = 0;
+  int64_t prev = read();
+  for (uint32_t i = 0; i < reads; ++i) {
+    const int64_t now = read();
+    const int64_t step = now - prev;
+    if ((step > 0) && ((best == 0) || (step < best))) {
+      best = step;
+    }
+    prev = now;
+  }
+  return best;
+}
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  const Status status = runBenchmark(name, fn, BenchConfig(), result);
+  if (!status.ok()) {
+    printf("%s: %s\n", name, status.msg);
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  g_stampUs = micros64();
+
+  if (calibrateClockOverhead(CALIBRATION_MAX_BLOCKS, 20000U).ok()) {
+    const ClockCalibration& cal = clockCalibration();
+    printf("micros64() read cost: %ld ns (jitter %ld ns)\n",
+           static_cast<long>(cal.readCostNs),
+           static_cast<long>(cal.jitterNs));
+  }
+
+  if (calibrateCycleClock().ok()) {
+    CycleClockDrift drift;
+    (void)checkCycleClockDrift(CYCLE_CLOCK_DEFAULT_WINDOW_US, 1000U, drift);
+    printf("cycle counter: %s, %llu Hz (recheck %+ld ppm)\n",
+           hasCycleCounter() ? "hardware" : "micros64 fallback",
+           static_cast<unsigned long long>(cycleClockHz()),
+           static_cast<long>(drift.errorPpm));
+  }
+  printf("resolution: micros64 %lld ns, nanos64 %lld ns\n",
+         static_cast<long long>(measureResolution([] { return micros64() * 1000LL; }, 100000U)),
+         static_cast<long long>(measureResolution(nanos64, 100000U)));
+
+  // Clock sources
+  runAndPrint("cycles64", [] { doNotOptimize(cycles64()); });
+  runAndPrint("nanos64", [] { doNotOptimize(nanos64()); });
+  runAndPrint("micros64", [] { doNotOptimize(micros64()); });
+  runAndPrint("millis64", [] { doNotOptimize(millis64()); });
+  runAndPrint("seconds64", [] { doNotOptimize(seconds64()); });
+
+  // Elapsed helpers
+  runAndPrint("microsSince", [] { doNotOptimize(microsSince(g_stampUs)); });
+  runAndPrint("millisSince", [] { doNotOptimize(millisSince(g_stampUs / 1000)); });
+  runAndPrint("secondsSince", [] { doNotOptimize(secondsSince(g_stampUs / 1000000)); });
+
+  // Formatting
+  runAndPrint("formatTimeTo", [] {
+    char buf[TIME_FORMAT_BUFFER_SIZE];
+    doNotOptimize(formatTimeTo(g_stampUs, buf, sizeof(buf)).code);
+    doNotOptimize(buf[0]);
+  });
+  runAndPrint("formatNowTo", [] {
+    char buf[TIME_FORMAT_BUFFER_SIZE];
+    doNotOptimize(formatNowTo(buf, sizeof(buf)).code);
+    doNotOptimize(buf[0]);
+  });
+  runAndPrint("formatTime (String)", [] { doNotOptimize(formatTime(g_stampUs).length()); });
+  runAndPrint("formatNow (String)", [] { doNotOptimize(formatNow().length()); });
+
+  // Stopwatch
+  static Stopwatch sw;
+  sw.start();
+  runAndPrint("Stopwatch start", [] {
+    sw.start();
+    doNotOptimize(sw);
+  });
+  runAndPrint("Stopwatch stop+resume", [] {
+    sw.stop();
+    sw.resume();
+    doNotOptimize(sw);
+  });
+  runAndPrint("Stopwatch reset", [] {
+    sw.reset();
+    doNotOptimize(sw);
+  });
+  runAndPrint("Stopwatch elapsedMicros", [] { doNotOptimize(sw.elapsedMicros()); });
+  runAndPrint("Stopwatch elapsedMillis", [] { doNotOptimize(sw.elapsedMillis()); });
+  runAndPrint("Stopwatch elapsedSeconds", [] { doNotOptimize(sw.elapsedSeconds()); });
+  runAndPrint("Stopwatch isRunning", [] { doNotOptimize(sw.isRunning()); });
+
+  // Elapsed timer classes
+  static ElapsedMicros64 elapsedUs;
+  static ElapsedMillis64 elapsedMs;
+  static ElapsedSeconds64 elapsedS;
+  runAndPrint("ElapsedMicros64 ctor", [] {
+    ElapsedMicros64 t;
+    doNotOptimize(t);
+  });
+  runAndPrint("ElapsedMicros64 read", [] { doNotOptimize(static_cast<int64_t>(elapsedUs)); });
+  runAndPrint("ElapsedMicros64 = 0", [] {
+    elapsedUs = 0;
+    doNotOptimize(elapsedUs);
+  });
+  runAndPrint("ElapsedMicros64 +=", [] {
+    elapsedUs += 1;
+    doNotOptimize(elapsedUs);
+  });
+  runAndPrint("ElapsedMicros64 compensated", [] { doNotOptimize(elapsedUs.compensated()); });
+  runAndPrint("ElapsedMillis64 read", [] { doNotOptimize(static_cast<int64_t>(elapsedMs)); });
+  runAndPrint("ElapsedMillis64 = 0", [] {
+    elapsedMs = 0;
+    doNotOptimize(elapsedMs);
+  });
+  runAndPrint("ElapsedMillis64 +=", [] {
+    elapsedMs += 1;
+    doNotOptimize(elapsedMs);
+  });
+  runAndPrint("ElapsedSeconds64 read", [] { doNotOptimize(static_cast<int64_t>(elapsedS)); });
+  runAndPrint("ElapsedSeconds64 = 0", [] {
+    elapsedS = 0;
+    doNotOptimize(elapsedS);
+  });
+
+  // Calibration helpers
+  runAndPrint("compensateReadOverhead", [] {
+    doNotOptimize(compensateReadOverhead(g_stampUs, 3U));
+  });
+  runAndPrint("cyclesToNanos", [] {
+    doNotOptimize(cyclesToNanos(static_cast<uint64_t>(g_stampUs)));
+  });
+  return 0;
+}
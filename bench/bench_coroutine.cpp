@@ -0,0 +1,159 @@
+/**
+ * @file bench_coroutine.cpp
+ * @brief Cost of a coroutine suspend/resume through the Executor against a
+ *        blocking thread hand-off, and memory held per suspended task.
+ *
+ * The thread hand-off (two threads passing a semaphore back and forth) is
+ * the host stand-in for a FreeRTOS task switch: both are preemptive
+ * switches through the kernel scheduler. Memory per suspended coroutine is
+ * its frame as requested from the pool; a thread or FreeRTOS task reserves
+ * its whole stack up front.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <semaphore>
+#include <thread>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/Coroutine.h"
+#include "SystemChrono/CycleClock.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int HANDOFFS = 20000;
+static constexpr size_t FREERTOS_LOOP_TASK_STACK = 8192U;  // Arduino-ESP32 loopTask
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+Task yielder(uint32_t* count) {
+  for (;;) {
+    ++*count;
+    co_await sleepFor(0_us);
+  }
+}
+
+Task pingPong(Signal* in, Signal* out, uint32_t* count) {
+  for (;;) {
+    co_await *in;
+    ++*count;
+    out->set();
+  }
+}
+
+/// A request/response exchange with timeout and retries: a typical driver.
+Task protocol(Signal* response, uint32_t* sent, uint32_t* failures) {
+  for (;;) {
+    bool answered = false;
+    for (int attempt = 0; (attempt < 3) && !answered; ++attempt) {
+      ++*sent;
+      answered = co_await withTimeout(*response, 50_ms);
+    }
+    if (!answered) {
+      ++*failures;
+    }
+    co_await sleepFor(1_s);
+  }
+}
+
+void benchCoroutineSwitch() {
+  Deadline* slots[4];
+  Executor executor;
+  (void)executor.begin(slots, 4U);
+  uint32_t count = 0U;
+  (void)executor.spawn(yielder(&count));
+  int64_t now = 0;
+  runAndPrint("coroutine yield round trip", [&] { (void)executor.runAt(++now); });
+
+  Signal ping;
+  Signal pong;
+  uint32_t echoes = 0U;
+  Executor pair;
+  (void)pair.begin(slots + 2, 2U);
+  (void)pair.spawn(pingPong(&ping, &pong, &echoes));
+  (void)pair.runAt(0);
+  runAndPrint("coroutine signal round trip", [&] {
+    ping.set();
+    (void)pair.runAt(++now);
+    pong.reset();
+  });
+}
+
+void benchThreadHandoff() {
+  std::binary_semaphore ping(0);
+  std::binary_semaphore pong(0);
+  std::atomic<bool> stop(false);
+  std::thread peer([&] {
+    for (;;) {
+      ping.acquire();
+      if (stop.load(std::memory_order_relaxed)) {
+        return;
+      }
+      pong.release();
+    }
+  });
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < HANDOFFS; ++i) {
+    ping.release();
+    pong.acquire();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  stop.store(true, std::memory_order_relaxed);
+  ping.release();
+  peer.join();
+  const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / HANDOFFS;
+  printf("thread semaphore round trip: %.0f ns (2 kernel switches, %d round trips)\n", ns,
+         HANDOFFS);
+}
+
+void reportMemory() {
+  uint32_t count = 0U;
+  {
+    Task small = yielder(&count);
+    printf("\nsuspended yield loop frame:   %zu B\n", coroutinePoolStats().largestFrame);
+  }
+  {
+    Signal response;
+    uint32_t sent = 0U;
+    uint32_t failures = 0U;
+    Task driver = protocol(&response, &sent, &failures);
+    printf("suspended protocol frame:     %zu B (includes its ready-queue node)\n",
+           coroutinePoolStats().largestFrame);
+  }
+  printf("pool block / pool total:      %zu B / %zu B for %zu tasks\n", CORO_FRAME_BYTES,
+         CORO_FRAME_BYTES * CORO_FRAMES, CORO_FRAMES);
+
+  pthread_attr_t attr;
+  size_t stack = 0U;
+  if ((pthread_attr_init(&attr) == 0) && (pthread_attr_getstacksize(&attr, &stack) == 0)) {
+    printf("host thread default stack:    %zu B\n", stack);
+  }
+  (void)pthread_attr_destroy(&attr);
+  printf("FreeRTOS task (reference):    %zu B stack (Arduino-ESP32 loopTask) + TCB\n",
+         FREERTOS_LOOP_TASK_STACK);
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  benchCoroutineSwitch();
+  benchThreadHandoff();
+  reportMemory();
+  return 0;
+}
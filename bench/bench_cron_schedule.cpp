@@ -0,0 +1,120 @@
+/**
+ * @file bench_cron_schedule.cpp
+ * @brief CronSchedule::nextAfter() over a simulated year, against a
+ *        minute-by-minute scan that tests every minute with gmtime_r().
+ *
+ * For each schedule the year 2025 (UTC) is walked firing by firing: the
+ * bit-scan search makes one nextAfter() call per firing, while the scan
+ * visits all 525600 minutes. Both must find the same number of firings.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include <chrono>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CronSchedule.h"
+#include "SystemChrono/CycleClock.h"
+#include "Lcg.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t MINUTE_US = 60000000LL;
+static constexpr int64_t YEAR_START_US = 1735689600LL * 1000000LL;  // 2025-01-01 00:00 UTC
+static constexpr int64_t YEAR_END_US = YEAR_START_US + 365LL * 1440LL * MINUTE_US;
+
+test::Lcg g_rng(0xC40EU);
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+struct Job {
+  const char* name;
+  const char* expression;
+  bool (*matches)(const struct tm& t);  // hand-written reference for the scan
+};
+
+const Job JOBS[] = {
+    {"every 15 min at :07", "7/15 * * * *",
+     [](const struct tm& t) { return (t.tm_min % 15) == 7; }},
+    {"02:30 daily", "30 2 * * *",
+     [](const struct tm& t) { return (t.tm_min == 30) && (t.tm_hour == 2); }},
+    {"09:00 Mon-Fri", "0 9 * * 1-5",
+     [](const struct tm& t) {
+       return (t.tm_min == 0) && (t.tm_hour == 9) && (t.tm_wday >= 1) && (t.tm_wday <= 5);
+     }},
+    {"monthly report", "@monthly",
+     [](const struct tm& t) { return (t.tm_min == 0) && (t.tm_hour == 0) && (t.tm_mday == 1); }},
+    {"13th or Friday 12:00", "0 12 13 * 5",
+     [](const struct tm& t) {
+       return (t.tm_min == 0) && (t.tm_hour == 12) && ((t.tm_mday == 13) || (t.tm_wday == 5));
+     }},
+};
+
+double msSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+void walkYear(const Job& job) {
+  CronSchedule schedule;
+  if (!schedule.parse(job.expression).ok()) {
+    printf("%-22s parse failed\n", job.name);
+    return;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  uint32_t fired = 0U;
+  for (int64_t t = schedule.nextAfter(YEAR_START_US - 1); t < YEAR_END_US;
+       t = schedule.nextAfter(t)) {
+    ++fired;
+  }
+  const double bitScanMs = msSince(start);
+
+  start = std::chrono::steady_clock::now();
+  uint32_t scanned = 0U;
+  for (int64_t t = YEAR_START_US; t < YEAR_END_US; t += MINUTE_US) {
+    const time_t seconds = static_cast<time_t>(t / 1000000LL);
+    struct tm tm;
+    gmtime_r(&seconds, &tm);
+    scanned += job.matches(tm) ? 1U : 0U;
+  }
+  const double scanMs = msSince(start);
+
+  printf("%-22s %6u firings | bit-scan %8.3f ms (%6.0f ns/firing) | minute scan %7.1f ms%s\n",
+         job.name, fired, bitScanMs, fired > 0U ? bitScanMs * 1e6 / fired : 0.0, scanMs,
+         scanned == fired ? "" : "  MISMATCH");
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  printf("Simulated year 2025, one nextAfter() per firing vs. 525600 minutes:\n");
+  for (const Job& job : JOBS) {
+    walkYear(job);
+  }
+
+  printf("\nnextAfter() from a random time in the year:\n");
+  for (const Job& job : JOBS) {
+    CronSchedule schedule;
+    (void)schedule.parse(job.expression);
+    runAndPrint(job.name, [&] {
+      const int64_t t = YEAR_START_US + static_cast<int64_t>(g_rng.next(365U * 1440U)) * MINUTE_US;
+      doNotOptimize(schedule.nextAfter(t));
+    });
+  }
+  return 0;
+}
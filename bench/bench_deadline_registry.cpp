@@ -0,0 +1,76 @@
+/**
+ * @file bench_deadline_registry.cpp
+ * @brief DeadlineRegistry with thousands of armed timers: re-arm cost and
+ *        nextWakeUs() against scanning every timer for the minimum.
+ */
+
+#include <stdio.h>
+
+#include <memory>
+#include <vector>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/DeadlineRegistry.h"
+#include "Lcg.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0xB3D7U);
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+void runSize(uint32_t count) {
+  std::vector<Deadline*> slots(count);
+  DeadlineRegistry registry;
+  (void)registry.begin(slots.data(), count);
+  std::vector<std::unique_ptr<Deadline>> timers;
+  std::vector<int64_t> plainDue(count);  // what scattered timers offer today
+  for (uint32_t i = 0; i < count; ++i) {
+    timers.emplace_back(new Deadline(&registry));
+    plainDue[i] = static_cast<int64_t>(g_rng.next(10000000U));
+    (void)timers[i]->armAt(plainDue[i]);
+  }
+  int64_t now = 0;
+  printf("%u timers:\n", count);
+
+  runAndPrint("  re-arm (random due)", [&] {
+    now += 7;
+    (void)timers[g_rng.next(count)]->armAt(now + g_rng.next(10000000U));
+  });
+  runAndPrint("  Interval-style +period", [&] {
+    // Pop the earliest and push it one period later: the tickless hot path.
+    Deadline* first = slots[0];
+    (void)first->armAt(first->dueUs() + 10000000);
+  });
+  runAndPrint("  nextWakeUs", [&] { doNotOptimize(registry.nextWakeUs()); });
+  runAndPrint("  scan for minimum", [&] {
+    int64_t earliest = DEADLINE_NONE;
+    for (uint32_t i = 0; i < count; ++i) {
+      earliest = plainDue[i] < earliest ? plainDue[i] : earliest;
+    }
+    doNotOptimize(earliest);
+  });
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  runSize(1000U);
+  runSize(4000U);
+  runSize(16000U);
+  return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file bench_disciplined_clock.cpp
+ * @brief Discipline-loop simulation (±50 ppm oscillator with wander) and read cost.
+ *
+ * Prints the loop's convergence, lock and holdover behaviour against a
+ * synthetic oscillator, then the per-call cost of correctedMicros64().
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/DisciplinedClock.h"
+#include "SystemChrono/SystemChrono.h"
+#include "Lcg.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t STEP_US = 10000;
+static constexpr int64_t SAMPLE_EVERY_US = 1000000;
+static constexpr int64_t SIM_US = 3600000000LL;            // one hour
+static constexpr int64_t OUTAGE_START_US = 1800000000LL;   // references lost at 30 min
+static constexpr int64_t OUTAGE_END_US = 2400000000LL;     // ... for 10 min
+static constexpr int64_t RELOCK_US = 120000000LL;         // excluded from the locked error
+static constexpr uint32_t NOISE_US = 20U;
+static constexpr int64_t REFERENCE_EPOCH_US = 1700000000000000LL;  // reference is wall time
+
+DisciplinedClock g_clock;
+double g_trueUs = 0.0;
+double g_localUs = 0.0;
+
+int64_t simLocal() {
+  return static_cast<int64_t>(g_localUs);
+}
+
+int64_t referenceUs() {
+  return REFERENCE_EPOCH_US + static_cast<int64_t>(g_trueUs);
+}
+
+test::Lcg g_rng(0xBE7CU);
+
+const char* stateName(DisciplineState s) {
+  switch (s) {
+    case DisciplineState::UNSYNCHRONIZED:
+      return "UNSYNC";
+    case DisciplineState::ACQUIRING:
+      return "ACQUIRE";
+    case DisciplineState::LOCKED:
+      return "LOCKED";
+    case DisciplineState::HOLDOVER:
+      return "HOLDOVER";
+  }
+  return "?";
+}
+
+void simulate(double basePpm) {
+  const double wanderPpm = 5.0;
+  const double wanderPeriodS = 900.0;
+  g_trueUs = 0.0;
+  g_localUs = 1000000.0;
+
+  DisciplinedClockConfig cfg;
+  cfg.clock = &simLocal;
+  DisciplinedClock clock;
+  (void)clock.begin(cfg);
+
+  printf("\noscillator %+.0f ppm, wander ±%.0f ppm / %.0f s, reference noise ±%u us\n",
+         basePpm, wanderPpm, wanderPeriodS, NOISE_US);
+  printf("%8s %-9s %10s %12s %12s %10s\n", "time s", "state", "error us", "osc ppm",
+         "freq ppb", "rate ppb");
+
+  int64_t sinceSample = SAMPLE_EVERY_US;
+  int64_t worstLocked = 0;
+  int64_t worstHoldover = 0;
+  bool monotonic = true;
+  int64_t last = clock.correctedMicros64();
+  for (int64_t t = 0; t <= SIM_US; t += STEP_US) {
+    const double ppm =
+        basePpm + wanderPpm * sin(2.0 * 3.14159265358979 * g_trueUs / 1e6 / wanderPeriodS);
+    g_localUs += static_cast<double>(STEP_US) * (1.0 + ppm * 1e-6);
+    g_trueUs += static_cast<double>(STEP_US);
+
+    sinceSample += STEP_US;
+    const bool outage = (t >= OUTAGE_START_US) && (t < OUTAGE_END_US);
+    if (!outage && (sinceSample >= SAMPLE_EVERY_US)) {
+      sinceSample = 0;
+      (void)clock.addSample(simLocal(), referenceUs() + g_rng.noise(NOISE_US));
+    }
+
+    const int64_t now = clock.correctedMicros64();
+    monotonic = monotonic && (now >= last);
+    last = now;
+    int64_t err = now - referenceUs();
+    err = err < 0 ? -err : err;
+    if (outage) {
+      worstHoldover = err > worstHoldover ? err : worstHoldover;
+    } else if ((t >= 60000000) && !((t >= OUTAGE_END_US) && (t < OUTAGE_END_US + RELOCK_US))) {
+      worstLocked = err > worstLocked ? err : worstLocked;
+    }
+
+    const bool early = (t <= 10000000) && (t % 1000000 == 0);
+    if (early || (t % 300000000 == 0) || (t == OUTAGE_END_US - STEP_US)) {
+      const DisciplineTelemetry tm = clock.telemetry();
+      printf("%8.2f %-9s %10lld %12.3f %12d %10d\n", static_cast<double>(t) / 1e6,
+             stateName(tm.state), static_cast<long long>(now - referenceUs()),
+             ppm, tm.frequencyPpb, tm.rateAdjustPpb);
+    }
+  }
+  printf("worst |error| locked (after 60 s, excl. 2 min relock): %lld us, "
+         "holdover (10 min): %lld us, monotonic: %s\n",
+         static_cast<long long>(worstLocked), static_cast<long long>(worstHoldover),
+         monotonic ? "yes" : "NO");
+}
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  simulate(+50.0);
+  simulate(-50.0);
+
+  printf("\n");
+  (void)calibrateCycleClock();
+  (void)g_clock.begin(DisciplinedClockConfig());
+  const int64_t local = micros64();
+  (void)g_clock.addSample(local, local + 1000);
+  runAndPrint("micros64", [] { doNotOptimize(micros64()); });
+  runAndPrint("DisciplinedClock correctedMicros64",
+              [] { doNotOptimize(g_clock.correctedMicros64()); });
+  return 0;
+}
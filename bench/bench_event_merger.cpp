@@ -0,0 +1,129 @@
+/**
+ * @file bench_event_merger.cpp
+ * @brief K-way merge throughput against concatenate-and-sort at k = 4/16/64.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/EventMerger.h"
+#include "Lcg.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr size_t TOTAL = 4096U;  // events per merge, split across k sources
+
+struct ArraySource : EventSource {
+  const TimedEvent* events = nullptr;
+  size_t count = 0U;
+  size_t next_ = 0U;
+
+  bool next(TimedEvent& out) override {
+    if (next_ == count) {
+      return false;
+    }
+    out = events[next_++];
+    return true;
+  }
+};
+
+TimedEvent g_input[TOTAL];
+TimedEvent g_output[TOTAL];
+ArraySource g_sources[EVENT_MERGE_MAX_SOURCES];
+EventSource* g_sourcePtrs[EVENT_MERGE_MAX_SOURCES];
+EventMerger g_merger;
+size_t g_k = 0U;
+
+test::Lcg g_rng(0x4D3EU);
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+/// k sorted runs laid out back to back, as if copied from k rings.
+void prepare(size_t k) {
+  g_k = k;
+  const size_t per = TOTAL / k;
+  for (size_t s = 0; s < k; ++s) {
+    int64_t t = g_rng.next(1000U);
+    for (size_t i = 0; i < per; ++i) {
+      t += 1 + g_rng.next(200U);
+      TimedEvent& ev = g_input[s * per + i];
+      ev.micros = t;
+      ev.source = static_cast<uint32_t>(s);
+      ev.payload = static_cast<uint32_t>(i);
+    }
+    g_sources[s].events = &g_input[s * per];
+    g_sources[s].count = per;
+    g_sourcePtrs[s] = &g_sources[s];
+  }
+}
+
+bool earlier(const TimedEvent& a, const TimedEvent& b) {
+  return (a.micros < b.micros) || ((a.micros == b.micros) && (a.source < b.source));
+}
+
+int compareEvents(const void* a, const void* b) {
+  const TimedEvent& x = *static_cast<const TimedEvent*>(a);
+  const TimedEvent& y = *static_cast<const TimedEvent*>(b);
+  return earlier(x, y) ? -1 : (earlier(y, x) ? 1 : 0);
+}
+
+void merge() {
+  for (size_t s = 0; s < g_k; ++s) {
+    g_sources[s].next_ = 0U;
+  }
+  (void)g_merger.begin(g_sourcePtrs, g_k);
+  doNotOptimize(g_merger.drain(INT64_MAX, g_output, TOTAL));
+  clobberMemory();
+}
+
+void stdSort() {
+  std::copy(g_input, g_input + TOTAL, g_output);
+  std::sort(g_output, g_output + TOTAL, earlier);
+  clobberMemory();
+}
+
+void cSort() {
+  std::copy(g_input, g_input + TOTAL, g_output);
+  qsort(g_output, TOTAL, sizeof(TimedEvent), compareEvents);
+  clobberMemory();
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  printf("%u events per run; divide by %u for per-event cost\n", static_cast<unsigned>(TOTAL),
+         static_cast<unsigned>(TOTAL));
+
+  prepare(4U);
+  runAndPrint("k=4   EventMerger", merge);
+  runAndPrint("k=4   copy + std::sort", stdSort);
+  runAndPrint("k=4   copy + qsort", cSort);
+
+  prepare(16U);
+  runAndPrint("k=16  EventMerger", merge);
+  runAndPrint("k=16  copy + std::sort", stdSort);
+  runAndPrint("k=16  copy + qsort", cSort);
+
+  prepare(64U);
+  runAndPrint("k=64  EventMerger", merge);
+  runAndPrint("k=64  copy + std::sort", stdSort);
+  runAndPrint("k=64  copy + qsort", cSort);
+  return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file bench_ewma.cpp
+ * @brief Time-aware EWMA: update cost against an exp()-based double update,
+ *        and accuracy against a double-precision reference.
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/Ewma.h"
+#include "Lcg.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr uint32_t TAU_US = 60000000U;
+
+DecayFactor g_decay;
+TimeEwma g_ewma;
+DecayingRate g_rate;
+double g_reference = 0.0;
+int64_t g_nowUs = 0;
+int64_t g_lastUs = 0;
+int32_t g_value = 0;
+
+test::Lcg g_rng(0xE7A5U);
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+/// Irregular stream (1 ms .. 10 s apart) through TimeEwma and a double EWMA.
+void accuracy(uint32_t tauUs) {
+  DecayFactor decay;
+  (void)decay.begin(tauUs);
+  double worstFactor = 0.0;
+  for (int i = 1; i <= 100000; ++i) {
+    const int64_t t = static_cast<int64_t>(static_cast<double>(tauUs) * 25.0 * i / 100000.0);
+    const double err = fabs(decay.at(t) / 2147483648.0 - exp(-static_cast<double>(t) / tauUs));
+    worstFactor = err > worstFactor ? err : worstFactor;
+  }
+
+  TimeEwma ewma;
+  (void)ewma.begin(tauUs);
+  double reference = 0.0;
+  double worstValue = 0.0;
+  int64_t t = 0;
+  for (int i = 0; i < 100000; ++i) {
+    const int32_t x = static_cast<int32_t>(g_rng.next(2000001U)) - 1000000;
+    const int64_t dt = i == 0 ? 0 : 1000 + static_cast<int64_t>(g_rng.next(10000000U));
+    t += dt;
+    reference = i == 0 ? x : x + (reference - x) * exp(-static_cast<double>(dt) / tauUs);
+    ewma.updateAt(t, x);
+    const double err = fabs(ewma.valueQ16() / 65536.0 - reference);
+    worstValue = err > worstValue ? err : worstValue;
+  }
+  printf("  tau %6.0f s  factor max err %.2e  EWMA max err %.4f (inputs +/-1e6)\n",
+         tauUs / 1e6, worstFactor, worstValue);
+}
+
+}  // namespace
+
+int main() {
+  printf("accuracy vs. double exp() reference:\n");
+  accuracy(1000000U);
+  accuracy(60000000U);
+  accuracy(900000000U);
+
+  (void)calibrateCycleClock();
+  (void)g_decay.begin(TAU_US);
+  (void)g_ewma.begin(TAU_US);
+  (void)g_rate.begin(TAU_US);
+  runAndPrint("DecayFactor::at", [] {
+    g_nowUs += 1237;
+    doNotOptimize(g_decay.at(g_nowUs & 0x3FFFFFFF));
+  });
+  runAndPrint("TimeEwma::updateAt", [] {
+    g_nowUs += 1237;
+    g_ewma.updateAt(g_nowUs, ++g_value);
+    clobberMemory();
+  });
+  runAndPrint("DecayingRate::addAt", [] {
+    g_nowUs += 1237;
+    g_rate.addAt(g_nowUs);
+    clobberMemory();
+  });
+  runAndPrint("DecayingRate::rateAt", [] { doNotOptimize(g_rate.rateAt(g_nowUs)); });
+  runAndPrint("double EWMA with exp()", [] {
+    g_nowUs += 1237;
+    const double f = exp(-static_cast<double>(g_nowUs - g_lastUs) / TAU_US);
+    g_lastUs = g_nowUs;
+    ++g_value;
+    g_reference = g_value + (g_reference - g_value) * f;
+    doNotOptimize(g_reference);
+  });
+  return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file bench_hybrid_logical_clock.cpp
+ * @brief HLC send()/receive() cost and multi-threaded throughput.
+ */
+
+#include <stdio.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/HybridLogicalClock.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int OPS_PER_RUN = 4000000;
+
+HybridLogicalClock g_hlc;
+int64_t g_fixedPt = 1000000;
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+void runThreads(int threads) {
+  std::vector<std::thread> workers;
+  const int perThread = OPS_PER_RUN / threads;
+  const auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([perThread] {
+      HlcTimestamp out;
+      for (int i = 0; i < perThread; ++i) {
+        if ((i & 1) == 0) {
+          out = g_hlc.send();
+        } else {
+          (void)g_hlc.receive(out, out);
+        }
+      }
+      doNotOptimize(out);
+    });
+  }
+  for (std::thread& w : workers) {
+    w.join();
+  }
+  const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("send/receive mix %d thread(s): %6.2f M ops/s\n", threads,
+         static_cast<double>(perThread) * threads / seconds / 1e6);
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  (void)g_hlc.begin(HlcConfig());
+
+  runAndPrint("HLC send", [] { doNotOptimize(g_hlc.send()); });
+  runAndPrint("HLC sendAt (no clock read)", [] { doNotOptimize(g_hlc.sendAt(g_fixedPt)); });
+  runAndPrint("HLC receive", [] {
+    HlcTimestamp out;
+    (void)g_hlc.receive(g_hlc.last(), out);
+    doNotOptimize(out);
+  });
+
+  printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  for (int threads = 1; threads <= 8; threads *= 2) {
+    runThreads(threads);
+  }
+  return 0;
+}
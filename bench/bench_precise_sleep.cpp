@@ -0,0 +1,110 @@
+/**
+ * @file bench_precise_sleep.cpp
+ * @brief Wake-up error histograms and CPU use: plain OS sleep, pure spin
+ *        and the hybrid sleepUntil().
+ *
+ * Each strategy waits for 300 periodic 2 ms deadlines. CPU is the calling
+ * thread's CPU time (CLOCK_THREAD_CPUTIME_ID) as a share of the wall time.
+ * The same comparison on ESP32/FreeRTOS (vTaskDelay vs. sleepUntil) is the
+ * 'sleep' command of the CLI example.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "SystemChrono/PreciseSleep.h"
+#include "SystemChrono/SystemChrono.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int WAITS = 300;
+static constexpr int64_t PERIOD_US = 2000;
+static constexpr int BINS = 12;  // 0, 1, 2-3, 4-7, ... , >= 1024 us
+
+int64_t threadCpuUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000LL + ts.tv_nsec / 1000LL;
+}
+
+int binOf(int64_t lateUs) {
+  int bin = 0;
+  while ((lateUs > 0) && (bin < BINS - 1)) {
+    lateUs >>= 1;
+    ++bin;
+  }
+  return bin;
+}
+
+int64_t waitNanosleep(int64_t deadlineUs) {
+  const int64_t remaining = deadlineUs - micros64();
+  if (remaining > 0) {
+    struct timespec ts;
+    ts.tv_sec = static_cast<time_t>(remaining / 1000000LL);
+    ts.tv_nsec = static_cast<long>((remaining % 1000000LL) * 1000LL);
+    (void)nanosleep(&ts, nullptr);
+  }
+  return micros64() - deadlineUs;
+}
+
+int64_t waitSpin(int64_t deadlineUs) {
+  int64_t now = micros64();
+  while (now < deadlineUs) {
+    now = micros64();
+  }
+  return now - deadlineUs;
+}
+
+int64_t waitHybrid(int64_t deadlineUs) {
+  return sleepUntil(deadlineUs);
+}
+
+void run(const char* name, int64_t (*wait)(int64_t)) {
+  uint32_t histogram[BINS] = {};
+  int64_t worst = 0;
+  int64_t total = 0;
+  const int64_t cpuStart = threadCpuUs();
+  const int64_t wallStart = micros64();
+  int64_t deadline = wallStart;
+  for (int i = 0; i < WAITS; ++i) {
+    deadline += PERIOD_US;
+    const int64_t late = wait(deadline);
+    ++histogram[binOf(late)];
+    total += late;
+    worst = late > worst ? late : worst;
+  }
+  const double cpu = 100.0 * static_cast<double>(threadCpuUs() - cpuStart) /
+                     static_cast<double>(micros64() - wallStart);
+  printf("%-18s mean late %7.1f us  max %6lld us  CPU %5.1f %%\n", name,
+         static_cast<double>(total) / WAITS, static_cast<long long>(worst), cpu);
+  printf("  late(us) ");
+  for (int b = 0; b < BINS; ++b) {
+    if (b == 0) {
+      printf("     0");
+    } else if (b == BINS - 1) {
+      printf(" >=%4d", 1 << (b - 1));
+    } else {
+      printf(" %5d", 1 << (b - 1));
+    }
+  }
+  printf("\n  waits    ");
+  for (int b = 0; b < BINS; ++b) {
+    printf(" %5u", histogram[b]);
+  }
+  printf("\n");
+}
+
+}  // namespace
+
+int main() {
+  printf("%d waits on a %lld us period\n", WAITS, static_cast<long long>(PERIOD_US));
+  run("nanosleep", &waitNanosleep);
+  run("spin on micros64", &waitSpin);
+  (void)waitHybrid(micros64() + 20 * PERIOD_US);  // let the guards settle first
+  run("sleepUntil", &waitHybrid);
+  printf("learned guards: sleep %u us, spin %u us\n", defaultSleeper().sleepGuardUs(),
+         defaultSleeper().spinGuardUs());
+  return 0;
+}
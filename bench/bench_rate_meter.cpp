@@ -0,0 +1,87 @@
+/**
+ * @file bench_rate_meter.cpp
+ * @brief RateMeter against the timestamp-array approach (count entries newer
+ *        than now - window) at 1000 events per 10 s window.
+ */
+
+#include <stdio.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/RateMeter.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t WINDOW_US = 10000000;
+static constexpr int64_t EVENT_SPACING_US = 10000;  // 100 events/s
+static constexpr size_t HISTORY = 1024U;            // >= events per window
+
+/// The O(n) baseline: a ring of event timestamps, scanned on every query.
+struct TimestampArray {
+  int64_t stamps[HISTORY] = {};
+  size_t next = 0U;
+
+  void record(int64_t nowUs) {
+    stamps[next] = nowUs;
+    next = (next + 1U) % HISTORY;
+  }
+
+  uint32_t count(int64_t nowUs) const {
+    uint32_t n = 0U;
+    for (size_t i = 0; i < HISTORY; ++i) {
+      n += (stamps[i] > nowUs - WINDOW_US) ? 1U : 0U;
+    }
+    return n;
+  }
+};
+
+RateMeter g_meter;
+TimestampArray g_array;
+int64_t g_meterUs = 1;
+int64_t g_arrayUs = 1;
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  (void)g_meter.begin(RateMeterConfig());
+  for (int i = 0; i < 2000; ++i) {  // fill both windows
+    g_meter.recordAt(g_meterUs += EVENT_SPACING_US);
+    g_array.record(g_arrayUs += EVENT_SPACING_US);
+  }
+  printf("window holds %u events (meter) / %u (array), %u bytes per RateMeter\n",
+         g_meter.countAt(g_meterUs), g_array.count(g_arrayUs),
+         static_cast<unsigned>(sizeof(RateMeter)));
+
+  runAndPrint("RateMeter recordAt", [] {
+    g_meter.recordAt(g_meterUs += EVENT_SPACING_US);
+    clobberMemory();
+  });
+  runAndPrint("RateMeter countAt", [] { doNotOptimize(g_meter.countAt(g_meterUs)); });
+  runAndPrint("RateMeter rateAt", [] { doNotOptimize(g_meter.rateAt(g_meterUs)); });
+  runAndPrint("RateMeter record (micros64)", [] {
+    g_meter.record();
+    clobberMemory();
+  });
+
+  runAndPrint("timestamp array record", [] {
+    g_array.record(g_arrayUs += EVENT_SPACING_US);
+    clobberMemory();
+  });
+  runAndPrint("timestamp array count", [] { doNotOptimize(g_array.count(g_arrayUs)); });
+  return 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bench_tick_correlator.cpp
+ * @brief Tick conversion throughput (scalar vs. batch) and fit accuracy on synthetic data.
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/TickCorrelator.h"
+#include "Lcg.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr size_t BATCH = 1024U;
+
+TickCorrelator g_corr;
+uint32_t g_ticks[BATCH];
+int64_t g_out[BATCH];
+uint32_t g_sampleTicks = 0U;
+int64_t g_sampleMicros = 0;
+
+test::Lcg g_rng(0x7EC0U);
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+/// Fit a 32.768 kHz counter (+35 ppm) observed about every 10 ms with
+/// uniform stamping jitter; report the conversion error over the last second.
+void accuracy(uint8_t weightShift, uint32_t jitterUs) {
+  const double hz = 32768.0 * (1.0 + 35e-6);
+  const uint32_t startTicks = 0xFFFFC000U;  // wraps early in the run
+  TickCorrelatorConfig cfg;
+  cfg.weightShift = weightShift;
+  TickCorrelator c;
+  (void)c.begin(cfg);
+
+  const int samples = 3000;
+  for (int i = 0; i < samples; ++i) {
+    // Observation instants vary by +/-1 ms so tick phase is not periodic.
+    const double us = 1e6 + i * 10000.0 + (g_rng.unit() * 2.0 - 1.0) * 1000.0;
+    const uint32_t ticks = startTicks + static_cast<uint32_t>(static_cast<uint64_t>(
+                                            (us - 1e6) * 1e-6 * hz));
+    const double jitter = (g_rng.unit() * 2.0 - 1.0) * jitterUs;
+    (void)c.addSample(ticks, static_cast<int64_t>(us + jitter));
+  }
+  const uint64_t last = static_cast<uint64_t>((samples - 1) * 10000.0 * 1e-6 * hz);
+  double sumSq = 0.0;
+  double worst = 0.0;
+  int n = 0;
+  for (uint64_t e = last - 32768U; e <= last; e += 7U, ++n) {
+    const double truth = 1e6 + (static_cast<double>(e) + 0.5) / hz * 1e6;
+    const double err =
+        static_cast<double>(c.toMicros(startTicks + static_cast<uint32_t>(e))) - truth;
+    sumSq += err * err;
+    worst = fabs(err) > worst ? fabs(err) : worst;
+  }
+  printf("  weightShift %2u  jitter ±%3u us  rms %6.2f us  max %6.2f us  slope err %+7.3f ppm\n",
+         weightShift, jitterUs, sqrt(sumSq / n), worst,
+         (c.microsPerTick() * hz / 1e6 - 1.0) * 1e6);
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+
+  printf("fit accuracy (32.768 kHz +35 ppm, 100 Hz observations, 30 s):\n");
+  const uint8_t shifts[] = {4U, 6U, 8U};
+  const uint32_t jitters[] = {5U, 20U, 100U};
+  for (uint8_t s : shifts) {
+    for (uint32_t j : jitters) {
+      accuracy(s, j);
+    }
+  }
+
+  (void)g_corr.begin(TickCorrelatorConfig());
+  for (uint32_t i = 0; i < 64U; ++i) {
+    (void)g_corr.addSample(i * 32768U, 1000000 + static_cast<int64_t>(i) * 1000000);
+  }
+  for (size_t i = 0; i < BATCH; ++i) {
+    g_ticks[i] = 63U * 32768U - static_cast<uint32_t>(BATCH) * 29U + static_cast<uint32_t>(i) * 29U;
+  }
+  g_sampleTicks = 64U * 32768U;
+  g_sampleMicros = 65000000;
+
+  runAndPrint("toMicros scalar x1024", [] {
+    for (size_t i = 0; i < BATCH; ++i) {
+      g_out[i] = g_corr.toMicros(g_ticks[i]);
+    }
+    clobberMemory();
+  });
+  runAndPrint("toMicros batch x1024", [] {
+    g_corr.toMicros(g_ticks, g_out, BATCH);
+    clobberMemory();
+  });
+  runAndPrint("addSample (fit update)", [] {
+    g_sampleTicks += 32768U;
+    g_sampleMicros += 1000000;
+    (void)g_corr.addSample(g_sampleTicks, g_sampleMicros);
+  });
+  return 0;
+}
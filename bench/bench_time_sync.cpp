@@ -0,0 +1,76 @@
+/**
+ * @file bench_time_sync.cpp
+ * @brief Cost of one full time-sync exchange over a zero-latency loopback.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/TimeSync.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+/// Single-slot mailbox: the peer reads what was last sent to it.
+struct Mailbox : public TimeSyncTransport {
+  Mailbox* peer = nullptr;
+  uint8_t data[TIMESYNC_PACKET_SIZE];
+  size_t len = 0U;
+
+  Status send(const uint8_t* bytes, size_t n) override {
+    memcpy(peer->data, bytes, n);
+    peer->len = n;
+    return Ok();
+  }
+
+  Status receive(uint8_t* out, size_t capacity, size_t& outLen) override {
+    (void)capacity;
+    outLen = len;
+    if (len != 0U) {
+      memcpy(out, data, len);
+      len = 0U;
+    }
+    return Ok();
+  }
+};
+
+Mailbox g_clientSide;
+Mailbox g_serverSide;
+TimeSyncServer g_server;
+TimeSyncClient g_client;
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    printf("%s\n", line);
+  }
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+  g_clientSide.peer = &g_serverSide;
+  g_serverSide.peer = &g_clientSide;
+  (void)g_server.begin(g_serverSide);
+  (void)g_client.begin(g_clientSide, TimeSyncConfig());
+
+  runAndPrint("TimeSync client poll (idle)", [] { (void)g_client.poll(); });
+  runAndPrint("TimeSync full exchange", [] {
+    g_client.requestNow();
+    (void)g_client.poll();  // send request
+    (void)g_server.poll();  // answer
+    (void)g_client.poll();  // consume reply, filter
+  });
+  doNotOptimize(g_client.offsetUs());
+  printf("samples: %u\n", g_client.stats().samples);
+  return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file bench_window_aggregator.cpp
+ * @brief Samples ingested per second: tumbling, hopping and a
+ *        seconds -> minutes -> hours cascade.
+ */
+
+#include <stdio.h>
+
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/WindowAggregator.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t BATCH = 1024;
+
+struct CountingSink : WindowSink {
+  uint64_t windows = 0U;
+  void onWindow(const WindowStats& window) override {
+    windows += window.count != 0U ? 1U : 0U;
+  }
+};
+
+CountingSink g_sink;
+WindowAggregator g_tumbling;
+WindowAggregator g_hopping;
+WindowAggregator g_seconds;
+WindowAggregator g_minutes;
+WindowAggregator g_hours;
+int64_t g_tumblingUs = 0;
+int64_t g_hoppingUs = 0;
+int64_t g_cascadeUs = 0;
+
+template <typename Fn>
+void runAndPrint(const char* name, Fn fn) {
+  BenchResult result;
+  if (!runBenchmark(name, fn, BenchConfig(), result).ok()) {
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    const double nsPerSample = static_cast<double>(result.medianPs) / 1000.0 / BATCH;
+    printf("%s\n    -> %.2f ns/sample, %.1f M samples/s\n", line, nsPerSample,
+           1000.0 / nsPerSample);
+  }
+}
+
+/// 1 kHz samples with a sawtooth value.
+void feed(WindowAggregator& agg, int64_t& nowUs) {
+  for (int64_t i = 0; i < BATCH; ++i) {
+    agg.add(nowUs, static_cast<int32_t>(nowUs & 0xFFF));
+    nowUs += 1000;
+  }
+  clobberMemory();
+}
+
+}  // namespace
+
+int main() {
+  (void)calibrateCycleClock();
+
+  WindowConfig cfg;
+  (void)g_tumbling.begin(cfg, &g_sink);
+  (void)g_seconds.begin(cfg, nullptr);
+  cfg.bucketUs = 60000000U;
+  (void)g_minutes.begin(cfg, &g_sink);
+  cfg.bucketUs = 3600000000U;
+  (void)g_hours.begin(cfg, &g_sink);
+  (void)g_seconds.cascadeTo(g_minutes);
+  (void)g_minutes.cascadeTo(g_hours);
+  cfg.bucketUs = 1000000U;
+  cfg.hops = 60U;  // 1 min window hopping by 1 s
+  (void)g_hopping.begin(cfg, &g_sink);
+
+  runAndPrint("add x1024 tumbling 1 s", [] { feed(g_tumbling, g_tumblingUs); });
+  runAndPrint("add x1024 hopping 60 x 1 s", [] { feed(g_hopping, g_hoppingUs); });
+  runAndPrint("add x1024 cascade s/min/h", [] { feed(g_seconds, g_cascadeUs); });
+  doNotOptimize(g_sink.windows);
+  return 0;
+}
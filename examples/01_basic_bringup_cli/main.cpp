@@ -8,6 +8,8 @@
  * - Elapsed timer classes (ElapsedMicros64, ElapsedMillis64, ElapsedSeconds64)
  * - Stopwatch with start/stop/resume/reset
  * - Human-readable time formatting (allocation-free and String variants)
+ * - Micro-benchmark harness (min/median/MAD per call)
+ * - Hybrid sleepUntil() against delay(): wake-up error and busy time
  *
  * Type 'help' for available commands.
  */
@@ -16,6 +18,10 @@
 
 #include "examples/common/BoardPins.h"
 #include "examples/common/Log.h"
+#include "SystemChrono/Bench.h"
+#include "SystemChrono/ClockCalibration.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/PreciseSleep.h"
 #include "SystemChrono/Version.h"
 #include "SystemChrono/SystemChrono.h"
 
@@ -93,7 +99,10 @@ static void printHelp() {
   printHelpItem("format", "Show human-readable time (HH:MM:SS.mmm)");
   printHelpItem("stamp", "Capture a timestamp (micros64/millis64/seconds64)");
   printHelpItem("since", "Show elapsed since last stamp");
-  printHelpItem("measure", "Measure delayMicroseconds(50) overhead");
+  printHelpItem("measure", "Measure delayMicroseconds(50) (raw and compensated)");
+  printHelpItem("bench", "Benchmark time accessors (min/median/MAD)");
+  printHelpItem("drift", "Check cycle counter frequency against micros64");
+  printHelpItem("sleep", "Wake-up error histogram: delay() vs sleepUntil()");
   Serial.println();
   printHelpSection("Stopwatch");
   printHelpItem("start", "Reset and start stopwatch");
@@ -256,8 +265,154 @@ static void cmdSince() {
 static void cmdMeasure() {
   g_measurement = 0;
   delayMicroseconds(50);
-  int64_t elapsed = g_measurement;
-  LOGI("delayMicroseconds(50) took %lld us", static_cast<long long>(elapsed));
+  const int64_t elapsed = g_measurement;
+  const int64_t compensated = compensateReadOverhead(elapsed);
+  LOGI("delayMicroseconds(50) took %lld us (%lld us compensated%s)",
+       static_cast<long long>(elapsed),
+       static_cast<long long>(compensated),
+       clockCalibration().valid ? "" : ", run 'bench' to calibrate");
+}
+
+/**
+ * @brief Run one benchmark and print its result line.
+ */
+template <typename Fn>
+static void runAndPrintBenchmark(const char* name, Fn fn) {
+  BenchResult result;
+  const Status status = runBenchmark(name, fn, BenchConfig(), result);
+  if (!status.ok()) {
+    LOGE("%s: %s", name, status.msg);
+    return;
+  }
+  char line[BENCH_RESULT_BUFFER_SIZE];
+  if (formatBenchResultTo(result, line, sizeof(line)).ok()) {
+    LOGI("%s", line);
+  }
+}
+
+/**
+ * @brief Handle 'bench' command - per-call cost of the time accessors.
+ */
+static void cmdBench() {
+  const Status calStatus = calibrateClockOverhead();
+  if (!calStatus.ok()) {
+    LOGE("calibrateClockOverhead failed: %s", calStatus.msg);
+    return;
+  }
+  const ClockCalibration& cal = clockCalibration();
+  LOGI("micros64() read cost: %ld ns (jitter %ld ns)",
+       static_cast<long>(cal.readCostNs),
+       static_cast<long>(cal.jitterNs));
+
+  const Status cycleStatus = calibrateCycleClock();
+  if (cycleStatus.ok()) {
+    LOGI("Cycle counter: %llu Hz", static_cast<unsigned long long>(cycleClockHz()));
+  } else {
+    LOGW("calibrateCycleClock failed: %s", cycleStatus.msg);
+  }
+
+  LOGI("Benchmarking (overhead-subtracted, per call)...");
+  runAndPrintBenchmark("cycles64", [] { doNotOptimize(cycles64()); });
+  runAndPrintBenchmark("nanos64", [] { doNotOptimize(nanos64()); });
+  runAndPrintBenchmark("micros64", [] { doNotOptimize(micros64()); });
+  runAndPrintBenchmark("millis64", [] { doNotOptimize(millis64()); });
+  runAndPrintBenchmark("seconds64", [] { doNotOptimize(seconds64()); });
+  runAndPrintBenchmark("microsSince", [] { doNotOptimize(microsSince(g_stampUs)); });
+  runAndPrintBenchmark("ElapsedMillis64 read", [] {
+    doNotOptimize(static_cast<int64_t>(g_heartbeat));
+  });
+  runAndPrintBenchmark("Stopwatch start+stop", [] {
+    Stopwatch sw;
+    sw.start();
+    sw.stop();
+    doNotOptimize(sw);
+  });
+  runAndPrintBenchmark("formatTimeTo", [] {
+    char buf[TIME_FORMAT_BUFFER_SIZE];
+    doNotOptimize(formatTimeTo(g_stampUs, buf, sizeof(buf)).code);
+    doNotOptimize(buf[0]);
+  });
+}
+
+/**
+ * @brief Handle 'drift' command - compare cycle counter rate to calibration.
+ */
+static void cmdDrift() {
+  CycleClockDrift drift;
+  const Status status = checkCycleClockDrift(CYCLE_CLOCK_DEFAULT_WINDOW_US, 500U, drift);
+  if (!status.ok()) {
+    LOGE("checkCycleClockDrift failed: %s (run 'bench' to calibrate)", status.msg);
+    return;
+  }
+  LOGI("Cycle counter: calibrated %llu Hz, measured %llu Hz, %ld ppm%s",
+       static_cast<unsigned long long>(drift.calibratedHz),
+       static_cast<unsigned long long>(drift.measuredHz),
+       static_cast<long>(drift.errorPpm),
+       drift.drifted ? " (DRIFTED - recalibrating)" : "");
+  if (drift.drifted) {
+    (void)calibrateCycleClock();
+  }
+}
+
+/**
+ * @brief Print one wake-up error histogram (bins 0, 1, 2-3, ..., >= 1024 us).
+ */
+static void printWakeHistogram(const char* name, const uint32_t* bins, size_t count,
+                               int waits, int64_t totalLateUs, int64_t worstLateUs,
+                               int64_t busyUs, int64_t wallUs) {
+  LOGI("%-10s mean late %lld us, max %lld us, busy %lld%%", name,
+       static_cast<long long>(totalLateUs / waits),
+       static_cast<long long>(worstLateUs),
+       static_cast<long long>(busyUs * 100 / wallUs));
+  Serial.print(F("  waits:"));
+  for (size_t b = 0; b < count; ++b) {
+    Serial.printf(" %u", static_cast<unsigned>(bins[b]));
+  }
+  Serial.println();
+}
+
+/**
+ * @brief Handle 'sleep' command - 200 waits on a 2 ms period with delay()
+ *        (rounded up so it never wakes early) and with sleepUntil().
+ */
+static void cmdSleep() {
+  static constexpr size_t BINS = 12U;
+  static constexpr int WAITS = 200;
+  for (int mode = 0; mode < 2; ++mode) {
+    uint32_t bins[BINS] = {};
+    int64_t totalLate = 0;
+    int64_t worstLate = 0;
+    int64_t busy = 0;
+    const int64_t start = micros64();
+    int64_t deadline = start;
+    for (int i = 0; i < WAITS; ++i) {
+      deadline += 2000;
+      int64_t late = 0;
+      if (mode == 0) {
+        const int64_t remaining = deadline - micros64();
+        if (remaining > 0) {
+          delay(static_cast<uint32_t>((remaining + 999) / 1000));
+        }
+        late = micros64() - deadline;
+      } else {
+        SleepReport report;
+        late = defaultSleeper().sleepUntil(deadline, &report);
+        busy += report.yieldedUs + report.spunUs;
+      }
+      size_t bin = 0U;
+      for (int64_t v = late; (v > 0) && (bin < BINS - 1U); v >>= 1) {
+        ++bin;
+      }
+      ++bins[bin];
+      totalLate += late;
+      worstLate = late > worstLate ? late : worstLate;
+    }
+    printWakeHistogram(mode == 0 ? "delay()" : "sleepUntil", bins, BINS, WAITS,
+                       totalLate, worstLate, busy, micros64() - start);
+  }
+  LOGI("Learned guards: sleep %lu us, spin %lu us",
+       static_cast<unsigned long>(defaultSleeper().sleepGuardUs()),
+       static_cast<unsigned long>(defaultSleeper().spinGuardUs()));
 }
 
 /**
@@ -289,6 +444,12 @@ static void processCommand(const String& line) {
     cmdElapsed();
   } else if (line == "measure") {
     cmdMeasure();
+  } else if (line == "bench") {
+    cmdBench();
+  } else if (line == "drift") {
+    cmdDrift();
+  } else if (line == "sleep") {
+    cmdSleep();
   } else {
     LOGE("Unknown command '%s'. Type 'help' for usage.", line.c_str());
   }
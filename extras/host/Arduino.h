@@ -0,0 +1,47 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal Arduino shim for host (Linux/macOS) builds.
+ *
+ * Provides just enough of the Arduino core for the public SystemChrono
+ * header to compile natively: a `String` class backed by std::string.
+ * NOT part of the library API and never used in firmware builds.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+/**
+ * @brief Host stand-in for the Arduino `String` class (subset).
+ */
+class String {
+ public:
+  String() {}
+  String(const char* text) : _text(text != nullptr ? text : "") {}  // NOLINT: implicit like Arduino
+  String(const String& other) = default;
+  String& operator=(const String& other) = default;
+
+  const char* c_str() const { return _text.c_str(); }
+  size_t length() const { return _text.size(); }
+
+  String& operator+=(char c) {
+    _text += c;
+    return *this;
+  }
+
+  String& operator+=(const char* text) {
+    _text += (text != nullptr ? text : "");
+    return *this;
+  }
+
+  bool operator==(const String& other) const { return _text == other._text; }
+  bool operator==(const char* text) const { return _text == (text != nullptr ? text : ""); }
+  bool operator!=(const String& other) const { return !(*this == other); }
+  bool operator!=(const char* text) const { return !(*this == text); }
+
+ private:
+  std::string _text;
+};
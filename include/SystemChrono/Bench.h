@@ -0,0 +1,211 @@
+/**
+ * @file Bench.h
+ * @brief Small micro-benchmark harness built on the SystemChrono time base.
+ *
+ * Measures the per-iteration cost of a callable with auto-scaled iteration
+ * counts, warm-up rounds and empty-loop/clock-read overhead subtraction.
+ * Reports min, median and median absolute deviation (MAD) over a fixed
+ * number of samples. Runs on ESP32 (from the CLI example) and on host.
+ * Samples are timed with nanos64(): call calibrateCycleClock() first for
+ * cycle-counter resolution, otherwise the harness uses micros64().
+ *
+ * Usage:
+ * @code
+ * SystemChrono::BenchResult r;
+ * SystemChrono::runBenchmark("millis64", [] {
+ *   SystemChrono::doNotOptimize(SystemChrono::millis64());
+ * }, SystemChrono::BenchConfig(), r);
+ * @endcode
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+// ===========================================================================
+// Optimizer Barriers
+// ===========================================================================
+
+/**
+ * @brief Force the compiler to materialize a value.
+ *
+ * Prevents dead-code elimination of a benchmarked expression whose result
+ * is otherwise unused. Emits no instructions.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  const volatile T sink = value;
+  (void)sink;
+#endif
+}
+
+/**
+ * @brief Force all pending memory writes to be treated as observable.
+ */
+inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+// ===========================================================================
+// Configuration and Results
+// ===========================================================================
+
+/// @brief Maximum number of samples a single benchmark can collect.
+static constexpr uint8_t BENCH_MAX_SAMPLES = 31U;
+
+/// @brief Minimum buffer size for formatBenchResultTo().
+static constexpr size_t BENCH_RESULT_BUFFER_SIZE = 256U;
+
+/**
+ * @brief Benchmark run parameters.
+ */
+struct BenchConfig {
+  int64_t targetSampleUs = 2000;       ///< Target duration of one sample
+  uint8_t warmupRounds = 2U;           ///< Discarded samples before measuring
+  uint8_t samples = 11U;               ///< Measured samples (1..BENCH_MAX_SAMPLES)
+  uint32_t maxIterations = 1UL << 24;  ///< Upper bound for auto-scaling
+};
+
+/**
+ * @brief Benchmark statistics.
+ *
+ * All per-iteration costs are in picoseconds so sub-nanosecond operations
+ * remain representable without floating point.
+ */
+struct BenchResult {
+  const char* name = "";     ///< Benchmark name (static string)
+  uint32_t iterations = 0U;  ///< Iterations per sample after auto-scaling
+  uint8_t samples = 0U;      ///< Number of measured samples
+  int64_t minPs = 0;         ///< Fastest sample, per iteration
+  int64_t medianPs = 0;      ///< Median sample, per iteration
+  int64_t madPs = 0;         ///< Median absolute deviation, per iteration
+  int64_t overheadPs = 0;    ///< Subtracted loop + clock-read overhead, per iteration
+  int64_t noiseFloorPs = 0;  ///< Timer resolution + read jitter, per iteration
+};
+
+namespace detail {
+
+/// @brief Timestamp used by the harness, in nanoseconds.
+int64_t benchNowNs();
+
+/// @brief Resolution of benchNowNs(), in nanoseconds.
+int64_t benchResolutionNs();
+
+/// @brief Give the scheduler/watchdog a chance to run between samples.
+void benchYield();
+
+/**
+ * @brief Next iteration count while auto-scaling.
+ *
+ * Grows by 10x while a sample is shorter than 10% of the target, then
+ * extrapolates linearly to targetUs. Clamped to [1, maxIterations].
+ */
+uint32_t benchScaleIterations(uint32_t iterations, int64_t elapsedNs, int64_t targetUs,
+                              uint32_t maxIterations);
+
+/// @brief Compute min/median/MAD from raw and empty-loop sample totals.
+void benchSummarize(int64_t* rawNs, int64_t* emptyNs, uint8_t count, uint32_t iterations,
+                    BenchResult& out);
+
+/// @brief Loop body used to measure harness overhead.
+struct BenchEmptyBody {
+  void operator()() const {}
+};
+
+template <typename Fn>
+inline int64_t benchTimeLoopNs(Fn& fn, uint32_t iterations) {
+  const int64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    fn();
+    clobberMemory();
+  }
+  return benchNowNs() - start;
+}
+
+}  // namespace detail
+
+// ===========================================================================
+// Runner
+// ===========================================================================
+
+/**
+ * @brief Benchmark a callable.
+ * @param name Static string naming the benchmark.
+ * @param fn Callable invoked once per iteration. Wrap results in doNotOptimize().
+ * @param config Run parameters.
+ * @param out Receives statistics on success.
+ * @return OK on success.
+ * @return INVALID_CONFIG if samples is 0 or above BENCH_MAX_SAMPLES,
+ *         targetSampleUs <= 0, or maxIterations == 0.
+ *
+ * Iterations are scaled until one sample lasts about targetSampleUs. Each
+ * measured sample is paired with an empty-loop sample of the same length;
+ * the median empty-loop time (loop bookkeeping plus the two clock reads)
+ * is subtracted from every measured sample. If calibrateClockOverhead()
+ * has run, `noiseFloorPs` includes the measured clock-read jitter; results
+ * below it are indistinguishable from zero.
+ *
+ * @note Blocks for roughly (warmupRounds + 2 * samples) * targetSampleUs.
+ */
+template <typename Fn>
+Status runBenchmark(const char* name, Fn fn, const BenchConfig& config, BenchResult& out) {
+  if ((config.samples == 0U) || (config.samples > BENCH_MAX_SAMPLES) ||
+      (config.targetSampleUs <= 0) || (config.maxIterations == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Invalid benchmark configuration");
+  }
+
+  uint32_t iterations = 1U;
+  for (;;) {
+    const int64_t elapsedNs = detail::benchTimeLoopNs(fn, iterations);
+    const bool longEnough = (elapsedNs * 10) >= (config.targetSampleUs * 1000LL);
+    const uint32_t next = detail::benchScaleIterations(iterations, elapsedNs,
+                                                       config.targetSampleUs,
+                                                       config.maxIterations);
+    if (longEnough || (next == iterations)) {
+      iterations = next;
+      break;
+    }
+    iterations = next;
+  }
+
+  detail::BenchEmptyBody empty;
+  for (uint8_t i = 0; i < config.warmupRounds; ++i) {
+    (void)detail::benchTimeLoopNs(fn, iterations);
+    (void)detail::benchTimeLoopNs(empty, iterations);
+  }
+
+  int64_t rawNs[BENCH_MAX_SAMPLES];
+  int64_t emptyNs[BENCH_MAX_SAMPLES];
+  for (uint8_t i = 0; i < config.samples; ++i) {
+    detail::benchYield();
+    emptyNs[i] = detail::benchTimeLoopNs(empty, iterations);
+    rawNs[i] = detail::benchTimeLoopNs(fn, iterations);
+  }
+
+  out = BenchResult();
+  out.name = (name != nullptr) ? name : "";
+  detail::benchSummarize(rawNs, emptyNs, config.samples, iterations, out);
+  return Ok();
+}
+
+/**
+ * @brief Format a result as one human-readable line.
+ * @param result Statistics from runBenchmark().
+ * @param out Output buffer for null-terminated text.
+ * @param outLen Size of output buffer in bytes.
+ * @return OK on success.
+ * @return INVALID_CONFIG if `out` is null or smaller than BENCH_RESULT_BUFFER_SIZE.
+ */
+Status formatBenchResultTo(const BenchResult& result, char* out, size_t outLen);
+
+}  // namespace SystemChrono
@@ -0,0 +1,81 @@
+/**
+ * @file Chrono.h
+ * @brief std::chrono clock adapter over micros64().
+ *
+ * `SystemChrono::steady_clock` meets the TrivialClock requirements, so it
+ * drops into code written against `std::chrono` (`now()`, `time_point`,
+ * `duration_cast`, `sleep_until`-style helpers) and reads the same time
+ * base as micros64(), including the virtual clock when enabled.
+ *
+ * Usage:
+ * @code
+ * using namespace std::chrono;
+ * const auto t0 = SystemChrono::steady_clock::now();
+ * // ... work ...
+ * const milliseconds dt = duration_cast<milliseconds>(SystemChrono::steady_clock::now() - t0);
+ * @endcode
+ *
+ * @note Only available where `<chrono>` exists (SYSTEMCHRONO_HAS_CHRONO).
+ * @note from_micros64() / to_micros64() are constexpr from C++14 on.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/SystemChrono.h"
+
+#if SYSTEMCHRONO_HAS_CHRONO
+
+// time_point and duration members are constexpr only from C++14, so the
+// conversions below are constexpr there and plain inline in gnu++11.
+#if __cplusplus >= 201402L
+  #define SYSTEMCHRONO_CHRONO_CONSTEXPR constexpr
+#else
+  #define SYSTEMCHRONO_CHRONO_CONSTEXPR
+#endif
+
+namespace SystemChrono {
+
+/**
+ * @brief Monotonic std::chrono clock backed by micros64().
+ *
+ * `duration` is std::chrono::microseconds, so conversions to coarser units
+ * are compile-time ratios and now() is a single micros64() call.
+ */
+struct steady_clock {
+  using rep = int64_t;
+  using period = std::micro;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<steady_clock, duration>;
+
+  static constexpr bool is_steady = true;
+
+  /// @brief Current time; the epoch is boot (same as micros64()).
+  static time_point now() noexcept { return time_point(duration(micros64())); }
+
+  /// @brief Convert a micros64() timestamp to a time_point.
+  static SYSTEMCHRONO_CHRONO_CONSTEXPR time_point from_micros64(int64_t us) noexcept {
+    return time_point(duration(us));
+  }
+
+  /// @brief Convert a time_point to a micros64() timestamp.
+  static SYSTEMCHRONO_CHRONO_CONSTEXPR int64_t to_micros64(time_point tp) noexcept {
+    return tp.time_since_epoch().count();
+  }
+};
+
+/**
+ * @brief Format a steady_clock time point as HH:MM:SS.mmm since boot.
+ * @param time Time point from steady_clock::now().
+ * @param out Output buffer for null-terminated formatted string.
+ * @param outLen Size of output buffer in bytes.
+ * @return Same as formatTimeTo(int64_t, char*, size_t).
+ */
+inline Status formatTimeTo(steady_clock::time_point time, char* out, size_t outLen) {
+  return formatTimeTo(steady_clock::to_micros64(time), out, outLen);
+}
+
+}  // namespace SystemChrono
+
+#endif  // SYSTEMCHRONO_HAS_CHRONO
@@ -0,0 +1,128 @@
+/**
+ * @file ClockCalibration.h
+ * @brief Clock-read overhead calibration and compensation.
+ *
+ * Every interval measured with micros64() includes roughly one clock read:
+ * the part of the first read after its sample point plus the part of the
+ * second read before it. For 2-5 us sections that cost (about 1 us on
+ * ESP32-S2) dominates the result. calibrateClockOverhead() measures the
+ * median read cost once; measurement APIs can then subtract it on request.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::calibrateClockOverhead();
+ * SystemChrono::Stopwatch sw;
+ * sw.setOverheadCompensation(true);
+ * sw.start();
+ * // ... short section ...
+ * sw.stop();
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Maximum number of blocks a calibration run can collect.
+static constexpr uint16_t CALIBRATION_MAX_BLOCKS = 31U;
+
+/**
+ * @brief Result of a clock-read calibration.
+ */
+struct ClockCalibration {
+  int32_t readCostNs = 0;       ///< Median cost of one clock read
+  int32_t jitterNs = 0;         ///< Median absolute deviation of the per-block cost
+  uint16_t blocks = 0U;         ///< Number of blocks measured
+  uint16_t readsPerBlock = 0U;  ///< Back-to-back reads per block
+  bool valid = false;           ///< true once a calibration has been stored
+};
+
+namespace detail {
+
+/// @brief Fill `out` with the median and MAD of per-block costs (sorts in place).
+void summarizeCalibration(int32_t* blockCostNs, uint16_t blocks, uint16_t readsPerBlock,
+                          ClockCalibration& out);
+
+}  // namespace detail
+
+/**
+ * @brief Measure the read cost of an arbitrary microsecond clock.
+ * @param read Callable returning the clock value in microseconds.
+ * @param blocks Number of blocks (1..CALIBRATION_MAX_BLOCKS).
+ * @param readsPerBlock Back-to-back reads per block (>= 1).
+ * @param out Receives the calibration on success.
+ * @return OK on success.
+ * @return INVALID_CONFIG if blocks or readsPerBlock is out of range.
+ *
+ * Each block brackets `readsPerBlock` reads between two more reads, so the
+ * block spans readsPerBlock + 1 read-to-read intervals. Choose
+ * readsPerBlock so one block lasts well above the clock resolution.
+ *
+ * @note Does not store the result. Use setClockCalibration() for that.
+ */
+template <typename ReadFn>
+Status measureClockReadCost(ReadFn read, uint16_t blocks, uint16_t readsPerBlock,
+                            ClockCalibration& out) {
+  if ((blocks == 0U) || (blocks > CALIBRATION_MAX_BLOCKS) || (readsPerBlock == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Invalid calibration block configuration");
+  }
+
+  int32_t blockCostNs[CALIBRATION_MAX_BLOCKS];
+  for (uint16_t b = 0; b < blocks; ++b) {
+    const int64_t startUs = read();
+    for (uint16_t i = 0; i < readsPerBlock; ++i) {
+      (void)read();
+    }
+    const int64_t spanNs = (read() - startUs) * 1000LL;
+    blockCostNs[b] = static_cast<int32_t>(spanNs / (static_cast<int64_t>(readsPerBlock) + 1));
+  }
+
+  out = ClockCalibration();
+  detail::summarizeCalibration(blockCostNs, blocks, readsPerBlock, out);
+  return Ok();
+}
+
+/**
+ * @brief Measure and store the micros64() read cost.
+ * @param blocks Number of blocks (1..CALIBRATION_MAX_BLOCKS).
+ * @param readsPerBlock Back-to-back reads per block (>= 1).
+ * @return OK on success.
+ * @return INVALID_CONFIG if blocks or readsPerBlock is out of range.
+ *
+ * @note Call once at startup from a single task, before enabling
+ *       compensation anywhere. Blocks for blocks * readsPerBlock reads.
+ */
+Status calibrateClockOverhead(uint16_t blocks = 15U, uint16_t readsPerBlock = 1000U);
+
+/**
+ * @brief Get the stored calibration.
+ * @return Stored calibration (`valid == false` if none).
+ */
+const ClockCalibration& clockCalibration();
+
+/**
+ * @brief Store a calibration (e.g. a value measured on a previous boot).
+ * @param calibration Calibration to store; `valid` is forced to true.
+ */
+void setClockCalibration(const ClockCalibration& calibration);
+
+/**
+ * @brief Forget the stored calibration. Compensation becomes a no-op.
+ */
+void clearClockCalibration();
+
+/**
+ * @brief Subtract the calibrated read overhead from a measured interval.
+ * @param elapsedUs Measured elapsed microseconds.
+ * @param intervals Number of start/stop intervals summed into elapsedUs.
+ * @return elapsedUs minus intervals * readCostNs (rounded), never below 0.
+ *
+ * @note Returns elapsedUs unchanged if no calibration is stored.
+ */
+int64_t compensateReadOverhead(int64_t elapsedUs, uint32_t intervals = 1U);
+
+}  // namespace SystemChrono
@@ -0,0 +1,239 @@
+/**
+ * @file ClockSource.h
+ * @brief Pluggable clock sources for Stopwatch, elapsed timers and *Since() helpers.
+ *
+ * A ClockSource is any type with a static member function
+ * `static int64_t nowMicros()` returning monotonic microseconds. Templates
+ * in this header call it directly, so dispatch is static: no vtable, no
+ * function pointer, and the call inlines when the source is inline.
+ *
+ * SystemClock (the default) reads micros64(), so `BasicStopwatch<>` behaves
+ * like Stopwatch and `BasicElapsedMillis64<>` like ElapsedMillis64.
+ *
+ * Usage:
+ * @code
+ * struct TcxoClock {
+ *   static int64_t nowMicros() { return readTcxoTimerUs(); }
+ * };
+ * SystemChrono::BasicStopwatch<TcxoClock> sw;
+ * SystemChrono::BasicElapsedMillis64<TcxoClock> timeout;
+ * int64_t dt = SystemChrono::microsSince<TcxoClock>(startUs);
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+namespace SystemChrono {
+
+// ===========================================================================
+// ClockSource Requirement
+// ===========================================================================
+
+/**
+ * @brief Trait: true if `Clock::nowMicros()` exists and converts to int64_t.
+ */
+template <typename Clock, typename = void>
+struct IsClockSource : std::false_type {};
+
+template <typename Clock>
+struct IsClockSource<Clock, decltype(static_cast<void>(static_cast<int64_t>(Clock::nowMicros())))>
+    : std::true_type {};
+
+#if defined(__cpp_concepts) && (__cpp_concepts >= 201907L)
+/// @brief C++20 concept form of IsClockSource.
+template <typename Clock>
+concept ClockSource = IsClockSource<Clock>::value;
+#endif
+
+/**
+ * @brief Default clock source: micros64().
+ */
+struct SystemClock {
+  static int64_t nowMicros() { return micros64(); }
+};
+
+// ===========================================================================
+// Templated Elapsed Helpers
+// ===========================================================================
+
+/**
+ * @brief Elapsed microseconds since a timestamp taken from `Clock`.
+ * @param startUs Start timestamp from Clock::nowMicros().
+ * @return Elapsed microseconds (saturating).
+ */
+template <typename Clock>
+inline int64_t microsSince(int64_t startUs) {
+  return detail::saturatingSub(Clock::nowMicros(), startUs);
+}
+
+/**
+ * @brief Elapsed milliseconds since a millisecond timestamp taken from `Clock`.
+ * @param startMs Start timestamp, Clock::nowMicros() / 1000.
+ * @return Elapsed milliseconds (saturating).
+ */
+template <typename Clock>
+inline int64_t millisSince(int64_t startMs) {
+  return detail::saturatingSub(Clock::nowMicros() / 1000LL, startMs);
+}
+
+/**
+ * @brief Elapsed seconds since a second timestamp taken from `Clock`.
+ * @param startS Start timestamp, Clock::nowMicros() / 1000000.
+ * @return Elapsed seconds (saturating).
+ */
+template <typename Clock>
+inline int64_t secondsSince(int64_t startS) {
+  return detail::saturatingSub(Clock::nowMicros() / 1000000LL, startS);
+}
+
+// ===========================================================================
+// BasicStopwatch
+// ===========================================================================
+
+/**
+ * @brief Stopwatch driven by an arbitrary ClockSource.
+ *
+ * Same semantics as Stopwatch. Clock-read compensation is not available
+ * here because the calibration describes micros64() only.
+ *
+ * @note Not thread-safe.
+ */
+template <typename Clock = SystemClock>
+class BasicStopwatch {
+  static_assert(IsClockSource<Clock>::value,
+                "Clock must provide static int64_t nowMicros()");
+
+ public:
+  BasicStopwatch() : _startUs(0), _totalUs(0), _running(false) {}
+
+  /// @brief Reset and start the stopwatch.
+  void start() {
+    _totalUs = 0;
+    _startUs = Clock::nowMicros();
+    _running = true;
+  }
+
+  /// @brief Stop and accumulate elapsed time. No-op if stopped.
+  void stop() {
+    if (_running) {
+      _totalUs = detail::saturatingAdd(_totalUs, microsSince<Clock>(_startUs));
+      _running = false;
+      _startUs = 0;
+    }
+  }
+
+  /// @brief Resume without clearing accumulated time. No-op if running.
+  void resume() {
+    if (!_running) {
+      _startUs = Clock::nowMicros();
+      _running = true;
+    }
+  }
+
+  /// @brief Clear accumulated time; restarts from zero if running.
+  void reset() {
+    _totalUs = 0;
+    _startUs = _running ? Clock::nowMicros() : 0;
+  }
+
+  /// @brief Accumulated microseconds (includes current run).
+  int64_t elapsedMicros() const {
+    return _running ? detail::saturatingAdd(_totalUs, microsSince<Clock>(_startUs)) : _totalUs;
+  }
+
+  /// @brief Accumulated milliseconds.
+  int64_t elapsedMillis() const { return elapsedMicros() / 1000LL; }
+
+  /// @brief Accumulated seconds.
+  int64_t elapsedSeconds() const { return elapsedMicros() / 1000000LL; }
+
+  /// @brief true if running.
+  bool isRunning() const { return _running; }
+
+ private:
+  int64_t _startUs;
+  int64_t _totalUs;
+  bool _running;
+};
+
+// ===========================================================================
+// BasicElapsed
+// ===========================================================================
+
+/**
+ * @brief Auto-incrementing timer driven by an arbitrary ClockSource.
+ * @tparam Clock ClockSource type (default SystemClock).
+ * @tparam UnitUs Microseconds per unit (1, 1000 or 1000000; default 1).
+ *
+ * Same semantics as ElapsedMicros64 / ElapsedMillis64 / ElapsedSeconds64.
+ * Use the BasicElapsedMicros64 / BasicElapsedMillis64 /
+ * BasicElapsedSeconds64 aliases.
+ */
+template <typename Clock = SystemClock, int64_t UnitUs = 1>
+class BasicElapsed {
+  static_assert(IsClockSource<Clock>::value,
+                "Clock must provide static int64_t nowMicros()");
+  static_assert(UnitUs > 0, "UnitUs must be positive");
+
+ public:
+  BasicElapsed() : _us(Clock::nowMicros()) {}
+  explicit BasicElapsed(int64_t value) : _us(startFor(value)) {}
+  BasicElapsed(const BasicElapsed& orig) = default;
+
+  operator int64_t() const { return detail::saturatingSub(Clock::nowMicros(), _us) / UnitUs; }
+
+  BasicElapsed& operator=(const BasicElapsed& rhs) = default;
+  BasicElapsed& operator=(int64_t value) {
+    _us = startFor(value);
+    return *this;
+  }
+
+  BasicElapsed& operator-=(int64_t value) {
+    _us = detail::saturatingAdd(_us, toMicros(value));
+    return *this;
+  }
+  BasicElapsed& operator+=(int64_t value) {
+    _us = detail::saturatingSub(_us, toMicros(value));
+    return *this;
+  }
+
+  BasicElapsed operator-(int64_t value) const {
+    BasicElapsed r(*this);
+    r -= value;
+    return r;
+  }
+  BasicElapsed operator+(int64_t value) const {
+    BasicElapsed r(*this);
+    r += value;
+    return r;
+  }
+
+ private:
+  static int64_t toMicros(int64_t value) { return detail::saturatingMul(value, UnitUs); }
+  static int64_t startFor(int64_t value) {
+    return detail::saturatingSub(Clock::nowMicros(), toMicros(value));
+  }
+
+  int64_t _us;
+};
+
+/// @brief Microsecond timer on `Clock` (ElapsedMicros64 equivalent).
+template <typename Clock = SystemClock>
+using BasicElapsedMicros64 = BasicElapsed<Clock, 1>;
+
+/// @brief Millisecond timer on `Clock` (ElapsedMillis64 equivalent).
+template <typename Clock = SystemClock>
+using BasicElapsedMillis64 = BasicElapsed<Clock, 1000>;
+
+/// @brief Second timer on `Clock` (ElapsedSeconds64 equivalent).
+template <typename Clock = SystemClock>
+using BasicElapsedSeconds64 = BasicElapsed<Clock, 1000000>;
+
+}  // namespace SystemChrono
@@ -0,0 +1,124 @@
+/**
+ * @file CoarseClock.h
+ * @brief Cached coarse clock: millis64Coarse() for very cheap reads.
+ *
+ * millis64() pays for esp_timer_get_time() plus a 64-bit divide on every
+ * call. The coarse clock instead caches micros64(), millis64() and
+ * seconds64() in memory; readers do one tear-free load. The cache is
+ * refreshed by a periodic esp_timer callback (startCoarseClock(), ESP32) or
+ * by calling updateCoarseClock() from the loop or any updater thread.
+ *
+ * Staleness: a coarse value lags the precise one by at most the refresh
+ * interval plus the updater's scheduling latency. With the esp_timer
+ * updater at 1 ms (esp_timer task, priority 22) that is about 1-2 ms, i.e.
+ * `0 <= millis64() - millis64Coarse() <= 2` in normal operation. When
+ * updated from loop(), the bound is one loop iteration.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::startCoarseClock(1000);  // ESP32: refresh every 1 ms
+ * SystemChrono::CoarseElapsedMillis64 heartbeat;
+ * void loop() {
+ *   if (heartbeat >= 1000) { heartbeat = 0; }
+ * }
+ * @endcode
+ *
+ * @note Values are 0 until the first update. Use a single updater at a time.
+ * @note The coarse clock follows the virtual clock only when updated.
+ * @note On 32-bit targets the cache is a seqlock: a read spins while an
+ *       update is in progress. Do not read it from an ISR (or a higher
+ *       priority task on the same core) that can preempt the updater.
+ *       The esp_timer updater runs in a task, so task-level reads are fine.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/ClockSource.h"
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Default esp_timer refresh period.
+static constexpr uint32_t COARSE_CLOCK_DEFAULT_PERIOD_US = 1000U;
+
+/**
+ * @brief Start the periodic esp_timer updater.
+ * @param periodUs Refresh period in microseconds (100..1000000).
+ * @return OK on success (the cache is refreshed immediately).
+ * @return INVALID_CONFIG if periodUs is out of range, or on platforms
+ *         without esp_timer (call updateCoarseClock() instead).
+ * @return EXTERNAL_LIB_ERROR if esp_timer fails (detail = esp_err_t).
+ *
+ * Calling again restarts the timer with the new period.
+ */
+Status startCoarseClock(uint32_t periodUs = COARSE_CLOCK_DEFAULT_PERIOD_US);
+
+/**
+ * @brief Stop the periodic updater. Cached values stay frozen.
+ */
+void stopCoarseClock();
+
+/**
+ * @brief Refresh the cache from micros64().
+ *
+ * @note Single writer: call from one context (loop, a thread, or the
+ *       esp_timer callback), not several at once.
+ */
+void updateCoarseClock();
+
+/**
+ * @brief Cached microseconds (micros64() at the last update).
+ * @return Coarse microseconds since boot.
+ */
+int64_t micros64Coarse();
+
+/**
+ * @brief Cached milliseconds (millis64() at the last update).
+ * @return Coarse milliseconds since boot.
+ */
+int64_t millis64Coarse();
+
+/**
+ * @brief Cached seconds (seconds64() at the last update).
+ * @return Coarse seconds since boot.
+ */
+int64_t seconds64Coarse();
+
+/**
+ * @brief ClockSource reading the coarse cache.
+ */
+struct CoarseClock {
+  static int64_t nowMicros() { return micros64Coarse(); }
+};
+
+/**
+ * @brief Tick source over the cached milliseconds, for BasicElapsed.
+ *
+ * nowMicros() returns milliseconds, so BasicElapsed with UnitUs = 1 counts
+ * them with one load and one subtract, no divide. It counts ticks of the
+ * cache, as Arduino's elapsedMillis does: the first tick may come after
+ * less than a full millisecond. Use it only through CoarseElapsedMillis64.
+ */
+struct CoarseMillisClock {
+  static int64_t nowMicros() { return millis64Coarse(); }
+};
+
+/**
+ * @brief Tick source over the cached seconds, for BasicElapsed.
+ *
+ * Same as CoarseMillisClock in seconds; use it only through
+ * CoarseElapsedSeconds64.
+ */
+struct CoarseSecondsClock {
+  static int64_t nowMicros() { return seconds64Coarse(); }
+};
+
+/// @brief ElapsedMillis64 on the cached milliseconds.
+using CoarseElapsedMillis64 = BasicElapsed<CoarseMillisClock, 1>;
+
+/// @brief ElapsedSeconds64 on the cached seconds.
+using CoarseElapsedSeconds64 = BasicElapsed<CoarseSecondsClock, 1>;
+
+}  // namespace SystemChrono
@@ -0,0 +1,500 @@
+/**
+ * @file Coroutine.h
+ * @brief C++20 coroutine tasks on a micros64()-keyed ready queue:
+ *        `co_await sleepFor(250_ms)`, `sleepUntil(t)`, `withTimeout(s, d)`.
+ *
+ * A protocol written as a state machine over ElapsedMillis64 timers is
+ * hard to read. As a FreeRTOS task it is easy to read, but the task
+ * reserves a whole stack and every wait is a preemptive context switch.
+ * A coroutine is written like the task but suspends into a small heap-free
+ * frame:
+ *
+ *   Task          coroutine return type; the frame comes from a fixed pool
+ *   Executor      owns suspended tasks in a DeadlineRegistry keyed by the
+ *                 micros64() time each one may resume
+ *   sleepFor(d)   resume d after the current run (d is a std::chrono duration)
+ *   sleepUntil(t) resume at steady_clock time point t
+ *   Signal        one-waiter event; `co_await signal` waits for set()
+ *   withTimeout   `co_await withTimeout(signal, d)` -> true if set in time
+ *
+ * Frames are carved from SYSTEMCHRONO_CORO_FRAMES blocks of
+ * SYSTEMCHRONO_CORO_FRAME_BYTES bytes. A coroutine whose frame is larger,
+ * or created while the pool is empty, yields an invalid Task and spawn()
+ * reports OUT_OF_MEMORY; nothing is allocated from the heap.
+ *
+ * Usage:
+ * @code
+ * using namespace SystemChrono;
+ *
+ * Task blink() {
+ *   for (;;) {
+ *     toggleLed();
+ *     co_await sleepFor(250_ms);
+ *   }
+ * }
+ *
+ * Deadline* slots[4];
+ * Executor executor;
+ * executor.begin(slots, 4U);
+ * executor.spawn(blink());
+ *
+ * void loop() {
+ *   executor.run();
+ *   const int64_t wake = executor.nextWakeUs();
+ *   // DEADLINE_NONE: every task waits on a Signal; re-check soon instead.
+ *   SystemChrono::sleepUntil(wake == DEADLINE_NONE ? micros64() + 10000 : wake);
+ * }
+ * @endcode
+ *
+ * @note Needs C++20 coroutines (SYSTEMCHRONO_HAS_COROUTINES); the header is
+ *       empty otherwise. The library itself stays C++11.
+ * @note Not thread-safe: create, spawn and run tasks from one thread. The
+ *       frame pool is shared by all executors. Signal::set() updates the
+ *       ready queue and is not ISR-safe either: from an ISR, set a
+ *       std::atomic flag and call set() from the loop or task that runs
+ *       the executor.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/SystemChrono.h"
+
+#if !defined(SYSTEMCHRONO_HAS_COROUTINES)
+  #if defined(__cpp_impl_coroutine) && defined(__has_include)
+    #if __has_include(<coroutine>)
+      #define SYSTEMCHRONO_HAS_COROUTINES 1
+    #endif
+  #endif
+#endif
+#if !defined(SYSTEMCHRONO_HAS_COROUTINES)
+  #define SYSTEMCHRONO_HAS_COROUTINES 0
+#endif
+
+#if SYSTEMCHRONO_HAS_COROUTINES
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+
+#include "SystemChrono/Chrono.h"
+#include "SystemChrono/DeadlineRegistry.h"
+#include "SystemChrono/Status.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+/// Size of one coroutine frame block in bytes.
+#ifndef SYSTEMCHRONO_CORO_FRAME_BYTES
+#define SYSTEMCHRONO_CORO_FRAME_BYTES 256
+#endif
+
+/// Number of coroutine frame blocks (live tasks across all executors).
+#ifndef SYSTEMCHRONO_CORO_FRAMES
+#define SYSTEMCHRONO_CORO_FRAMES 32
+#endif
+
+namespace SystemChrono {
+
+static constexpr size_t CORO_FRAME_BYTES = SYSTEMCHRONO_CORO_FRAME_BYTES;
+static constexpr size_t CORO_FRAMES = SYSTEMCHRONO_CORO_FRAMES;
+
+/**
+ * @brief Duration literals for coroutine waits: `250_ms`, `20_us`, `5_s`.
+ */
+inline namespace literals {
+
+constexpr std::chrono::microseconds operator""_us(unsigned long long value) {
+  return std::chrono::microseconds(static_cast<int64_t>(value));
+}
+
+constexpr std::chrono::milliseconds operator""_ms(unsigned long long value) {
+  return std::chrono::milliseconds(static_cast<int64_t>(value));
+}
+
+constexpr std::chrono::seconds operator""_s(unsigned long long value) {
+  return std::chrono::seconds(static_cast<int64_t>(value));
+}
+
+}  // namespace literals
+
+/**
+ * @brief Frame pool usage.
+ */
+struct CoroutinePoolStats {
+  size_t used = 0U;          ///< Frames currently allocated
+  size_t peak = 0U;          ///< Most frames allocated at once
+  size_t largestFrame = 0U;  ///< Largest frame requested, in bytes
+  uint32_t rejected = 0U;    ///< Requests refused (pool empty or frame too big)
+};
+
+namespace detail {
+
+/// Fixed blocks of CORO_FRAME_BYTES threaded on an intrusive free list.
+class FramePool {
+ public:
+  void* allocate(size_t bytes) noexcept {
+    if (bytes > _stats.largestFrame) {
+      _stats.largestFrame = bytes;
+    }
+    if (!_initialized) {
+      for (size_t i = 0; i < CORO_FRAMES; ++i) {
+        _blocks[i].next = (i + 1U < CORO_FRAMES) ? &_blocks[i + 1U] : nullptr;
+      }
+      _free = &_blocks[0];
+      _initialized = true;
+    }
+    if ((bytes > CORO_FRAME_BYTES) || (_free == nullptr)) {
+      ++_stats.rejected;
+      return nullptr;
+    }
+    Block* block = _free;
+    _free = block->next;
+    if (++_stats.used > _stats.peak) {
+      _stats.peak = _stats.used;
+    }
+    return block;
+  }
+
+  void release(void* frame) noexcept {
+    Block* block = static_cast<Block*>(frame);
+    block->next = _free;
+    _free = block;
+    --_stats.used;
+  }
+
+  const CoroutinePoolStats& stats() const { return _stats; }
+
+ private:
+  union Block {
+    Block* next;
+    alignas(alignof(std::max_align_t)) unsigned char bytes[CORO_FRAME_BYTES];
+  };
+
+  Block _blocks[CORO_FRAMES];
+  Block* _free = nullptr;
+  CoroutinePoolStats _stats;
+  bool _initialized = false;
+};
+
+inline FramePool& framePool() {
+  static FramePool pool;
+  return pool;
+}
+
+/// Ready-queue entry: a Deadline that knows which coroutine to resume.
+struct WakeNode : Deadline {
+  std::coroutine_handle<> handle;
+};
+
+/// Due time of a wait with no timeout; nextWakeUs() reports it as none.
+static constexpr int64_t WAIT_FOREVER = DEADLINE_NONE - 1;
+
+/// Due time of a task that may resume on the next run.
+static constexpr int64_t RUN_NOW = INT64_MIN;
+
+}  // namespace detail
+
+/// @brief Frame pool usage since start-up.
+inline CoroutinePoolStats coroutinePoolStats() {
+  return detail::framePool().stats();
+}
+
+class Executor;
+
+/**
+ * @brief Return type of a coroutine that an Executor can run.
+ *
+ * Created suspended; spawn() hands it to an executor. Destroying a Task
+ * that was never spawned destroys its frame.
+ */
+class Task {
+ public:
+  struct promise_type {
+    Executor* executor = nullptr;
+    detail::WakeNode node;
+
+    static void* operator new(size_t bytes) noexcept {
+      return detail::framePool().allocate(bytes);
+    }
+    static void operator delete(void* frame) noexcept { detail::framePool().release(frame); }
+
+    static Task get_return_object_on_allocation_failure() noexcept { return Task(); }
+    Task get_return_object() noexcept {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+    inline ~promise_type();
+  };
+
+  Task() noexcept {}
+  Task(Task&& other) noexcept : _handle(other._handle) { other._handle = nullptr; }
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  Task& operator=(Task&&) = delete;
+
+  ~Task() {
+    if (_handle) {
+      _handle.destroy();
+    }
+  }
+
+  /// @brief False if the frame could not be allocated.
+  bool valid() const { return static_cast<bool>(_handle); }
+
+ private:
+  friend class Executor;
+
+  explicit Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+
+  std::coroutine_handle<promise_type> _handle;
+};
+
+/**
+ * @brief Runs Tasks: resumes each one when its wait is over.
+ */
+class Executor {
+ public:
+  Executor() {}
+
+  /// @brief Destroys every task still suspended here.
+  ~Executor() {
+    while (Deadline* first = _queue.peek()) {
+      static_cast<detail::WakeNode*>(first)->handle.destroy();
+    }
+  }
+
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+
+  /**
+   * @brief Attach ready-queue storage. Call before spawning.
+   * @param storage Array of capacity pointers, owned by the caller.
+   * @param capacity Maximum live tasks.
+   * @return OK on success.
+   * @return INVALID_CONFIG if storage is null or capacity is 0.
+   * @return RESOURCE_BUSY if tasks are still live.
+   */
+  Status begin(Deadline** storage, size_t capacity) { return _queue.begin(storage, capacity); }
+
+  /**
+   * @brief Take ownership of a task; it first runs on the next run().
+   * @return OK on success.
+   * @return OUT_OF_MEMORY if the frame pool was empty when the task was
+   *         created, or the executor is full (the task is destroyed).
+   */
+  Status spawn(Task task) {
+    if (!task.valid()) {
+      return Status(Err::OUT_OF_MEMORY, static_cast<int32_t>(CORO_FRAMES),
+                    "Coroutine frame pool exhausted");
+    }
+    if (_live >= _queue.capacity()) {
+      return Status(Err::OUT_OF_MEMORY, static_cast<int32_t>(_queue.capacity()),
+                    "Executor full");
+    }
+    Task::promise_type& promise = task._handle.promise();
+    promise.executor = this;
+    promise.node.handle = task._handle;
+    promise.node.attach(&_queue);
+    (void)promise.node.armAt(detail::RUN_NOW);  // one slot per live task
+    task._handle = nullptr;
+    ++_live;
+    return Ok();
+  }
+
+  /**
+   * @brief Resume every task due at nowUs.
+   * @param nowUs Current time; sleepFor() inside the resumed tasks counts from here.
+   * @return Tasks resumed.
+   *
+   * Bounded by the tasks queued on entry, so tasks that keep waking each
+   * other cannot loop forever. `co_await sleepFor(0_us)` is due 1 us later
+   * and so always waits for a later call.
+   */
+  uint32_t runAt(int64_t nowUs) {
+    _nowUs = nowUs;
+    const size_t limit = _queue.size();
+    uint32_t resumed = 0U;
+    while (resumed < limit) {
+      Deadline* first = _queue.peek();
+      if ((first == nullptr) || (first->dueUs() > nowUs)) {
+        break;
+      }
+      first->cancel();
+      ++resumed;
+      static_cast<detail::WakeNode*>(first)->handle.resume();
+    }
+    return resumed;
+  }
+
+  /// @brief runAt(micros64()).
+  uint32_t run() { return runAt(micros64()); }
+
+  /**
+   * @brief Earliest time a task may resume.
+   * @return A time <= nowUs() if a task is already runnable (just spawned
+   *         or signalled), DEADLINE_NONE if every task waits on a Signal
+   *         without a timeout.
+   */
+  int64_t nextWakeUs() const {
+    const int64_t due = _queue.nextDueUs();
+    if (due >= detail::WAIT_FOREVER) {
+      return DEADLINE_NONE;
+    }
+    return due < _nowUs ? _nowUs : due;
+  }
+
+  /// @brief Time passed to the current (or last) runAt().
+  int64_t nowUs() const { return _nowUs; }
+
+  /// @brief Spawned tasks that have not finished.
+  size_t tasks() const { return _live; }
+
+ private:
+  friend struct Task::promise_type;
+
+  DeadlineRegistry _queue;
+  int64_t _nowUs = 0;
+  size_t _live = 0U;
+};
+
+inline Task::promise_type::~promise_type() {
+  if (executor != nullptr) {
+    --executor->_live;
+  }
+}
+
+/// @brief Awaiter returned by sleepFor() / sleepUntil().
+class SleepAwaiter {
+ public:
+  SleepAwaiter(int64_t us, bool relative) : _us(us), _relative(relative) {}
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<Task::promise_type> handle) const noexcept {
+    Task::promise_type& promise = handle.promise();
+    const int64_t due =
+        _relative ? detail::saturatingAdd(promise.executor->nowUs(), _us) : _us;
+    (void)promise.node.armAt(due);
+  }
+
+  void await_resume() const noexcept {}
+
+ private:
+  int64_t _us;
+  bool _relative;
+};
+
+/**
+ * @brief Suspend for a duration, measured from the start of the current run.
+ *
+ * A periodic loop therefore stays on its grid however long its body takes.
+ * A zero or negative duration yields: the task resumes on a later run
+ * (1 us after the current one at the earliest), after the other due tasks.
+ */
+inline SleepAwaiter sleepFor(std::chrono::microseconds duration) {
+  const int64_t us = static_cast<int64_t>(duration.count());
+  return SleepAwaiter(us < 1 ? 1 : us, true);
+}
+
+/// @brief Suspend until a steady_clock time point.
+inline SleepAwaiter sleepUntil(steady_clock::time_point time) {
+  return SleepAwaiter(steady_clock::to_micros64(time), false);
+}
+
+/**
+ * @brief Auto-reset event with at most one waiting task.
+ *
+ * set() wakes the waiter on the executor's next run; a set() with nobody
+ * waiting is remembered until the next wait consumes it.
+ */
+class Signal {
+ public:
+  Signal() {}
+  Signal(const Signal&) = delete;
+  Signal& operator=(const Signal&) = delete;
+
+  /**
+   * @brief Set and wake the waiting task, if any.
+   * @note Call from the executor's thread, not from an ISR (see file note).
+   */
+  void set() {
+    _set = true;
+    if (_waiter != nullptr) {
+      (void)_waiter->armAt(detail::RUN_NOW);
+    }
+  }
+
+  /// @brief Clear without waking anyone.
+  void reset() { _set = false; }
+
+  /// @brief True if set and not yet consumed.
+  bool isSet() const { return _set; }
+
+  /// @brief Awaiter returned by `co_await signal` and withTimeout().
+  class Awaiter {
+   public:
+    Awaiter(Signal& signal, int64_t timeoutUs) : _signal(&signal), _timeoutUs(timeoutUs) {}
+    Awaiter(const Awaiter&) = delete;
+    Awaiter& operator=(const Awaiter&) = delete;
+
+    /// Clears the waiter if the frame is destroyed while suspended.
+    ~Awaiter() {
+      if ((_node != nullptr) && (_signal->_waiter == _node)) {
+        _signal->_waiter = nullptr;
+      }
+    }
+
+    bool await_ready() const noexcept { return _signal->_set; }
+
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle) noexcept {
+      Task::promise_type& promise = handle.promise();
+      _node = &promise.node;
+      _signal->_waiter = _node;
+      const int64_t due = _timeoutUs < 0
+                              ? detail::WAIT_FOREVER
+                              : detail::saturatingAdd(promise.executor->nowUs(), _timeoutUs);
+      (void)_node->armAt(due);
+    }
+
+    /// @return true if the signal was set, false on timeout.
+    bool await_resume() noexcept {
+      if (_signal->_waiter == _node) {
+        _signal->_waiter = nullptr;
+      }
+      _node = nullptr;
+      const bool set = _signal->_set;
+      _signal->_set = false;
+      return set;
+    }
+
+   private:
+    Signal* _signal;
+    int64_t _timeoutUs;
+    detail::WakeNode* _node = nullptr;
+  };
+
+  /// @brief Wait with no timeout.
+  Awaiter operator co_await() { return Awaiter(*this, -1); }
+
+ private:
+  detail::WakeNode* _waiter = nullptr;
+  bool _set = false;
+};
+
+/**
+ * @brief Wait for a signal, at most timeout after the start of the current run.
+ * @return (from co_await) true if the signal was set, false on timeout.
+ */
+inline Signal::Awaiter withTimeout(Signal& signal, std::chrono::microseconds timeout) {
+  const int64_t us = static_cast<int64_t>(timeout.count());
+  return Signal::Awaiter(signal, us < 0 ? 0 : us);
+}
+
+}  // namespace SystemChrono
+
+#endif  // SYSTEMCHRONO_HAS_COROUTINES
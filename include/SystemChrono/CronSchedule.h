@@ -0,0 +1,156 @@
+/**
+ * @file CronSchedule.h
+ * @brief Cron expressions compiled to bitmasks, with a bit-scan next-fire
+ *        search and a Deadline-backed CronTimer.
+ *
+ * "Every 15 minutes at :07" or "02:30 daily" is about wall time, not
+ * time since boot. CronSchedule parses the usual five cron fields into one
+ * bitmask per field:
+ *
+ *   minute 0-59 (64 bits)   hour 0-23   day 1-31   month 1-12   weekday 0-7
+ *
+ * nextAfter() does not step minute by minute. For each field it finds the
+ * lowest set bit at or above the current value with a count-trailing-zeros
+ * instruction. When a field runs out, the next larger field is advanced
+ * and the smaller ones are reset. The days of a month are a single mask
+ * (day-of-month bits OR the weekday pattern shifted to that month), so a
+ * result needs only a few bit scans and two calendar conversions.
+ *
+ * Field syntax: `*`, `n`, `a-b`, `*` or `a-b` with `/step`, and
+ * comma-separated lists of these; `n/step` means `n-max/step`. Weekday 0
+ * and 7 are both Sunday. As in Vixie cron, when neither day-of-month nor
+ * weekday starts with `*`, a day matching either one fires; otherwise a
+ * day must match both. `@hourly`,
+ * `@daily` (`@midnight`), `@weekly`, `@monthly` and `@yearly`
+ * (`@annually`) are accepted. Names (JAN, MON) and seconds fields are not.
+ *
+ * Wall time is `micros64() + wallOffsetUs` counted from 1970-01-01 00:00.
+ * With the Unix time at boot as the offset the schedule runs in UTC. Add
+ * the UTC offset to run in local time; DST changes are a rebaseAt().
+ *
+ * Usage:
+ * @code
+ * SystemChrono::CronSchedule upload;
+ * upload.parse("7-59/15 * * * *");       // :07, :22, :37, :52
+ * SystemChrono::CronSchedule backup;
+ * backup.parse("30 2 * * *");            // 02:30 every day
+ *
+ * SystemChrono::CronTimer uploadTimer(&timers);  // DeadlineRegistry
+ * uploadTimer.start(upload, unixUsAtBoot);
+ *
+ * void loop() {
+ *   if (uploadTimer.poll()) { uploadLogs(); }
+ *   SystemChrono::sleepUntil(timers.nextWakeUs());
+ * }
+ * @endcode
+ *
+ * @note Not thread-safe. Firings are at the start of the minute.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/DeadlineRegistry.h"
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/**
+ * @brief A parsed cron expression.
+ */
+class CronSchedule {
+ public:
+  CronSchedule();
+
+  /**
+   * @brief Compile an expression.
+   * @param expression Five fields or an @-macro, null-terminated.
+   * @return OK on success.
+   * @return INVALID_CONFIG on a syntax or range error (detail = 1-based
+   *         field), or if the schedule can never fire (e.g. "0 0 31 2 *").
+   *         The previous schedule is kept.
+   */
+  Status parse(const char* expression);
+
+  /**
+   * @brief First firing strictly after a wall time.
+   * @param wallUs Microseconds since 1970-01-01 00:00 in the schedule's zone.
+   * @return Firing time in the same scale, or DEADLINE_NONE if not parsed.
+   */
+  int64_t nextAfter(int64_t wallUs) const;
+
+  /// @brief True after a successful parse().
+  bool valid() const { return _valid; }
+
+ private:
+  uint64_t dayMask(int64_t year, unsigned month) const;
+
+  uint64_t _minutes;  // bits 0..59
+  uint64_t _days;     // bits 1..31
+  uint32_t _hours;    // bits 0..23
+  uint16_t _months;   // bits 1..12
+  uint8_t _weekdays;  // bits 0..6, Sunday = 0
+  bool _dayStar;      // day-of-month field started with '*' (AND, not OR)
+  bool _weekdayStar;  // weekday field started with '*' (AND, not OR)
+  bool _valid;
+};
+
+/**
+ * @brief Deadline that re-arms itself at each firing of a CronSchedule.
+ *
+ * Polled like Interval. A late poll() fires once and re-arms at the next
+ * firing after the poll, so missed firings are skipped, not replayed.
+ */
+class CronTimer {
+ public:
+  /// @param registry Registry to report to; nullptr for none.
+  explicit CronTimer(DeadlineRegistry* registry = nullptr);
+
+  /**
+   * @brief Start at the first firing after nowUs.
+   * @param nowUs Current micros64() time.
+   * @param schedule Parsed schedule (copied).
+   * @param wallOffsetUs Wall time minus micros64().
+   * @return OK on success.
+   * @return INVALID_CONFIG if the schedule is not valid.
+   * @return OUT_OF_MEMORY if the registry is full.
+   */
+  Status startAt(int64_t nowUs, const CronSchedule& schedule, int64_t wallOffsetUs);
+
+  /// @brief startAt(micros64(), schedule, wallOffsetUs).
+  Status start(const CronSchedule& schedule, int64_t wallOffsetUs);
+
+  /**
+   * @brief Change the wall offset (clock sync, DST) and re-arm from nowUs.
+   * @return Same as startAt().
+   */
+  Status rebaseAt(int64_t nowUs, int64_t wallOffsetUs);
+
+  /// @brief Stop and remove from the registry.
+  void stop() { _deadline.cancel(); }
+
+  /// @brief If a firing is due, re-arm at the next one and return true.
+  bool poll();
+
+  /// @brief poll() at a given time.
+  bool pollAt(int64_t nowUs);
+
+  /// @brief True while started.
+  bool running() const { return _deadline.armed(); }
+
+  /// @brief Next firing in micros64() time, or DEADLINE_NONE when stopped.
+  int64_t dueUs() const { return _deadline.dueUs(); }
+
+  /// @brief Wall time minus micros64() in use.
+  int64_t wallOffsetUs() const { return _wallOffsetUs; }
+
+ private:
+  Status arm(int64_t nowUs);
+
+  Deadline _deadline;
+  CronSchedule _schedule;
+  int64_t _wallOffsetUs;
+};
+
+}  // namespace SystemChrono
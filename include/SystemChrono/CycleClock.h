@@ -0,0 +1,115 @@
+/**
+ * @file CycleClock.h
+ * @brief CPU cycle counter with nanosecond conversion calibrated against micros64().
+ *
+ * `esp_timer_get_time()` has 1 us resolution and costs about 1 us on
+ * ESP32-S2. The CPU cycle counter (CCOUNT on Xtensa, `rdtsc` / `cntvct_el0`
+ * on host) resolves a few nanoseconds and costs a handful of cycles.
+ *
+ * cycles64() extends the counter to 64 bits without locks. After
+ * calibrateCycleClock() has measured the counter frequency against
+ * micros64(), nanos64() returns nanoseconds in the micros64() time base.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::calibrateCycleClock();
+ * const int64_t t0 = SystemChrono::nanos64();
+ * // ... short section ...
+ * const int64_t dtNs = SystemChrono::nanos64() - t0;
+ * @endcode
+ *
+ * @note On dual-core ESP32 targets each core has its own, unsynchronized
+ *       CCOUNT. Compare cycles64()/nanos64() values only within a task
+ *       pinned to one core (the Arduino loop task is pinned to core 1).
+ * @note The CCOUNT rate follows the CPU clock. Recalibrate after changing
+ *       the CPU frequency; checkCycleClockDrift() detects when it is needed.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Default calibration window. 1 us of read uncertainty = 50 ppm.
+static constexpr uint32_t CYCLE_CLOCK_DEFAULT_WINDOW_US = 20000U;
+
+/**
+ * @brief Result of a drift check.
+ */
+struct CycleClockDrift {
+  uint64_t calibratedHz = 0U;  ///< Frequency stored by the last calibration
+  uint64_t measuredHz = 0U;    ///< Frequency measured by this check
+  int32_t errorPpm = 0;        ///< (measured - calibrated) / calibrated, in ppm
+  bool drifted = false;        ///< true if |errorPpm| exceeds the tolerance
+};
+
+/**
+ * @brief Check if this platform has a hardware cycle counter.
+ * @return false if cycles64() falls back to micros64() (1 MHz).
+ */
+bool hasCycleCounter();
+
+/**
+ * @brief Read the CPU cycle counter, extended to 64 bits.
+ * @return Monotonic cycle count.
+ *
+ * @note 32-bit counters (ESP32 CCOUNT) are extended lock-free by tracking
+ *       the counter's top bit. cycles64() must run at least once per half
+ *       counter period (2^31 cycles, ~8.9 s at 240 MHz) to catch every wrap.
+ * @note ISR-safe. Concurrent callers on the same core may race on the
+ *       extension word; they always write the same value.
+ */
+uint64_t cycles64();
+
+/**
+ * @brief Get current time in nanoseconds (64-bit).
+ * @return Nanoseconds in the micros64() time base.
+ *
+ * @note Falls back to micros64() * 1000 until calibrateCycleClock() succeeds,
+ *       and while the virtual clock (VirtualClock.h) is enabled.
+ */
+int64_t nanos64();
+
+/**
+ * @brief Measure the cycle counter frequency against micros64().
+ * @param windowUs Busy-wait measurement window in microseconds (1000..1000000).
+ * @return OK on success.
+ * @return INVALID_CONFIG if windowUs is out of range.
+ * @return HARDWARE_FAULT if the counter did not advance.
+ *
+ * Also re-anchors nanos64() to the current micros64() value.
+ *
+ * @note Blocks for about windowUs. Readers of nanos64() are never blocked.
+ */
+Status calibrateCycleClock(uint32_t windowUs = CYCLE_CLOCK_DEFAULT_WINDOW_US);
+
+/**
+ * @brief Get the calibrated cycle counter frequency.
+ * @return Frequency in Hz, or 0 if not calibrated.
+ */
+uint64_t cycleClockHz();
+
+/**
+ * @brief Convert a cycle count to nanoseconds using the calibrated frequency.
+ * @param cycles Cycle count (e.g. a cycles64() difference).
+ * @return Nanoseconds, or 0 if not calibrated.
+ */
+int64_t cyclesToNanos(uint64_t cycles);
+
+/**
+ * @brief Re-measure the frequency and compare it to the calibration.
+ * @param windowUs Measurement window in microseconds (1000..1000000).
+ * @param tolerancePpm Allowed deviation before `drifted` is set.
+ * @param out Receives the measured and calibrated frequencies.
+ * @return OK on success (check `out.drifted`).
+ * @return NOT_INITIALIZED if calibrateCycleClock() has not succeeded.
+ * @return INVALID_CONFIG if windowUs is out of range.
+ *
+ * @note Does not change the calibration. Call calibrateCycleClock() if drifted.
+ */
+Status checkCycleClockDrift(uint32_t windowUs, uint32_t tolerancePpm, CycleClockDrift& out);
+
+}  // namespace SystemChrono
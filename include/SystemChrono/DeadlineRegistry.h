@@ -0,0 +1,245 @@
+/**
+ * @file DeadlineRegistry.h
+ * @brief Registry of armed Deadline / Interval timers with an O(1) next
+ *        wake-up time, for tickless idle and light sleep.
+ *
+ * ElapsedMillis64 timers are polled: nothing knows when the earliest of
+ * them will expire, so the CPU cannot sleep until then. A Deadline or
+ * Interval attached to a DeadlineRegistry reports its due time as it is
+ * armed. The registry keeps armed timers in an indexed binary min-heap:
+ *
+ *   nextWakeUs()              O(1)       earliest due time + slack
+ *   arm / re-arm / cancel     O(log n)   each timer stores its heap slot
+ *
+ * The heap array is supplied by the caller, so there is no allocation and
+ * the capacity is explicit.
+ *
+ * Slack groups wake-ups: with slackUs = S the registry wakes at
+ * `earliest due + S`, and every timer due by then is handled in the same
+ * wake-up. Timers due within S of each other therefore cost one wake-up
+ * instead of several, and each fires at most S late.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::Deadline* slots[16];
+ * SystemChrono::DeadlineRegistry timers;
+ * SystemChrono::DeadlineRegistryConfig cfg;
+ * cfg.slackUs = 2000U;                      // group wake-ups within 2 ms
+ * timers.begin(slots, 16U, cfg);
+ *
+ * SystemChrono::Interval sample(&timers);
+ * SystemChrono::Deadline ackTimeout(&timers);
+ * sample.start(100000);                     // every 100 ms
+ *
+ * void loop() {
+ *   if (sample.poll()) { readSensor(); }
+ *   if (ackTimeout.poll()) { retransmit(); }
+ *   SystemChrono::sleepUntil(timers.nextWakeUs());  // or light sleep
+ * }
+ * @endcode
+ *
+ * @note Not thread-safe: arm, poll and query timers of one registry from
+ *       one task. A registry must outlive the timers attached to it.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief nextWakeUs() / dueUs() when nothing is armed.
+static constexpr int64_t DEADLINE_NONE = INT64_MAX;
+
+class DeadlineRegistry;
+
+/**
+ * @brief One-shot deadline, optionally reported to a DeadlineRegistry.
+ *
+ * Without a registry it is a plain deadline timer. Not copyable: the
+ * registry holds its address.
+ */
+class Deadline {
+ public:
+  /// @param registry Registry to report to; nullptr for none.
+  explicit Deadline(DeadlineRegistry* registry = nullptr);
+
+  /// @brief Cancels, removing the deadline from its registry.
+  ~Deadline();
+
+  Deadline(const Deadline&) = delete;
+  Deadline& operator=(const Deadline&) = delete;
+
+  /**
+   * @brief Arm (or re-arm) to expire at an absolute time.
+   * @param dueUs Expiry in micros64() time.
+   * @return OK on success.
+   * @return OUT_OF_MEMORY if the registry is full; the deadline is left disarmed.
+   */
+  Status armAt(int64_t dueUs);
+
+  /// @brief armAt(micros64() + durationUs).
+  Status armIn(int64_t durationUs);
+
+  /// @brief Disarm and remove from the registry.
+  void cancel();
+
+  /// @brief Disarm and report to another registry (nullptr for none) from now on.
+  void attach(DeadlineRegistry* registry);
+
+  /// @brief True if armed and due at micros64().
+  bool expired() const;
+
+  /// @brief True if armed and due at nowUs.
+  bool expiredAt(int64_t nowUs) const;
+
+  /**
+   * @brief Consume an expiry: if due, disarm and return true (once).
+   * @return true exactly once per expiry.
+   */
+  bool poll();
+
+  /// @brief poll() at a given time.
+  bool pollAt(int64_t nowUs);
+
+  /// @brief True while armed.
+  bool armed() const { return _dueUs != DEADLINE_NONE; }
+
+  /// @brief Expiry time, or DEADLINE_NONE when disarmed.
+  int64_t dueUs() const { return _dueUs; }
+
+  /// @brief Microseconds until expiry at nowUs (0 if due, DEADLINE_NONE if disarmed).
+  int64_t remainingAt(int64_t nowUs) const;
+
+ private:
+  friend class DeadlineRegistry;
+
+  DeadlineRegistry* _registry;
+  int64_t _dueUs;
+  uint32_t _slot;  // heap index while registered
+};
+
+/**
+ * @brief Periodic timer on a fixed grid, reported like a Deadline.
+ *
+ * Expiries stay on the grid `start + k * period`: a late poll() does not
+ * shift later ones, and periods missed entirely are skipped, not replayed.
+ */
+class Interval {
+ public:
+  /// @param registry Registry to report to; nullptr for none.
+  explicit Interval(DeadlineRegistry* registry = nullptr);
+
+  /**
+   * @brief Start with the first expiry one period from now.
+   * @param periodUs Period in microseconds (> 0).
+   * @return OK on success.
+   * @return INVALID_CONFIG if periodUs <= 0.
+   * @return OUT_OF_MEMORY if the registry is full.
+   */
+  Status start(int64_t periodUs);
+
+  /// @brief start() with an explicit current time.
+  Status startAt(int64_t nowUs, int64_t periodUs);
+
+  /// @brief Stop and remove from the registry.
+  void stop() { _deadline.cancel(); }
+
+  /// @brief If a period has elapsed, advance to the next grid point and return true.
+  bool poll();
+
+  /// @brief poll() at a given time.
+  bool pollAt(int64_t nowUs);
+
+  /// @brief True while started.
+  bool running() const { return _deadline.armed(); }
+
+  /// @brief Next expiry, or DEADLINE_NONE when stopped.
+  int64_t dueUs() const { return _deadline.dueUs(); }
+
+  /// @brief Whole periods skipped because poll() came too late.
+  uint32_t missed() const { return _missed; }
+
+ private:
+  Deadline _deadline;
+  int64_t _periodUs;
+  uint32_t _missed;
+};
+
+/**
+ * @brief DeadlineRegistry configuration.
+ */
+struct DeadlineRegistryConfig {
+  uint32_t slackUs = 0U;  ///< Acceptable lateness used to group wake-ups
+};
+
+/**
+ * @brief Indexed min-heap of armed deadlines over caller-provided storage.
+ */
+class DeadlineRegistry {
+ public:
+  DeadlineRegistry();
+
+  /**
+   * @brief Attach heap storage and configure. Call before arming timers.
+   * @param storage Array of capacity pointers, owned by the caller.
+   * @param capacity Maximum simultaneously armed timers (1..2^31).
+   * @param config Slack.
+   * @return OK on success.
+   * @return INVALID_CONFIG if storage is null or capacity is 0 or too large.
+   * @return RESOURCE_BUSY if timers are still armed.
+   */
+  Status begin(Deadline** storage, size_t capacity,
+               const DeadlineRegistryConfig& config = DeadlineRegistryConfig());
+
+  /// @brief Earliest due time, or DEADLINE_NONE. O(1).
+  int64_t nextDueUs() const { return _size > 0U ? _heap[0]->_dueUs : DEADLINE_NONE; }
+
+  /// @brief The deadline due first, or nullptr. O(1).
+  Deadline* peek() const { return _size > 0U ? _heap[0] : nullptr; }
+
+  /**
+   * @brief When to wake: earliest due time plus slack, or DEADLINE_NONE. O(1).
+   *
+   * Every timer due at or before this time should be polled on wake-up.
+   */
+  int64_t nextWakeUs() const;
+
+  /**
+   * @brief How long the CPU may idle from nowUs (0 if something is due).
+   * @return Microseconds until nextWakeUs(), DEADLINE_NONE if nothing is armed.
+   */
+  int64_t idleForAt(int64_t nowUs) const;
+
+  /// @brief idleForAt(micros64()).
+  int64_t idleFor() const;
+
+  /// @brief Armed timers.
+  size_t size() const { return _size; }
+
+  /// @brief Storage capacity.
+  size_t capacity() const { return _capacity; }
+
+  /// @brief Configured slack in microseconds.
+  uint32_t slackUs() const { return _slackUs; }
+
+ private:
+  friend class Deadline;
+
+  bool insert(Deadline* deadline);
+  void remove(Deadline* deadline);
+  void update(Deadline* deadline, int64_t previousDueUs);
+  void siftUp(uint32_t slot);
+  void siftDown(uint32_t slot);
+  void place(uint32_t slot, Deadline* deadline);
+
+  Deadline** _heap;
+  uint32_t _capacity;
+  uint32_t _size;
+  uint32_t _slackUs;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,154 @@
+/**
+ * @file DisciplinedClock.h
+ * @brief Local clock steered to a reference by a PI/FLL loop, without steps.
+ *
+ * Feed (local, reference) timestamp pairs from any source (TimeSyncClient,
+ * GPS PPS, a server's time). The loop estimates the oscillator's frequency
+ * error and slews correctedMicros64() towards the reference by running it
+ * slightly fast or slow. The corrected clock never steps backwards, so
+ * timers built on it keep working across corrections.
+ *
+ *   ACQUIRING  first acquireSamples samples: frequency-locked loop; the
+ *              frequency is measured directly over the span since the
+ *              first sample
+ *   LOCKED     phase-locked PI loop; phase error theta over interval dt:
+ *                frequency += 2^-frequencyShift * theta / dt
+ *                rate       = frequency + 2^-phaseShift * theta / dt
+ *   HOLDOVER   no sample for holdoverAfterUs: the phase slew stops and the
+ *              clock free-runs on the learned frequency
+ *
+ * Rates are Q32 fixed point (no floating point); the read path is one
+ * multiply and shift.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::DisciplinedClock clock;
+ * clock.begin(SystemChrono::DisciplinedClockConfig());
+ * // whenever a reference measurement arrives:
+ * const int64_t local = SystemChrono::micros64();
+ * clock.addSample(local, sync.toServerTime(local));
+ * // anywhere:
+ * int64_t now = clock.correctedMicros64();
+ * @endcode
+ *
+ * @note Not thread-safe: call addSample() and correctedMicros64() from one
+ *       context.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Clock disciplined by DisciplinedClock; returns microseconds.
+using DisciplineClockFn = int64_t (*)();
+
+/**
+ * @brief Loop state.
+ */
+enum class DisciplineState : uint8_t {
+  UNSYNCHRONIZED = 0,  ///< No sample yet: corrected time follows the local clock
+  ACQUIRING,           ///< Frequency acquisition (FLL)
+  LOCKED,              ///< Phase and frequency tracking (PI)
+  HOLDOVER             ///< Samples stopped: free-running on the learned frequency
+};
+
+/**
+ * @brief DisciplinedClock configuration.
+ */
+struct DisciplinedClockConfig {
+  DisciplineClockFn clock = nullptr;     ///< Local clock (nullptr = micros64)
+  uint8_t phaseShift = 1U;               ///< Proportional gain 2^-phaseShift (0..16)
+  uint8_t frequencyShift = 4U;           ///< Integral gain 2^-frequencyShift (0..16)
+  uint8_t acquireSamples = 4U;           ///< Samples in ACQUIRING before LOCKED (>= 1)
+  uint16_t maxFrequencyPpm = 500U;       ///< Frequency correction limit (1..1000)
+  uint16_t maxSlewPpm = 500U;            ///< Phase slew on top of frequency (1..1000)
+  uint32_t holdoverAfterUs = 5000000U;   ///< Enter HOLDOVER after this long without a sample
+};
+
+/**
+ * @brief Loop telemetry snapshot.
+ */
+struct DisciplineTelemetry {
+  DisciplineState state = DisciplineState::UNSYNCHRONIZED;
+  uint32_t samples = 0U;       ///< Samples accepted since begin()
+  int64_t lastOffsetUs = 0;    ///< Reference minus corrected time at the last sample
+  int32_t frequencyPpb = 0;    ///< Learned frequency correction
+  int32_t rateAdjustPpb = 0;   ///< Applied correction including phase slew
+  int64_t sinceSampleUs = 0;   ///< Local time since the last sample
+};
+
+/**
+ * @brief Disciplined, monotonic corrected clock.
+ */
+class DisciplinedClock {
+ public:
+  DisciplinedClock();
+
+  /**
+   * @brief Configure the loop and reset it to UNSYNCHRONIZED.
+   * @param config Clock, gains and limits.
+   * @return OK on success.
+   * @return INVALID_CONFIG if a gain, limit or holdover time is out of range.
+   */
+  Status begin(const DisciplinedClockConfig& config);
+
+  /**
+   * @brief Feed one reference measurement.
+   *
+   * The first sample sets the phase directly when that moves corrected time
+   * forward (or nothing has been read yet); every later correction slews.
+   *
+   * @param localUs Local clock reading at the measurement.
+   * @param referenceUs Reference time at the same instant.
+   * @return OK on success.
+   * @return NOT_INITIALIZED before begin().
+   * @return INVALID_CONFIG if localUs is not after the previous sample or is
+   *         in the future.
+   */
+  Status addSample(int64_t localUs, int64_t referenceUs);
+
+  /**
+   * @brief Current corrected time; never decreases.
+   * @return Corrected microseconds (local clock before begin()).
+   */
+  int64_t correctedMicros64();
+
+  /**
+   * @brief Map a recent local timestamp with the current correction.
+   * @param localUs Local clock reading (within ~1 h of now).
+   * @return Corrected time; not clamped for monotonicity.
+   */
+  int64_t toCorrected(int64_t localUs) const;
+
+  /// @brief Current loop state.
+  DisciplineState state() const;
+
+  /// @brief Snapshot of the loop state for logging or export.
+  DisciplineTelemetry telemetry() const;
+
+ private:
+  int64_t readLocal() const;
+  void reanchor(int64_t localUs);
+  void updateHoldover(int64_t nowUs);
+
+  DisciplinedClockConfig _config;
+  int64_t _anchorLocalUs;
+  int64_t _anchorCorrectedUs;
+  int64_t _rateQ32;
+  int64_t _frequencyQ32;
+  int64_t _lastCorrectedUs;
+  int64_t _firstLocalUs;
+  int64_t _firstReferenceUs;
+  int64_t _lastSampleLocalUs;
+  int64_t _lastOffsetUs;
+  uint32_t _samples;
+  bool _initialized;
+  bool _holdover;
+  bool _read;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,141 @@
+/**
+ * @file EventMerger.h
+ * @brief Streaming k-way merge of timestamp-ordered event sources.
+ *
+ * Each EventSource yields events in non-decreasing micros64() order (an ISR
+ * ring, a sensor task queue, ...). EventMerger keeps the head event of every
+ * source in a tournament (winner) tree, so each emitted event costs
+ * log2(k) comparisons instead of a sort over everything collected.
+ *
+ * A source that is momentarily empty may still deliver an event older than
+ * the current winner. The merger therefore only emits the winner when
+ *
+ *   every source has a head event             (the winner is provably next)
+ *   or  winner.micros <= nowUs - latenessUs   (bounded lateness)
+ *
+ * so events are held for up to latenessUs to absorb producers that publish
+ * late. An event that arrives later than that is still emitted and counted
+ * in late(). Pass nowUs = INT64_MAX to flush everything that is available.
+ *
+ * Memory is fixed: up to EVENT_MERGE_MAX_SOURCES heads held inline.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::EventSource* sources[] = {&imuRing, &gpsRing, &netQueue};
+ * SystemChrono::EventMergerConfig cfg;
+ * cfg.latenessUs = 2000U;
+ * SystemChrono::EventMerger merger;
+ * merger.begin(sources, 3U, cfg);
+ * SystemChrono::TimedEvent ev;
+ * while (merger.pop(SystemChrono::micros64(), ev)) {
+ *   upload(ev);
+ * }
+ * @endcode
+ *
+ * @note Not thread-safe. Sources are polled from the caller's context.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Maximum number of sources one merger accepts.
+static constexpr uint8_t EVENT_MERGE_MAX_SOURCES = 64U;
+
+/**
+ * @brief One timestamped event.
+ */
+struct TimedEvent {
+  int64_t micros = 0;     ///< Event time (micros64() time base)
+  uint32_t source = 0U;   ///< Source index, set by the merger
+  uint32_t payload = 0U;  ///< Application data (value, tag or index into a pool)
+};
+
+/**
+ * @brief Pull interface of one ordered event stream.
+ */
+class EventSource {
+ public:
+  virtual ~EventSource() {}
+
+  /**
+   * @brief Take the next event without blocking.
+   * @param out Receives the event; `source` is overwritten by the merger.
+   * @return true if an event was taken, false if the source is currently empty.
+   */
+  virtual bool next(TimedEvent& out) = 0;
+};
+
+/**
+ * @brief Merger configuration.
+ */
+struct EventMergerConfig {
+  uint32_t latenessUs = 0U;  ///< How long an event may be held for slower sources
+};
+
+/**
+ * @brief K-way timestamp merge over a tournament tree.
+ */
+class EventMerger {
+ public:
+  EventMerger();
+
+  /**
+   * @brief Attach sources and reset the merge.
+   * @param sources Array of count source pointers; must outlive the merger.
+   * @param count Number of sources (1..EVENT_MERGE_MAX_SOURCES).
+   * @param config Lateness bound.
+   * @return OK on success.
+   * @return INVALID_CONFIG if count is out of range or a source is null.
+   */
+  Status begin(EventSource* const* sources, size_t count,
+               const EventMergerConfig& config = EventMergerConfig());
+
+  /**
+   * @brief Emit the oldest event if it is safe to do so.
+   * @param nowUs Current time, for the lateness bound.
+   * @param out Receives the event.
+   * @return true if an event was emitted.
+   */
+  bool pop(int64_t nowUs, TimedEvent& out);
+
+  /**
+   * @brief Emit up to capacity events in order.
+   * @param nowUs Current time, for the lateness bound.
+   * @param out Output array.
+   * @param capacity Size of out.
+   * @return Number of events written.
+   */
+  size_t drain(int64_t nowUs, TimedEvent* out, size_t capacity);
+
+  /// @brief Events emitted since begin().
+  uint64_t merged() const { return _merged; }
+
+  /// @brief Events emitted older than an event already emitted.
+  uint32_t late() const { return _late; }
+
+  /// @brief Number of attached sources.
+  size_t sourceCount() const { return _count; }
+
+ private:
+  void pollEmpty();
+  void update(uint8_t leaf);
+
+  EventSource* _sources[EVENT_MERGE_MAX_SOURCES];
+  TimedEvent _heads[EVENT_MERGE_MAX_SOURCES];
+  uint8_t _tree[2U * EVENT_MERGE_MAX_SOURCES];  // [1] = winner, leaves at [_leaves + i]
+  uint64_t _emptyMask;                          // sources without a head event
+  uint64_t _merged;
+  int64_t _lastUs;
+  uint32_t _late;
+  uint32_t _latenessUs;
+  uint8_t _count;
+  uint8_t _leaves;  // count rounded up to a power of two
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,189 @@
+/**
+ * @file Ewma.h
+ * @brief Time-aware exponential averages for irregular sampling: gauges,
+ *        event rates and Unix-style 1/5/15-minute load averages.
+ *
+ * A fixed-tick EWMA (avg += (x - avg) / N) is only right when updates are
+ * evenly spaced. These types decay by the elapsed time instead:
+ *
+ *   TimeEwma      avg   = x + (avg - x) * exp(-dt / tau)
+ *   DecayingRate  count = count * exp(-dt / tau) + n,  rate = count / tau
+ *
+ * exp(-dt / tau) is evaluated without exp(): dt / tau * log2(e) is formed
+ * with one multiply (Q56), the integer part becomes a shift and the fraction
+ * indexes a 257-entry 2^-f table, interpolated with a curvature correction.
+ * The factor is Q31 with error below 1e-8. State is Q16 fixed point.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::LoadAverage load;
+ * load.begin();
+ * load.sample(runQueueLength());  // whenever convenient, any interval
+ * int64_t oneMinQ16 = load.oneMinute().valueQ16();
+ *
+ * SystemChrono::DecayingRate tx;
+ * tx.begin(10000000U);            // 10 s time constant
+ * tx.add(bytesSent);
+ * uint32_t bytesPerSecond = tx.rate();
+ * @endcode
+ *
+ * @note Not thread-safe. Calls without a time argument read micros64().
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief 1.0 in the Q31 format returned by DecayFactor::at().
+static constexpr uint32_t EWMA_ONE_Q31 = 1UL << 31;
+
+/**
+ * @brief exp(-elapsed / tau) in Q31, table-driven.
+ */
+class DecayFactor {
+ public:
+  DecayFactor() : _log2ePerUsQ56(0U), _zeroAfterUs(0) {}
+
+  /**
+   * @brief Precompute the per-microsecond decay for a time constant.
+   * @param tauUs Time constant in microseconds (> 0).
+   * @return OK, or INVALID_CONFIG if tauUs is 0.
+   */
+  Status begin(uint32_t tauUs);
+
+  /**
+   * @brief Decay over an interval.
+   * @param elapsedUs Interval; <= 0 gives EWMA_ONE_Q31.
+   * @return exp(-elapsedUs / tau) in Q31 (0 beyond ~22 tau).
+   */
+  uint32_t at(int64_t elapsedUs) const;
+
+ private:
+  uint64_t _log2ePerUsQ56;  // log2(e) / tau, Q56
+  int64_t _zeroAfterUs;     // the factor underflows Q31 from here on
+};
+
+/**
+ * @brief EWMA of a sampled value with time constant tau.
+ */
+class TimeEwma {
+ public:
+  TimeEwma();
+
+  /**
+   * @brief Configure and clear; the first sample seeds the average.
+   * @param tauUs Time constant in microseconds (> 0).
+   * @return OK, or INVALID_CONFIG if tauUs is 0.
+   */
+  Status begin(uint32_t tauUs);
+
+  /// @brief Add a sample taken now.
+  void update(int32_t value);
+
+  /**
+   * @brief Add a sample taken at nowUs.
+   * @param nowUs Sample time; not earlier than the previous one.
+   * @param value Sample value.
+   */
+  void updateAt(int64_t nowUs, int32_t value);
+
+  /// @brief Average in Q16 (value * 65536).
+  int64_t valueQ16() const { return _avgQ16; }
+
+  /// @brief Average rounded to the nearest integer.
+  int32_t value() const { return static_cast<int32_t>((_avgQ16 + 0x8000) >> 16); }
+
+  /// @brief True once a sample has been added.
+  bool hasValue() const { return _seeded; }
+
+ private:
+  DecayFactor _decay;
+  int64_t _avgQ16;
+  int64_t _lastUs;
+  bool _seeded;
+  bool _initialized;
+};
+
+/**
+ * @brief Exponentially decayed event rate with time constant tau.
+ *
+ * The decayed count converges to rate * tau. Until about 3 tau have passed
+ * since the first event the rate is divided by the fraction of the window
+ * covered so far (1 - exp(-elapsed / tau)), so it is not biased low.
+ */
+class DecayingRate {
+ public:
+  DecayingRate();
+
+  /**
+   * @brief Configure and clear.
+   * @param tauUs Time constant in microseconds (> 0).
+   * @return OK, or INVALID_CONFIG if tauUs is 0.
+   */
+  Status begin(uint32_t tauUs);
+
+  /// @brief Count events now.
+  void add(uint32_t events = 1U);
+
+  /**
+   * @brief Count events at nowUs.
+   * @param nowUs Event time; not earlier than the previous one.
+   * @param events Number of events.
+   */
+  void addAt(int64_t nowUs, uint32_t events = 1U);
+
+  /// @brief Rate now, in events per perUs (1000000 = per second).
+  uint32_t rate(uint32_t perUs = 1000000U) const;
+
+  /**
+   * @brief Rate at nowUs.
+   * @param nowUs Query time.
+   * @param perUs Rate unit.
+   * @return Events per perUs, rounded; at least tau / 16 is assumed covered.
+   */
+  uint32_t rateAt(int64_t nowUs, uint32_t perUs = 1000000U) const;
+
+ private:
+  DecayFactor _decay;
+  int64_t _countQ16;
+  int64_t _lastUs;
+  int64_t _firstUs;
+  uint32_t _tauUs;
+  bool _seeded;
+  bool _initialized;
+};
+
+/**
+ * @brief Unix-style 1, 5 and 15 minute averages of a sampled value.
+ */
+class LoadAverage {
+ public:
+  /// @brief Configure the three averages; the first sample seeds them.
+  Status begin();
+
+  /// @brief Add a sample taken now.
+  void sample(int32_t value);
+
+  /// @brief Add a sample taken at nowUs.
+  void sampleAt(int64_t nowUs, int32_t value);
+
+  /// @brief Average with a 1 minute time constant.
+  const TimeEwma& oneMinute() const { return _one; }
+
+  /// @brief Average with a 5 minute time constant.
+  const TimeEwma& fiveMinutes() const { return _five; }
+
+  /// @brief Average with a 15 minute time constant.
+  const TimeEwma& fifteenMinutes() const { return _fifteen; }
+
+ private:
+  TimeEwma _one;
+  TimeEwma _five;
+  TimeEwma _fifteen;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,115 @@
+/**
+ * @file FifoTimestamper.h
+ * @brief Per-sample timestamps for batches read from a sensor FIFO.
+ *
+ * A FIFO read only tells when the batch was read, not when each sample was
+ * produced. FifoTimestamper keeps a model of the sensor's sample timeline,
+ * t(k) = t(last) + k * period, and back-fills each batch from it:
+ *
+ *   predicted  timeline extended by `count` samples at the learned period
+ *   measured   the watermark interrupt time for its sample if given,
+ *              otherwise read time minus half a period (the newest sample
+ *              was produced somewhere in the last period)
+ *   corrected  phase += err * 2^-phaseShift; period += err / count * 2^-periodShift
+ *
+ * so the period is learned (the sensor's real output rate is often a few
+ * percent off nominal) and read-time jitter is smoothed out. Gross errors
+ * (FIFO overflow, a stalled reader) resynchronize the timeline.
+ *
+ * Timeline arithmetic is Q12 fixed point (1/4096 us). The back-fill loop is
+ * branch-free and vectorizes.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::FifoTimestamperConfig cfg;
+ * cfg.nominalPeriodNs = 1000000000UL / 833U;  // 833 Hz ODR
+ * SystemChrono::FifoTimestamper stamper;
+ * stamper.begin(cfg);
+ * // after draining n samples:
+ * int64_t stamps[32];
+ * stamper.stamp(SystemChrono::micros64(), n, stamps);
+ * @endcode
+ *
+ * @note Not thread-safe. Samples must not be lost between batches (or the
+ *       next batch resynchronizes).
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/**
+ * @brief Watermark interrupt: when the FIFO reached `index + 1` samples.
+ */
+struct FifoWatermark {
+  int64_t micros = 0;  ///< micros64() captured in the interrupt
+  uint16_t index = 0;  ///< Sample index within the next batch (0 = oldest)
+};
+
+/**
+ * @brief FifoTimestamper configuration.
+ */
+struct FifoTimestamperConfig {
+  uint32_t nominalPeriodNs = 1000000U;    ///< Nominal sample period (> 0)
+  uint32_t maxPeriodErrorPpm = 50000U;    ///< Learned period limit around nominal (<= 500000)
+  uint8_t phaseShift = 3U;                ///< Phase gain 2^-phaseShift (0..16)
+  uint8_t periodShift = 6U;               ///< Period gain 2^-periodShift (0..16)
+  uint8_t resyncPeriods = 8U;             ///< Resynchronize when off by more periods (>= 1)
+  uint32_t watermarkLatencyUs = 0U;       ///< Interrupt latency subtracted from watermarks
+};
+
+/**
+ * @brief FIFO batch timestamper with a learned sample period.
+ */
+class FifoTimestamper {
+ public:
+  FifoTimestamper();
+
+  /**
+   * @brief Configure and reset the timeline.
+   * @param config Nominal period, limits and loop gains.
+   * @return OK on success.
+   * @return INVALID_CONFIG if a field is out of range.
+   */
+  Status begin(const FifoTimestamperConfig& config);
+
+  /**
+   * @brief Timestamp one batch, oldest sample first.
+   * @param readUs micros64() when the FIFO was read.
+   * @param count Samples in the batch.
+   * @param out Receives count timestamps (micros64() time base).
+   * @param marks Optional watermark stamps for samples in this batch.
+   * @param markCount Number of marks.
+   * @return OK on success (count == 0 is a no-op).
+   * @return NOT_INITIALIZED before begin().
+   * @return INVALID_CONFIG if out is null or a mark index is >= count.
+   */
+  Status stamp(int64_t readUs, size_t count, int64_t* out, const FifoWatermark* marks = nullptr,
+               size_t markCount = 0U);
+
+  /// @brief Learned sample period in nanoseconds.
+  int64_t periodNs() const;
+
+  /// @brief Batches stamped since begin().
+  uint32_t batches() const { return _batches; }
+
+  /// @brief Timeline resynchronizations (first batch excluded).
+  uint32_t resyncs() const { return _resyncs; }
+
+ private:
+  FifoTimestamperConfig _config;
+  int64_t _periodQ;
+  int64_t _minPeriodQ;
+  int64_t _maxPeriodQ;
+  int64_t _lastQ;  // time of the newest stamped sample, Q12 us
+  uint32_t _batches;
+  uint32_t _resyncs;
+  bool _initialized;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,155 @@
+/**
+ * @file HybridLogicalClock.h
+ * @brief Hybrid logical clock (HLC) for causal ordering across devices.
+ *
+ * An HLC timestamp pairs a physical time with a logical counter. It stays
+ * within the clock skew of physical time, yet guarantees that if event A
+ * happened before B (locally or through a message) then ts(A) < ts(B),
+ * even when device clocks disagree.
+ *
+ * Encoding: one uint64_t, 52-bit physical microseconds (~142 years) in the
+ * high bits and a 12-bit logical counter in the low bits. Packed values
+ * compare as integers, so the update rules reduce to maxima:
+ *
+ *   send / local:  new = max(last + 1, pt << 12)
+ *   receive:       new = max(last + 1, msg + 1, pt << 12)
+ *
+ * Usage:
+ * @code
+ * SystemChrono::HybridLogicalClock hlc;
+ * SystemChrono::HlcConfig cfg;
+ * cfg.maxOffsetUs = 250000;  // reject peers more than 250 ms ahead
+ * hlc.begin(cfg);
+ * msg.stamp = hlc.send().packed;
+ * // on the peer:
+ * SystemChrono::HlcTimestamp ts;
+ * if (hlc.receive(SystemChrono::HlcTimestamp(msg.stamp), ts).ok()) { ... }
+ * @endcode
+ *
+ * @note All operations are lock-free where 64-bit atomics are (host) and
+ *       O(1); on 32-bit ESP32 the CAS is emulated with a short critical
+ *       section.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Bits of the logical counter.
+static constexpr uint8_t HLC_LOGICAL_BITS = 12U;
+/// @brief Largest logical counter value before it carries into physical time.
+static constexpr uint16_t HLC_MAX_LOGICAL = (1U << HLC_LOGICAL_BITS) - 1U;
+
+/**
+ * @brief Packed HLC timestamp.
+ */
+struct HlcTimestamp {
+  uint64_t packed;  ///< (physicalUs << HLC_LOGICAL_BITS) | logical
+
+  constexpr HlcTimestamp() : packed(0U) {}
+  constexpr explicit HlcTimestamp(uint64_t value) : packed(value) {}
+
+  /// @brief Build from components (logical is masked to 12 bits).
+  static constexpr HlcTimestamp make(int64_t physicalUs, uint16_t logical) {
+    return HlcTimestamp((static_cast<uint64_t>(physicalUs) << HLC_LOGICAL_BITS) |
+                        (logical & HLC_MAX_LOGICAL));
+  }
+
+  /// @brief Physical component in microseconds.
+  constexpr int64_t physicalUs() const { return static_cast<int64_t>(packed >> HLC_LOGICAL_BITS); }
+
+  /// @brief Logical component.
+  constexpr uint16_t logical() const { return static_cast<uint16_t>(packed & HLC_MAX_LOGICAL); }
+
+  constexpr bool operator==(const HlcTimestamp& rhs) const { return packed == rhs.packed; }
+  constexpr bool operator!=(const HlcTimestamp& rhs) const { return packed != rhs.packed; }
+  constexpr bool operator<(const HlcTimestamp& rhs) const { return packed < rhs.packed; }
+  constexpr bool operator<=(const HlcTimestamp& rhs) const { return packed <= rhs.packed; }
+  constexpr bool operator>(const HlcTimestamp& rhs) const { return packed > rhs.packed; }
+  constexpr bool operator>=(const HlcTimestamp& rhs) const { return packed >= rhs.packed; }
+};
+
+/**
+ * @brief HybridLogicalClock configuration.
+ */
+struct HlcConfig {
+  int64_t epochOffsetUs = 0;  ///< Added to micros64() to form physical time (>= 0 result)
+  int64_t maxOffsetUs = 0;    ///< Reject messages this far ahead of physical time (0 = off)
+};
+
+/**
+ * @brief Lock-free hybrid logical clock.
+ */
+class HybridLogicalClock {
+ public:
+  HybridLogicalClock();
+
+  /**
+   * @brief Configure the clock and reset its state.
+   * @param config Epoch offset and max-offset guard.
+   * @return OK on success.
+   * @return INVALID_CONFIG if maxOffsetUs is negative.
+   *
+   * @note Not thread-safe against concurrent updates.
+   */
+  Status begin(const HlcConfig& config);
+
+  /**
+   * @brief Timestamp a local or send event at the current physical time.
+   * @return New timestamp, greater than every earlier one from this clock.
+   */
+  HlcTimestamp send();
+
+  /**
+   * @brief Timestamp a local or send event at a given physical time.
+   * @param physicalUs Physical time (e.g. from a simulated or external clock).
+   * @return New timestamp.
+   */
+  HlcTimestamp sendAt(int64_t physicalUs);
+
+  /**
+   * @brief Merge a received timestamp at the current physical time.
+   * @param message Timestamp carried by the message.
+   * @param out Receives the new local timestamp, greater than `message`.
+   * @return OK on success.
+   * @return INVALID_CONFIG if the message is more than maxOffsetUs ahead of
+   *         physical time (state unchanged; detail = offset in ms, clamped).
+   */
+  Status receive(HlcTimestamp message, HlcTimestamp& out);
+
+  /**
+   * @brief Merge a received timestamp at a given physical time.
+   * @param message Timestamp carried by the message.
+   * @param physicalUs Physical time of the receive event.
+   * @param out Receives the new local timestamp.
+   * @return Same as receive().
+   */
+  Status receiveAt(HlcTimestamp message, int64_t physicalUs, HlcTimestamp& out);
+
+  /**
+   * @brief Last timestamp issued (without advancing).
+   * @return Last timestamp, or 0 if none.
+   */
+  HlcTimestamp last() const;
+
+  /**
+   * @brief Current physical time used by send()/receive().
+   * @return micros64() + epochOffsetUs.
+   */
+  int64_t physicalNowUs() const;
+
+ private:
+  HlcTimestamp update(uint64_t floor);
+
+  std::atomic<uint64_t> _last;
+  int64_t _epochOffsetUs;
+  int64_t _maxOffsetUs;
+};
+
+}  // namespace SystemChrono
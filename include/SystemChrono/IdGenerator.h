@@ -0,0 +1,147 @@
+/**
+ * @file IdGenerator.h
+ * @brief Snowflake-style 64-bit time-sortable unique IDs.
+ *
+ * Layout (most significant first):
+ *
+ *   | 0 | 41-bit ms since epoch | 10-bit node | 12-bit sequence |
+ *
+ * IDs from one generator are strictly increasing; IDs from different nodes
+ * sort by time to the millisecond. 41 bits cover about 69 years after the
+ * epoch; a node issues up to 4096 IDs per millisecond.
+ *
+ * The time is millis64() + time base - epoch. The time base maps boot time
+ * to a wall-clock scale (e.g. Unix ms at boot once SNTP is synced) and can
+ * be re-based at any time; if that moves time backwards, the generator
+ * keeps counting from the last issued time, so IDs stay monotonic. Out of
+ * sequence numbers, it borrows later milliseconds, but only up to where the
+ * previous time base would be now; beyond that the exhaustion policy
+ * applies, so a burst cannot push ID times into the future.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::IdGenerator ids;
+ * SystemChrono::IdGeneratorConfig cfg;
+ * cfg.epochMs = 1704067200000LL;  // 2024-01-01 in Unix ms
+ * cfg.nodeId = 7;
+ * ids.begin(cfg);
+ * ids.rebase(unixMsNow - SystemChrono::millis64());
+ * uint64_t id = 0;
+ * if (ids.next(id).ok()) { publish(id); }
+ * @endcode
+ *
+ * @note next() is lock-free where 64-bit atomics are (host); on 32-bit
+ *       ESP32 the CAS is emulated with a short critical section.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Bits of the millisecond timestamp field.
+static constexpr uint8_t ID_TIME_BITS = 41U;
+/// @brief Bits of the node field.
+static constexpr uint8_t ID_NODE_BITS = 10U;
+/// @brief Bits of the per-millisecond sequence field.
+static constexpr uint8_t ID_SEQUENCE_BITS = 12U;
+/// @brief Largest node ID (1023).
+static constexpr uint16_t ID_MAX_NODE = (1U << ID_NODE_BITS) - 1U;
+/// @brief Largest sequence number per millisecond (4095).
+static constexpr uint16_t ID_MAX_SEQUENCE = (1U << ID_SEQUENCE_BITS) - 1U;
+
+/**
+ * @brief What next() does when a millisecond's sequence is exhausted.
+ */
+enum class IdExhaustPolicy : uint8_t {
+  SPIN,  ///< Busy-wait for the next millisecond (at most ~1 ms)
+  FAIL   ///< Return RESOURCE_BUSY; the caller backs off and retries
+};
+
+/**
+ * @brief IdGenerator configuration.
+ */
+struct IdGeneratorConfig {
+  int64_t epochMs = 0;                             ///< Custom epoch, in time-base ms
+  int64_t timeBaseMs = 0;                          ///< Initial offset added to millis64()
+  uint16_t nodeId = 0U;                            ///< 0..ID_MAX_NODE
+  IdExhaustPolicy policy = IdExhaustPolicy::SPIN;  ///< Sequence exhaustion policy
+};
+
+/**
+ * @brief Lock-free Snowflake ID generator.
+ */
+class IdGenerator {
+ public:
+  IdGenerator();
+
+  /**
+   * @brief Configure the generator and reset its state.
+   * @param config Epoch, time base, node ID and exhaustion policy.
+   * @return OK on success.
+   * @return INVALID_CONFIG if nodeId > ID_MAX_NODE.
+   *
+   * @note Not thread-safe against concurrent next() calls.
+   */
+  Status begin(const IdGeneratorConfig& config);
+
+  /**
+   * @brief Generate the next ID.
+   * @param outId Receives the ID on success.
+   * @return OK on success.
+   * @return NOT_INITIALIZED if begin() has not succeeded.
+   * @return RESOURCE_BUSY if the sequence is exhausted and the policy is FAIL.
+   * @return INVALID_CONFIG if the time is before the epoch or past 41 bits
+   *         (detail = 0 before, 1 past).
+   *
+   * @note Thread-safe. With SPIN, blocks at most until the next millisecond
+   *       (never returns while the virtual clock is frozen and exhausted).
+   */
+  Status next(uint64_t& outId);
+
+  /**
+   * @brief Change the offset added to millis64().
+   * @param timeBaseMs New time base (e.g. Unix ms at boot).
+   *
+   * @note Thread-safe. Moving time backwards never makes IDs decrease.
+   */
+  void rebase(int64_t timeBaseMs);
+
+  /// @brief Current time base.
+  int64_t timeBase() const;
+
+  /// @brief Configured node ID.
+  uint16_t nodeId() const { return _nodeId; }
+
+  /// @brief Absolute time of an ID, in time-base ms (requires the same epoch).
+  static int64_t timestampMs(uint64_t id, int64_t epochMs) {
+    return static_cast<int64_t>(id >> (ID_NODE_BITS + ID_SEQUENCE_BITS)) + epochMs;
+  }
+
+  /// @brief Node field of an ID.
+  static uint16_t nodeOf(uint64_t id) {
+    return static_cast<uint16_t>((id >> ID_SEQUENCE_BITS) & ID_MAX_NODE);
+  }
+
+  /// @brief Sequence field of an ID.
+  static uint16_t sequenceOf(uint64_t id) {
+    return static_cast<uint16_t>(id & ID_MAX_SEQUENCE);
+  }
+
+ private:
+  // Last issued (time << ID_SEQUENCE_BITS) | sequence.
+  std::atomic<uint64_t> _state;
+  std::atomic<int64_t> _timeBaseMs;
+  std::atomic<int64_t> _leadMs;  // how far back re-bases moved time (>= 0)
+  int64_t _epochMs;
+  uint16_t _nodeId;
+  IdExhaustPolicy _policy;
+  bool _initialized;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,147 @@
+/**
+ * @file PreciseSleep.h
+ * @brief sleepUntil(): hybrid OS-sleep / yield / spin wait on micros64().
+ *
+ * delay() and vTaskDelay() wake on a scheduler tick, so they overshoot a
+ * deadline by up to a tick; spinning on microsSince() is precise but burns
+ * the CPU for the whole wait. sleepUntil() does both in three phases:
+ *
+ *  1. OS sleep (nanosleep on hosts, vTaskDelay on ESP32/FreeRTOS, delay()
+ *     elsewhere) until `sleep guard + spin guard` before the deadline;
+ *  2. yield until `spin guard` before the deadline;
+ *  3. spin on micros64() for the last few microseconds.
+ *
+ * The guards are learned, not configured. After every OS sleep the
+ * oversleep (actual minus requested) feeds a mean/deviation estimator as in
+ * TCP's retransmit timer, and the sleep guard is mean + 4 deviations; the
+ * cost of one yield is tracked the same way for the spin guard. A quiet
+ * system therefore converges to small guards (little CPU), a noisy one to
+ * wider guards (still on time). On FreeRTOS vTaskDelay() never oversleeps a
+ * whole tick, so the sleep guard learns just the wake-up latency.
+ *
+ * Usage:
+ * @code
+ * int64_t next = SystemChrono::micros64();
+ * for (;;) {
+ *   next += 2500;                        // 400 Hz control loop
+ *   SystemChrono::sleepUntil(next);      // typically a few us late
+ *   runControlStep();
+ * }
+ * @endcode
+ *
+ * @note Sleeper methods may be called from several threads at once; the
+ *       learned guards are relaxed atomics, so a concurrent update may be
+ *       lost, which only slows learning. begin() is not thread-safe.
+ * @note With the virtual clock installed, the OS-sleep phase sleeps for
+ *       virtual durations and the spin phase waits for virtual time. For
+ *       deterministic tests, install SleeperConfig hooks instead.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Clock a Sleeper waits on; returns microseconds.
+using SleeperClockFn = int64_t (*)();
+
+/// @brief OS sleep of at most budgetUs; returns the duration asked of the OS.
+using SleeperSleepFn = int64_t (*)(int64_t budgetUs);
+
+/// @brief Hand the CPU to another ready task.
+using SleeperYieldFn = void (*)();
+
+/**
+ * @brief Sleeper configuration. The defaults suit both hosts and ESP32.
+ *
+ * The hooks replace the clock and the OS calls, e.g. with a simulated
+ * scheduler in tests; a hook clock must advance while it is read.
+ */
+struct SleeperConfig {
+  uint32_t initialGuardUs = 2000U;   ///< Sleep guard before anything is learned
+  uint32_t maxGuardUs = 20000U;      ///< Upper bound on the learned sleep guard
+  uint32_t minSpinUs = 5U;           ///< Always spin at least this long
+  SleeperClockFn clock = nullptr;    ///< Clock (nullptr = micros64)
+  SleeperSleepFn osSleep = nullptr;  ///< OS sleep (nullptr = nanosleep/vTaskDelay/delay)
+  SleeperYieldFn osYield = nullptr;  ///< Yield (nullptr = sched_yield/taskYIELD/yield)
+};
+
+/**
+ * @brief Where one sleepUntil() call spent its time.
+ *
+ * sleptUs is CPU handed to other tasks; yieldedUs and spunUs are (mostly)
+ * CPU burned by the caller.
+ */
+struct SleepReport {
+  int64_t lateUs = 0;     ///< Wake-up time minus deadline (>= 0)
+  int64_t sleptUs = 0;    ///< Time in OS sleep
+  int64_t yieldedUs = 0;  ///< Time in the yield phase
+  int64_t spunUs = 0;     ///< Time in the spin phase
+  uint16_t osSleeps = 0;  ///< OS sleep calls
+};
+
+/**
+ * @brief Hybrid sleep with learned guard bands.
+ */
+class Sleeper {
+ public:
+  /// @brief Ready to use with SleeperConfig() defaults.
+  Sleeper();
+
+  /**
+   * @brief Reconfigure and forget what was learned.
+   * @param config Initial and maximum guard, minimum spin.
+   * @return OK on success.
+   * @return INVALID_CONFIG if maxGuardUs is 0 or above 1 s, initialGuardUs
+   *         exceeds maxGuardUs, or minSpinUs exceeds 1 ms.
+   */
+  Status begin(const SleeperConfig& config);
+
+  /**
+   * @brief Wait until the clock reaches deadlineUs.
+   * @param deadlineUs Absolute deadline in micros64() (or hook clock) time.
+   * @param report Optional phase breakdown of this call.
+   * @return Microseconds late (0 when woken exactly on time). A deadline
+   *         in the past returns at once (saturated, e.g. for INT64_MIN).
+   */
+  int64_t sleepUntil(int64_t deadlineUs, SleepReport* report = nullptr);
+
+  /// @brief sleepUntil(now + durationUs), saturated.
+  int64_t sleepFor(int64_t durationUs, SleepReport* report = nullptr);
+
+  /// @brief Current learned OS-sleep guard in microseconds.
+  uint32_t sleepGuardUs() const;
+
+  /// @brief Current learned spin guard in microseconds (>= minSpinUs).
+  uint32_t spinGuardUs() const;
+
+ private:
+  // Estimators in Q4 microseconds: mean += (x - mean) / 8,
+  // dev += (|x - mean| - dev) / 4.
+  std::atomic<int32_t> _sleepMeanQ4;
+  std::atomic<int32_t> _sleepDevQ4;
+  std::atomic<int32_t> _yieldMeanQ4;
+  std::atomic<int32_t> _yieldDevQ4;
+  int32_t _maxGuardUs;
+  int32_t _minSpinUs;
+  SleeperClockFn _clock;
+  SleeperSleepFn _osSleep;
+  SleeperYieldFn _osYield;
+};
+
+/**
+ * @brief Wait until deadlineUs on the process-wide Sleeper.
+ * @param deadlineUs Absolute deadline in micros64() time.
+ * @return Microseconds late.
+ */
+int64_t sleepUntil(int64_t deadlineUs);
+
+/// @brief The process-wide Sleeper used by sleepUntil().
+Sleeper& defaultSleeper();
+
+}  // namespace SystemChrono
@@ -0,0 +1,109 @@
+/**
+ * @file RateLimiter.h
+ * @brief GCRA (virtual scheduling) rate limiter on one atomic 64-bit state.
+ *
+ * The limiter keeps a theoretical arrival time (TAT): when the next request
+ * would be due if traffic ran exactly at the configured rate. With emission
+ * interval T = periodUs / rate and burst B, a request for n tokens at `now`
+ * is granted when
+ *
+ *   max(TAT, now) + n * T - now <= B * T
+ *
+ * and TAT advances by n * T. Unused capacity accumulates up to B tokens, so
+ * traffic is smoothed to the rate with at most B back-to-back grants. There
+ * is no "reset on fire" window, so no double burst at window edges.
+ *
+ * A denied request returns how long to wait until it would be granted. TAT
+ * is kept in nanoseconds so high rates do not accumulate rounding error.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::RateLimiterConfig cfg;
+ * cfg.rate = 5U;          // 5 publishes per second
+ * cfg.burst = 10U;        // up to 10 back to back after a quiet period
+ * SystemChrono::RateLimiter mqtt;
+ * mqtt.begin(cfg);
+ * if (mqtt.tryAcquire() == 0) { publish(); }
+ * @endcode
+ *
+ * @note tryAcquire() is thread-safe and lock-free where 64-bit atomics are
+ *       (host); on 32-bit ESP32 the CAS is emulated with a short critical
+ *       section. begin() and reset() are not thread-safe.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief tryAcquire() result when the request can never be granted.
+static constexpr int64_t RATE_LIMIT_NEVER = INT64_MAX;
+
+/**
+ * @brief RateLimiter configuration: `rate` tokens per `periodUs`.
+ */
+struct RateLimiterConfig {
+  uint32_t rate = 10U;           ///< Tokens per period (> 0)
+  uint32_t periodUs = 1000000U;  ///< Period in microseconds (> 0)
+  uint32_t burst = 1U;           ///< Tokens grantable back to back (>= 1)
+};
+
+/**
+ * @brief Lock-free GCRA rate limiter.
+ */
+class RateLimiter {
+ public:
+  RateLimiter();
+
+  /**
+   * @brief Configure and reset to full burst capacity.
+   * @param config Rate, period and burst.
+   * @return OK on success.
+   * @return INVALID_CONFIG if a field is zero, the interval is below 1 ns,
+   *         or burst * interval exceeds 2^62 ns.
+   */
+  Status begin(const RateLimiterConfig& config);
+
+  /// @brief Restore full burst capacity.
+  void reset();
+
+  /**
+   * @brief Try to take tokens now.
+   * @param tokens Tokens to take.
+   * @return 0 if granted; otherwise microseconds until the request would be
+   *         granted (rounded up); RATE_LIMIT_NEVER if tokens > burst or the
+   *         limiter is not initialized.
+   */
+  int64_t tryAcquire(uint32_t tokens = 1U);
+
+  /**
+   * @brief Try to take tokens at a given time.
+   * @param nowUs Current time in microseconds.
+   * @param tokens Tokens to take.
+   * @return As tryAcquire().
+   */
+  int64_t tryAcquireAt(int64_t nowUs, uint32_t tokens = 1U);
+
+  /// @brief Tokens that could be taken now without waiting.
+  uint32_t available() const;
+
+  /// @brief Tokens that could be taken at nowUs without waiting.
+  uint32_t availableAt(int64_t nowUs) const;
+
+  /// @brief Emission interval (periodUs / rate) in nanoseconds.
+  int64_t intervalNs() const { return _intervalNs; }
+
+ private:
+  std::atomic<int64_t> _tatNs;
+  int64_t _intervalNs;
+  int64_t _limitNs;  // burst * interval
+  uint32_t _burst;
+  bool _initialized;
+};
+
+}  // namespace SystemChrono
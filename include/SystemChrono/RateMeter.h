@@ -0,0 +1,111 @@
+/**
+ * @file RateMeter.h
+ * @brief Sliding-window event rate over a fixed ring of time buckets.
+ *
+ * The window is split into `buckets` slots of windowUs / buckets each. Events
+ * are added to the slot for the current time; a running total is kept, so
+ * count() is O(1). The ring is advanced lazily by whichever call comes next
+ * (record or query): slots that fell out of the window are subtracted and
+ * cleared, at most `buckets` of them however long the meter was idle.
+ *
+ * The window therefore slides in steps of one slot: count() covers between
+ * (buckets - 1) and buckets slots. rate() divides by the time actually
+ * covered, so it is unbiased during start-up and at any point within a slot.
+ * More buckets give finer resolution for 4 bytes each.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::RateMeter rxRate;
+ * SystemChrono::RateMeterConfig cfg;   // 10 s window, 10 buckets
+ * rxRate.begin(cfg);
+ * rxRate.record();                     // per message
+ * uint32_t perSecond = rxRate.rate();  // over the last ~10 s
+ * @endcode
+ *
+ * @note Not thread-safe. record() and the queries without a time argument
+ *       read micros64(); the *At() variants take the time explicitly.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Maximum buckets per meter.
+static constexpr uint8_t RATE_METER_MAX_BUCKETS = 64U;
+
+/**
+ * @brief RateMeter configuration.
+ */
+struct RateMeterConfig {
+  uint32_t windowUs = 10000000U;  ///< Window length (a multiple of buckets)
+  uint8_t buckets = 10U;          ///< Resolution (1..RATE_METER_MAX_BUCKETS)
+};
+
+/**
+ * @brief Events per sliding window, O(1) per update and query.
+ */
+class RateMeter {
+ public:
+  RateMeter();
+
+  /**
+   * @brief Configure and clear.
+   * @param config Window length and bucket count.
+   * @return OK on success.
+   * @return INVALID_CONFIG if buckets is out of range or does not divide windowUs.
+   */
+  Status begin(const RateMeterConfig& config);
+
+  /// @brief Forget all events; the window restarts at the next call.
+  void reset();
+
+  /// @brief Record events now.
+  void record(uint32_t events = 1U);
+
+  /**
+   * @brief Record events at a given time.
+   * @param nowUs Current time; earlier than the newest bucket counts into it.
+   * @param events Number of events.
+   */
+  void recordAt(int64_t nowUs, uint32_t events = 1U);
+
+  /// @brief Events in the window ending now.
+  uint32_t count();
+
+  /// @brief Events in the window ending at nowUs.
+  uint32_t countAt(int64_t nowUs);
+
+  /**
+   * @brief Rate over the window ending now.
+   * @param perUs Rate unit (1000000 = per second, 60000000 = per minute).
+   * @return Events per perUs, rounded.
+   */
+  uint32_t rate(uint32_t perUs = 1000000U);
+
+  /**
+   * @brief Rate over the window ending at nowUs.
+   * @param nowUs Current time.
+   * @param perUs Rate unit.
+   * @return Events per perUs, rounded; at least one bucket is assumed covered.
+   */
+  uint32_t rateAt(int64_t nowUs, uint32_t perUs = 1000000U);
+
+ private:
+  void advance(int64_t nowUs);
+
+  uint32_t _slots[RATE_METER_MAX_BUCKETS];
+  int64_t _headStartUs;   // start of the newest slot
+  int64_t _firstUs;       // first event or query since reset
+  int64_t _bucketUs;
+  uint32_t _total;
+  uint8_t _buckets;
+  uint8_t _head;
+  bool _started;
+  bool _initialized;
+};
+
+}  // namespace SystemChrono
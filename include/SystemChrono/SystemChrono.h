@@ -8,6 +8,12 @@
  *
  * Uses `esp_timer_get_time()` on ESP32 for true 64-bit monotonic time.
  * Falls back to wrap-tracked `micros()` on other Arduino platforms.
+ * Host builds (Linux/macOS) use `clock_gettime(CLOCK_MONOTONIC)` and the
+ * `String` shim in extras/host/Arduino.h.
+ *
+ * Where `<chrono>` is available (SYSTEMCHRONO_HAS_CHRONO), Stopwatch, the
+ * Elapsed*64 timers and the formatters also take and return
+ * `std::chrono::duration` values; see Chrono.h for `steady_clock`.
  *
  * @note This library is header-only for the API declarations. Implementation
  *       is in SystemChrono.cpp (compiled as part of the library).
@@ -20,6 +26,21 @@
 
 #include "SystemChrono/Status.h"
 
+#if !defined(SYSTEMCHRONO_HAS_CHRONO)
+  #if defined(__has_include)
+    #if __has_include(<chrono>)
+      #define SYSTEMCHRONO_HAS_CHRONO 1
+    #endif
+  #endif
+#endif
+#if !defined(SYSTEMCHRONO_HAS_CHRONO)
+  #define SYSTEMCHRONO_HAS_CHRONO 0
+#endif
+
+#if SYSTEMCHRONO_HAS_CHRONO
+  #include <chrono>
+#endif
+
 namespace SystemChrono {
 
 // ===========================================================================
@@ -32,7 +53,10 @@ namespace SystemChrono {
  *
  * @note On ESP32, uses `esp_timer_get_time()` for true 64-bit precision.
  * @note On other Arduino platforms, extends 32-bit `micros()` via wrap tracking.
- * @note Thread-safe on ESP32. On other platforms, uses interrupt-disable briefly.
+ * @note On host, reads `CLOCK_MONOTONIC` (or `CLOCK_MONOTONIC_RAW` when built
+ *       with SYSTEMCHRONO_HOST_CLOCK_MONOTONIC_RAW).
+ * @note Thread-safe on ESP32 and host. On other platforms, uses interrupt-disable briefly.
+ * @note Returns simulated time while the virtual clock (VirtualClock.h) is enabled.
  */
 int64_t micros64();
 
@@ -131,6 +155,29 @@ String formatTime(int64_t microsSinceBoot);
  */
 String formatNow();
 
+#if SYSTEMCHRONO_HAS_CHRONO
+/**
+ * @brief Format a duration as HH:MM:SS.mmm into caller-provided buffer.
+ * @param time Duration; any type losslessly convertible to microseconds.
+ * @param out Output buffer for null-terminated formatted string.
+ * @param outLen Size of output buffer in bytes.
+ * @return Same as formatTimeTo(int64_t, char*, size_t).
+ */
+inline Status formatTimeTo(std::chrono::microseconds time, char* out, size_t outLen) {
+  return formatTimeTo(static_cast<int64_t>(time.count()), out, outLen);
+}
+
+/**
+ * @brief Format a duration as HH:MM:SS.mmm string.
+ * @param time Duration; any type losslessly convertible to microseconds.
+ * @return Formatted string.
+ * @note Returns String object (heap allocation possible).
+ */
+inline String formatTime(std::chrono::microseconds time) {
+  return formatTime(static_cast<int64_t>(time.count()));
+}
+#endif
+
 // ===========================================================================
 // Stopwatch Class
 // ===========================================================================
@@ -207,10 +254,37 @@ class Stopwatch {
    */
   bool isRunning() const;
 
+  /**
+   * @brief Subtract the calibrated clock-read overhead from elapsed values.
+   * @param enabled true to subtract one read cost per start/resume interval.
+   *
+   * @note Has no effect until calibrateClockOverhead() or
+   *       setClockCalibration() has stored a calibration.
+   */
+  void setOverheadCompensation(bool enabled);
+
+  /**
+   * @brief Check if clock-read overhead compensation is enabled.
+   * @return true if enabled.
+   */
+  bool isOverheadCompensated() const;
+
+#if SYSTEMCHRONO_HAS_CHRONO
+  /**
+   * @brief Get total elapsed time as a typed duration.
+   * @return Same value as elapsedMicros().
+   */
+  std::chrono::microseconds elapsed() const {
+    return std::chrono::microseconds(elapsedMicros());
+  }
+#endif
+
  private:
   int64_t _startUs;
   int64_t _totalUs;
+  uint32_t _intervals;
   bool _running;
+  bool _compensated;
 };
 
 // ===========================================================================
@@ -253,6 +327,35 @@ class ElapsedMicros64 {
   ElapsedMicros64 operator-(int64_t valUs) const;
   ElapsedMicros64 operator+(int64_t valUs) const;
 
+#if SYSTEMCHRONO_HAS_CHRONO
+  // std::chrono overloads. Coarser durations convert implicitly (no runtime
+  // division); finer ones need an explicit duration_cast.
+  explicit ElapsedMicros64(std::chrono::microseconds val)
+      : ElapsedMicros64(static_cast<int64_t>(val.count())) {}
+  ElapsedMicros64& operator=(std::chrono::microseconds val) {
+    return *this = static_cast<int64_t>(val.count());
+  }
+  ElapsedMicros64& operator-=(std::chrono::microseconds val) {
+    return *this -= static_cast<int64_t>(val.count());
+  }
+  ElapsedMicros64& operator+=(std::chrono::microseconds val) {
+    return *this += static_cast<int64_t>(val.count());
+  }
+
+  /// @brief Elapsed time as a typed duration.
+  std::chrono::microseconds elapsed() const {
+    return std::chrono::microseconds(static_cast<int64_t>(*this));
+  }
+#endif
+
+  /**
+   * @brief Elapsed microseconds minus one calibrated clock-read cost.
+   * @return Compensated elapsed time, never below 0.
+   *
+   * @note Equals the plain value until a calibration is stored.
+   */
+  int64_t compensated() const;
+
  private:
   int64_t _us;
 };
@@ -289,6 +392,27 @@ class ElapsedMillis64 {
   ElapsedMillis64 operator-(int64_t valMs) const;
   ElapsedMillis64 operator+(int64_t valMs) const;
 
+#if SYSTEMCHRONO_HAS_CHRONO
+  // std::chrono overloads. Coarser durations convert implicitly (no runtime
+  // division); finer ones need an explicit duration_cast.
+  explicit ElapsedMillis64(std::chrono::milliseconds val)
+      : ElapsedMillis64(static_cast<int64_t>(val.count())) {}
+  ElapsedMillis64& operator=(std::chrono::milliseconds val) {
+    return *this = static_cast<int64_t>(val.count());
+  }
+  ElapsedMillis64& operator-=(std::chrono::milliseconds val) {
+    return *this -= static_cast<int64_t>(val.count());
+  }
+  ElapsedMillis64& operator+=(std::chrono::milliseconds val) {
+    return *this += static_cast<int64_t>(val.count());
+  }
+
+  /// @brief Elapsed time as a typed duration.
+  std::chrono::milliseconds elapsed() const {
+    return std::chrono::milliseconds(static_cast<int64_t>(*this));
+  }
+#endif
+
  private:
   int64_t _us;
 };
@@ -322,6 +446,27 @@ class ElapsedSeconds64 {
   ElapsedSeconds64 operator-(int64_t valS) const;
   ElapsedSeconds64 operator+(int64_t valS) const;
 
+#if SYSTEMCHRONO_HAS_CHRONO
+  // std::chrono overloads. Coarser durations convert implicitly (no runtime
+  // division); finer ones need an explicit duration_cast.
+  explicit ElapsedSeconds64(std::chrono::seconds val)
+      : ElapsedSeconds64(static_cast<int64_t>(val.count())) {}
+  ElapsedSeconds64& operator=(std::chrono::seconds val) {
+    return *this = static_cast<int64_t>(val.count());
+  }
+  ElapsedSeconds64& operator-=(std::chrono::seconds val) {
+    return *this -= static_cast<int64_t>(val.count());
+  }
+  ElapsedSeconds64& operator+=(std::chrono::seconds val) {
+    return *this += static_cast<int64_t>(val.count());
+  }
+
+  /// @brief Elapsed time as a typed duration.
+  std::chrono::seconds elapsed() const {
+    return std::chrono::seconds(static_cast<int64_t>(*this));
+  }
+#endif
+
  private:
   int64_t _us;
 };
@@ -0,0 +1,159 @@
+/**
+ * @file TickCorrelator.h
+ * @brief Streaming least-squares map from a device tick counter to micros64().
+ *
+ * Sensors timestamp data with their own counters (IMU FIFO ticks, ADC DMA
+ * sample indices, a 32.768 kHz RTC). Feed (ticks, micros) pairs as they are
+ * observed (e.g. ticks read in the data-ready ISR stamped with micros64())
+ * and the correlator fits
+ *
+ *   micros = a * ticks + b
+ *
+ * by exponentially weighted least squares (fixed memory, O(1) per sample).
+ * Samples whose residual exceeds outlierFactor times the fit's RMS
+ * residual (plus outlierFloorUs) are rejected; after maxRejects
+ * consecutive rejections the fit restarts, which handles counter resets.
+ * 32-bit tick wrap is tracked internally.
+ *
+ * The fit runs in double on each sample. Conversion uses a fixed-point
+ * snapshot of the fit (two 32x32->64 multiplies per tick) and is valid for
+ * ticks within +/-2^31 of the latest sample; the batch conversion is a
+ * straight-line loop the compiler vectorizes.
+ *
+ * Usage:
+ * @code
+ * SystemChrono::TickCorrelator imuTime;
+ * imuTime.begin(SystemChrono::TickCorrelatorConfig());
+ * // data-ready ISR / poll:
+ * imuTime.addSample(imu.readTimestampTicks(), SystemChrono::micros64());
+ * // FIFO drain:
+ * imuTime.toMicros(fifoTicks, fifoMicros, count);
+ * @endcode
+ *
+ * @note Not thread-safe: update and convert from one context, or guard.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/**
+ * @brief TickCorrelator configuration.
+ */
+struct TickCorrelatorConfig {
+  uint8_t weightShift = 6U;       ///< Forgetting factor 1 - 2^-weightShift (1..16; 6 ~ 64 samples)
+  uint8_t minSamples = 4U;        ///< Samples before isValid() and outlier checks (>= 2)
+  uint8_t outlierFactor = 4U;     ///< Reject |residual| > factor * RMS residual + floor (0 = off)
+  uint8_t maxRejects = 8U;        ///< Consecutive rejections that restart the fit (>= 1)
+  uint32_t outlierFloorUs = 50U;  ///< Residuals below this are never outliers
+};
+
+/**
+ * @brief Correlator counters.
+ */
+struct TickCorrelatorStats {
+  uint32_t accepted = 0U;  ///< Samples used by the fit
+  uint32_t rejected = 0U;  ///< Outliers
+  uint32_t restarts = 0U;  ///< Fit restarts after maxRejects consecutive outliers
+  uint32_t wraps = 0U;     ///< 32-bit tick wraps observed
+};
+
+/**
+ * @brief Exponentially weighted least-squares tick-to-micros correlator.
+ */
+class TickCorrelator {
+ public:
+  TickCorrelator();
+
+  /**
+   * @brief Configure and reset the fit.
+   * @param config Window, warm-up and outlier settings.
+   * @return OK on success.
+   * @return INVALID_CONFIG if a field is out of range.
+   */
+  Status begin(const TickCorrelatorConfig& config);
+
+  /**
+   * @brief Feed one observation. Consecutive samples must be less than
+   *        2^32 ticks apart; the counter is assumed to count up.
+   * @param ticks Device counter (wraps at 2^32).
+   * @param micros micros64() at the same instant.
+   * @return OK (outliers are counted in stats().rejected, not errors).
+   * @return NOT_INITIALIZED before begin().
+   */
+  Status addSample(uint32_t ticks, int64_t micros);
+
+  /// @brief true once minSamples samples have been fitted.
+  bool isValid() const { return _valid; }
+
+  /**
+   * @brief Convert one tick value.
+   * @param ticks Device counter within +/-2^31 ticks of the latest sample.
+   * @return micros64() time, or 0 before isValid().
+   */
+  int64_t toMicros(uint32_t ticks) const {
+    const uint64_t d = ticks - _convBaseTicks;
+    const uint64_t whole = d * _convMulInt;
+    const uint64_t frac = (d * _convMulFrac + _convBaseFrac) >> 32;
+    return _convBaseMicros + static_cast<int64_t>(whole + frac);
+  }
+
+  /**
+   * @brief Convert a batch of tick values (vectorizable).
+   * @param ticks Input ticks, each within +/-2^31 of the latest sample.
+   * @param out Output micros (may not alias ticks).
+   * @param count Number of elements.
+   */
+  void toMicros(const uint32_t* ticks, int64_t* out, size_t count) const;
+
+  /// @brief Fitted slope a in microseconds per tick (0 before isValid()).
+  double microsPerTick() const { return _valid ? _slope : 0.0; }
+
+  /// @brief RMS residual of the current fit in microseconds.
+  double residualUs() const;
+
+  /// @brief Counters.
+  const TickCorrelatorStats& stats() const { return _stats; }
+
+ private:
+  void restart(uint64_t ticks, int64_t micros);
+  void publish();
+
+  TickCorrelatorConfig _config;
+  TickCorrelatorStats _stats;
+  // Fit state, centred on an anchor sample for precision.
+  uint64_t _anchorTicks;
+  int64_t _anchorMicros;
+  uint64_t _extendedTicks;
+  uint32_t _lastRawTicks;
+  double _lambda;
+  double _weight;
+  double _meanX;
+  double _meanY;
+  double _cxx;
+  double _cxy;
+  double _cyy;
+  double _slope;
+  uint32_t _fitted;
+  uint8_t _consecutiveRejects;
+  bool _initialized;
+  bool _valid;
+  // Fixed-point conversion snapshot, slope = mulInt + mulFrac / 2^32:
+  //   d = ticks - baseTicks
+  //   micros = baseMicros + d * mulInt + ((d * mulFrac + baseFrac) >> 32)
+  // baseTicks sits 2^31 ticks before the latest sample, so the unsigned
+  // 32-bit difference covers +/-2^31 around it; baseFrac carries the
+  // fractional base plus 0.5 for rounding. Error is below 1 us everywhere.
+  uint32_t _convBaseTicks;
+  uint32_t _convMulInt;
+  uint32_t _convMulFrac;
+  uint32_t _convBaseFrac;
+  int64_t _convBaseMicros;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,210 @@
+/**
+ * @file TimeSync.h
+ * @brief NTP/PTP-style two-way time synchronization over a byte transport.
+ *
+ * The client sends a request stamped t1 (client clock); the server stamps
+ * its receive t2 and reply t3 (server clock); the client stamps the reply
+ * t4. Then
+ *
+ *   offset = ((t2 - t1) + (t3 - t4)) / 2    server time - client time
+ *   delay  = (t4 - t1) - (t3 - t2)          round trip minus server hold
+ *
+ * assuming symmetric paths. Queueing only ever adds delay, so the sample
+ * with the smallest round trip in a sliding window is the least disturbed;
+ * the client reports that sample's offset (minimum-RTT filter).
+ *
+ * The library provides the engine and state machine. The application
+ * supplies a TimeSyncTransport (UART, UDP, ESP-NOW, ...) and calls poll()
+ * from its loop; poll() never blocks.
+ *
+ * Usage:
+ * @code
+ * MyUdpTransport link;
+ * SystemChrono::TimeSyncClient sync;
+ * sync.begin(link, SystemChrono::TimeSyncConfig());
+ * void loop() {
+ *   sync.poll();
+ *   if (sync.isSynchronized()) {
+ *     int64_t masterUs = sync.toServerTime(SystemChrono::micros64());
+ *   }
+ * }
+ * @endcode
+ *
+ * @note Stamp t2/t4 as close to the wire as possible: poll() often, and
+ *       have receive() return packets promptly.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Wire size of one time-sync packet.
+static constexpr size_t TIMESYNC_PACKET_SIZE = 28U;
+/// @brief Samples considered by the minimum-RTT filter.
+static constexpr uint8_t TIMESYNC_FILTER_SIZE = 8U;
+
+/// @brief Clock used to stamp packets; returns microseconds.
+using TimeSyncClockFn = int64_t (*)();
+
+/**
+ * @brief Pluggable datagram transport.
+ *
+ * Each send()/receive() carries exactly one packet of at most
+ * TIMESYNC_PACKET_SIZE bytes.
+ */
+class TimeSyncTransport {
+ public:
+  virtual ~TimeSyncTransport() {}
+
+  /**
+   * @brief Send one packet.
+   * @return OK if queued; any error is counted and the exchange retried.
+   */
+  virtual Status send(const uint8_t* data, size_t len) = 0;
+
+  /**
+   * @brief Receive one packet without blocking.
+   * @param data Output buffer.
+   * @param capacity Size of data.
+   * @param outLen Receives the packet length, or 0 if none is pending.
+   * @return OK (with outLen == 0 when idle), or a transport error.
+   */
+  virtual Status receive(uint8_t* data, size_t capacity, size_t& outLen) = 0;
+};
+
+/**
+ * @brief Client configuration.
+ */
+struct TimeSyncConfig {
+  TimeSyncClockFn clock = nullptr;  ///< Local clock (nullptr = micros64)
+  uint32_t intervalUs = 1000000U;   ///< Time between requests
+  uint32_t timeoutUs = 100000U;     ///< Drop a request unanswered this long
+  uint8_t minSamples = 4U;          ///< Samples before isSynchronized() (1..FILTER_SIZE)
+};
+
+/**
+ * @brief One completed exchange.
+ */
+struct TimeSyncSample {
+  int64_t offsetUs = 0;  ///< Server minus client
+  int64_t delayUs = 0;   ///< Round trip minus server hold time
+  int64_t t4Us = 0;      ///< Client time the reply arrived
+};
+
+/**
+ * @brief Client counters.
+ */
+struct TimeSyncStats {
+  uint32_t requests = 0U;         ///< Requests sent
+  uint32_t samples = 0U;          ///< Valid replies
+  uint32_t timeouts = 0U;         ///< Requests dropped after timeoutUs
+  uint32_t rejected = 0U;         ///< Malformed, stale or negative-delay replies
+  uint32_t transportErrors = 0U;  ///< Non-OK transport results
+};
+
+/**
+ * @brief Time-sync server (master): answers requests with t2/t3.
+ */
+class TimeSyncServer {
+ public:
+  TimeSyncServer();
+
+  /**
+   * @brief Attach a transport and clock.
+   * @param transport Transport; must outlive the server.
+   * @param clock Server clock (nullptr = micros64).
+   * @return OK.
+   */
+  Status begin(TimeSyncTransport& transport, TimeSyncClockFn clock = nullptr);
+
+  /**
+   * @brief Answer every pending request.
+   * @return OK, NOT_INITIALIZED before begin(), or the first transport error.
+   */
+  Status poll();
+
+  /// @brief Requests answered so far.
+  uint32_t answered() const { return _answered; }
+
+ private:
+  TimeSyncTransport* _transport;
+  TimeSyncClockFn _clock;
+  uint32_t _answered;
+};
+
+/**
+ * @brief Time-sync client: runs exchanges and filters the estimate.
+ */
+class TimeSyncClient {
+ public:
+  TimeSyncClient();
+
+  /**
+   * @brief Attach a transport and reset the filter.
+   * @param transport Transport; must outlive the client.
+   * @param config Clock, interval, timeout and minimum sample count.
+   * @return OK on success.
+   * @return INVALID_CONFIG if minSamples or intervalUs/timeoutUs is invalid.
+   */
+  Status begin(TimeSyncTransport& transport, const TimeSyncConfig& config);
+
+  /**
+   * @brief Advance the state machine: read replies, time out, send requests.
+   * @return OK, NOT_INITIALIZED before begin(), or the first transport error.
+   */
+  Status poll();
+
+  /**
+   * @brief Send the next request on the following poll(), ignoring the interval.
+   */
+  void requestNow();
+
+  /// @brief true once minSamples valid samples are in the window.
+  bool isSynchronized() const;
+
+  /// @brief Filtered offset (server - client) in microseconds.
+  int64_t offsetUs() const { return _best.offsetUs; }
+
+  /// @brief Round-trip delay of the selected sample in microseconds.
+  int64_t delayUs() const { return _best.delayUs; }
+
+  /// @brief Selected (minimum-RTT) sample.
+  const TimeSyncSample& bestSample() const { return _best; }
+
+  /// @brief Most recent sample, unfiltered.
+  const TimeSyncSample& lastSample() const { return _last; }
+
+  /**
+   * @brief Convert a client timestamp to the server time base.
+   * @param localUs Timestamp from the client clock.
+   * @return localUs + offsetUs().
+   */
+  int64_t toServerTime(int64_t localUs) const { return localUs + _best.offsetUs; }
+
+  /// @brief Counters.
+  const TimeSyncStats& stats() const { return _stats; }
+
+ private:
+  void addSample(const TimeSyncSample& sample);
+
+  TimeSyncTransport* _transport;
+  TimeSyncConfig _config;
+  TimeSyncSample _window[TIMESYNC_FILTER_SIZE];
+  TimeSyncSample _best;
+  TimeSyncSample _last;
+  TimeSyncStats _stats;
+  int64_t _pendingT1Us;
+  int64_t _lastRequestUs;
+  uint16_t _sequence;
+  uint8_t _count;
+  uint8_t _next;
+  bool _waiting;
+  bool _requestNow;
+};
+
+}  // namespace SystemChrono
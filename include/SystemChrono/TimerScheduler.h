@@ -0,0 +1,199 @@
+/**
+ * @file TimerScheduler.h
+ * @brief Timer coalescing: callbacks with per-timer slack, batched onto
+ *        shared wake-ups.
+ *
+ * A heartbeat due at 10.000 s does not mind running at 10.200 s. Each
+ * CoalescedTimer therefore carries a window [due, due + slack] instead of
+ * a single instant. TimerScheduler keeps two DeadlineRegistry heaps, one
+ * ordered by window start and one by window end, and wakes at
+ *
+ *   W = the earliest window end            (no timer may run later)
+ *
+ * On that wake-up it runs every timer whose window has started by W. This
+ * greedy choice gives the fewest possible wake-ups for the current windows,
+ * and no timer runs before its due time or after its slack.
+ *
+ * With alignUs = A, W is moved down to a multiple of A when that is still
+ * inside the first window. Then independent periodic timers keep meeting
+ * on the same boundaries (like round_jiffies() in Linux).
+ *
+ * Periodic timers keep to their own grid `start + k * period`. Running
+ * late within the slack does not shift the next window.
+ *
+ * Usage:
+ * @code
+ * struct Heartbeat : SystemChrono::TimerHandler {
+ *   void onTimer(int64_t nowUs) override { sendHeartbeat(); }
+ * } heartbeat;
+ *
+ * SystemChrono::Deadline* slots[2 * 8];          // two heaps of 8
+ * SystemChrono::TimerScheduler scheduler;
+ * scheduler.begin(slots, 8U);
+ * SystemChrono::CoalescedTimer hb(scheduler, heartbeat);
+ * hb.start(1000000, 200000U);                    // 1 s, up to 200 ms late
+ *
+ * void loop() {
+ *   SystemChrono::sleepUntil(scheduler.nextWakeUs());
+ *   scheduler.run();
+ * }
+ * @endcode
+ *
+ * @note Not thread-safe. Handlers run from run() and may re-arm or cancel
+ *       any timer, including their own.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/DeadlineRegistry.h"
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+class TimerScheduler;
+
+/**
+ * @brief Callback interface of a CoalescedTimer.
+ */
+class TimerHandler {
+ public:
+  virtual ~TimerHandler() {}
+
+  /**
+   * @brief The timer's window has been reached.
+   * @param nowUs Time of the batch (within [due, due + slack]).
+   */
+  virtual void onTimer(int64_t nowUs) = 0;
+};
+
+/**
+ * @brief One-shot or periodic timer with a slack window.
+ */
+class CoalescedTimer {
+ public:
+  /**
+   * @param scheduler Scheduler that runs this timer; must outlive it.
+   * @param handler Callback target.
+   */
+  CoalescedTimer(TimerScheduler& scheduler, TimerHandler& handler);
+
+  /**
+   * @brief Arm once for the window [dueUs, dueUs + slackUs].
+   * @return OK on success.
+   * @return OUT_OF_MEMORY if the scheduler is full; the timer is left disarmed.
+   */
+  Status armAt(int64_t dueUs, uint32_t slackUs);
+
+  /**
+   * @brief Run every periodUs, first one period after nowUs.
+   * @param nowUs Current time.
+   * @param periodUs Period (> 0).
+   * @param slackUs Tolerated lateness (< periodUs).
+   * @return OK on success.
+   * @return INVALID_CONFIG if periodUs <= 0 or slackUs >= periodUs.
+   * @return OUT_OF_MEMORY if the scheduler is full.
+   */
+  Status startAt(int64_t nowUs, int64_t periodUs, uint32_t slackUs);
+
+  /// @brief startAt(micros64(), periodUs, slackUs).
+  Status start(int64_t periodUs, uint32_t slackUs);
+
+  /// @brief Disarm.
+  void cancel();
+
+  /// @brief True while armed.
+  bool armed() const { return _early.armed(); }
+
+  /// @brief Start of the next window, or DEADLINE_NONE.
+  int64_t dueUs() const { return _early.dueUs(); }
+
+  /// @brief Slack of the current window.
+  uint32_t slackUs() const { return _slackUs; }
+
+ private:
+  friend class TimerScheduler;
+
+  // A Deadline that knows which timer it belongs to.
+  struct Edge : Deadline {
+    Edge(DeadlineRegistry* registry, CoalescedTimer* timer) : Deadline(registry), owner(timer) {}
+    CoalescedTimer* owner;
+  };
+
+  Status arm(int64_t dueUs);
+  void fire(int64_t nowUs);
+
+  Edge _early;  // keyed by window start
+  Edge _late;   // keyed by window end
+  TimerHandler* _handler;
+  int64_t _periodUs;
+  uint32_t _slackUs;
+};
+
+/**
+ * @brief TimerScheduler configuration.
+ */
+struct TimerSchedulerConfig {
+  uint32_t alignUs = 0U;  ///< Snap wake-ups to multiples of this (0 = off)
+};
+
+/**
+ * @brief Runs CoalescedTimers in as few batches as their windows allow.
+ */
+class TimerScheduler {
+ public:
+  TimerScheduler();
+
+  /**
+   * @brief Attach storage for both heaps and configure.
+   * @param storage Array of 2 * capacity pointers, owned by the caller.
+   * @param capacity Maximum simultaneously armed timers.
+   * @param config Alignment.
+   * @return OK on success.
+   * @return INVALID_CONFIG if storage is null or capacity is 0.
+   * @return RESOURCE_BUSY if timers are still armed.
+   */
+  Status begin(Deadline** storage, size_t capacity,
+               const TimerSchedulerConfig& config = TimerSchedulerConfig());
+
+  /// @brief When to wake next, or DEADLINE_NONE if nothing is armed. O(1).
+  int64_t nextWakeUs() const;
+
+  /// @brief Microseconds until nextWakeUs() from nowUs (0 if due).
+  int64_t idleForAt(int64_t nowUs) const;
+
+  /**
+   * @brief Run every timer whose window has started by nowUs.
+   * @param nowUs Current time.
+   * @return Handlers called.
+   *
+   * Handler calls are bounded by the timers armed on entry, so a handler
+   * that re-arms its timer at or before nowUs cannot loop forever.
+   */
+  uint32_t runAt(int64_t nowUs);
+
+  /// @brief runAt(micros64()).
+  uint32_t run();
+
+  /// @brief Armed timers.
+  size_t size() const { return _byStart.size(); }
+
+  /// @brief runAt() calls that ran at least one handler.
+  uint32_t batches() const { return _batches; }
+
+  /// @brief Handlers called in total.
+  uint32_t dispatched() const { return _dispatched; }
+
+ private:
+  friend class CoalescedTimer;
+
+  DeadlineRegistry _byStart;
+  DeadlineRegistry _byEnd;
+  int64_t _alignUs;
+  uint32_t _batches;
+  uint32_t _dispatched;
+};
+
+}  // namespace SystemChrono
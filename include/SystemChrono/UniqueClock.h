@@ -0,0 +1,53 @@
+/**
+ * @file UniqueClock.h
+ * @brief Strictly increasing microsecond timestamps for event ordering.
+ *
+ * Two events in the same microsecond get equal micros64() values.
+ * uniqueMicros64() instead returns max(micros64(), last + 1), claimed with
+ * a compare-and-swap on the last issued value, so every call from every
+ * thread gets a distinct, strictly increasing timestamp.
+ *
+ * Usage:
+ * @code
+ * const int64_t stamp = SystemChrono::uniqueMicros64();  // never repeats
+ * @endcode
+ *
+ * @note Lock-free where 64-bit atomics are (host, 64-bit targets). On
+ *       32-bit ESP32 the CAS is emulated with a short critical section.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace SystemChrono {
+
+/**
+ * @brief Maximum lead of uniqueMicros64() over micros64().
+ *
+ * Issuing more than one stamp per microsecond makes the sequence run ahead
+ * of real time; callers spin until the lead is back under this bound.
+ */
+static constexpr int64_t UNIQUE_MICROS_MAX_SKEW_US = 1000;
+
+/**
+ * @brief Get a strictly increasing microsecond timestamp.
+ * @return Value greater than every previously returned value, and within
+ *         [micros64(), micros64() + UNIQUE_MICROS_MAX_SKEW_US].
+ *
+ * @note Thread-safe. Not for ISRs on ESP32 (the skew bound may spin).
+ * @note While the virtual clock is enabled the skew bound is not enforced,
+ *       since simulated time cannot catch up by waiting. If virtual time
+ *       ran ahead of real time, the first call after disableVirtualClock()
+ *       restarts the sequence at micros64() instead of waiting; stamps are
+ *       then unique only against those issued since.
+ */
+int64_t uniqueMicros64();
+
+/**
+ * @brief Get the last value returned by uniqueMicros64().
+ * @return Last issued stamp, or 0 if none.
+ */
+int64_t lastUniqueMicros64();
+
+}  // namespace SystemChrono
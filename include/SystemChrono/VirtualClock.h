@@ -0,0 +1,142 @@
+/**
+ * @file VirtualClock.h
+ * @brief Deterministic virtual time for fast-forward simulation of timer code.
+ *
+ * While the virtual clock is enabled, micros64() (and everything built on
+ * it: millis64(), the *Since() helpers, Stopwatch, the Elapsed*64 timers,
+ * SystemClock and nanos64()) returns a simulated time that only moves when
+ * the test calls advanceVirtualClock(), advanceVirtualClockTo() or
+ * advanceToNextVirtualWakeup(). A day of scheduling runs in milliseconds.
+ *
+ * Wakeups are an optional min-heap of (time, tag) pairs in caller-owned
+ * storage. Code under test schedules its next deadline; the driver jumps
+ * straight to the earliest one instead of stepping through idle time.
+ *
+ * Usage:
+ * @code
+ * static SystemChrono::VirtualWakeup wakeups[64];
+ * SystemChrono::enableVirtualClock(0, wakeups, 64);
+ * SystemChrono::ElapsedSeconds64 uptime;
+ * SystemChrono::advanceVirtualClock(24LL * 3600LL * 1000000LL);
+ * // uptime == 86400
+ * SystemChrono::disableVirtualClock();
+ * @endcode
+ *
+ * @note Compiled in only when SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK is defined
+ *       (CMake option of the same name; add `-DSYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK`
+ *       to build_flags for firmware). Without it micros64() has no extra
+ *       branch and enableVirtualClock() returns INVALID_CONFIG.
+ * @note Control functions are not thread-safe; call them from the thread
+ *       driving the simulation. micros64() readers on other threads see
+ *       each advance atomically.
+ * @note cycles64() keeps reading the hardware counter.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/**
+ * @brief One scheduled wakeup point.
+ */
+struct VirtualWakeup {
+  int64_t atUs = 0;   ///< Virtual time of the wakeup
+  uint32_t tag = 0U;  ///< Caller-defined identifier (e.g. timer index)
+  uint32_t seq = 0U;  ///< Insertion order; set by scheduleVirtualWakeup()
+};
+
+/**
+ * @brief Switch micros64() to virtual time.
+ * @param startUs Initial virtual time in microseconds (>= 0).
+ * @param wakeupStorage Caller-owned wakeup heap storage (may be null).
+ * @param wakeupCapacity Number of entries in wakeupStorage.
+ * @return OK on success.
+ * @return INVALID_CONFIG if startUs is negative, storage and capacity
+ *         disagree, or the library was built without
+ *         SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK.
+ *
+ * Re-enabling resets the time and clears all pending wakeups.
+ *
+ * @note wakeupStorage must outlive the enabled period.
+ */
+Status enableVirtualClock(int64_t startUs, VirtualWakeup* wakeupStorage = nullptr,
+                          size_t wakeupCapacity = 0U);
+
+/**
+ * @brief Return micros64() to real time and drop pending wakeups.
+ *
+ * @note Real and virtual time bases differ; timers started under one are
+ *       meaningless under the other.
+ */
+void disableVirtualClock();
+
+/**
+ * @brief Check if micros64() currently returns virtual time.
+ * @return true if enabled.
+ */
+bool isVirtualClockEnabled();
+
+/**
+ * @brief Move virtual time forward.
+ * @param deltaUs Microseconds to advance (>= 0, saturates at INT64_MAX).
+ * @return OK on success.
+ * @return NOT_INITIALIZED if the virtual clock is not enabled.
+ * @return INVALID_CONFIG if deltaUs is negative.
+ */
+Status advanceVirtualClock(int64_t deltaUs);
+
+/**
+ * @brief Move virtual time to an absolute value.
+ * @param timeUs Target time; must not be earlier than the current time.
+ * @return OK on success.
+ * @return NOT_INITIALIZED if the virtual clock is not enabled.
+ * @return INVALID_CONFIG if timeUs would move time backwards.
+ */
+Status advanceVirtualClockTo(int64_t timeUs);
+
+/**
+ * @brief Add a wakeup point to the heap.
+ * @param atUs Virtual time of the wakeup (may be in the past).
+ * @param tag Caller-defined identifier returned when the wakeup fires.
+ * @return OK on success.
+ * @return NOT_INITIALIZED if the virtual clock is not enabled.
+ * @return OUT_OF_MEMORY if the wakeup storage is full (detail = capacity).
+ *
+ * @note O(log n). Wakeups with equal times fire in insertion order.
+ */
+Status scheduleVirtualWakeup(int64_t atUs, uint32_t tag = 0U);
+
+/**
+ * @brief Pop the earliest wakeup and jump virtual time to it.
+ * @param fired Receives the popped wakeup (may be null).
+ * @return true if a wakeup was popped.
+ * @return false if the virtual clock is disabled or no wakeup is pending.
+ *
+ * Time never moves backwards: a wakeup scheduled in the past fires at the
+ * current time.
+ */
+bool advanceToNextVirtualWakeup(VirtualWakeup* fired = nullptr);
+
+/**
+ * @brief Number of wakeups waiting in the heap.
+ * @return Pending wakeup count (0 when disabled).
+ */
+size_t pendingVirtualWakeups();
+
+namespace detail {
+
+/**
+ * @brief micros64() hook: read virtual time if enabled.
+ * @param outUs Receives the virtual time when enabled.
+ * @return true if the virtual clock is enabled.
+ */
+bool readVirtualClock(int64_t& outUs);
+
+}  // namespace detail
+
+}  // namespace SystemChrono
@@ -0,0 +1,175 @@
+/**
+ * @file WindowAggregator.h
+ * @brief Tumbling/hopping min, max, mean and last over micros64() buckets.
+ *
+ * Samples are grouped into buckets of bucketUs aligned to multiples of
+ * bucketUs on the micros64() time line (so a 1 s and a 60 s aggregator
+ * agree on boundaries). When a bucket completes, the sink receives
+ *
+ *   hops == 1   the bucket itself (tumbling window)
+ *   hops == N   the last N buckets combined (window of N * bucketUs that
+ *               advances by bucketUs, i.e. a hopping window)
+ *
+ * Completed buckets can also cascade into a coarser aggregator
+ * (seconds -> minutes -> hours); stats combine exactly, so the minute min,
+ * max, mean and last equal those computed from the raw samples.
+ *
+ * Buckets without samples are reported with count == 0 rather than
+ * repeating stale values. A gap longer than the window is reported as a
+ * single empty record spanning the whole gap, so a long outage costs O(1).
+ *
+ * A bucket completes when a later sample arrives or flush() passes its end.
+ * The per-sample path is one range check and four updates; values are
+ * integers (raw counts or fixed-point units).
+ *
+ * Usage:
+ * @code
+ * struct Reporter : SystemChrono::WindowSink {
+ *   void onWindow(const SystemChrono::WindowStats& w) override { publish(w); }
+ * } perMinute;
+ * SystemChrono::WindowAggregator seconds, minutes;
+ * SystemChrono::WindowConfig cfg;        // 1 s buckets, tumbling
+ * seconds.begin(cfg, nullptr);
+ * cfg.bucketUs = 60000000U;
+ * minutes.begin(cfg, &perMinute);
+ * seconds.cascadeTo(minutes);
+ * seconds.add(SystemChrono::micros64(), readSensor());  // at 1 kHz
+ * @endcode
+ *
+ * @note Not thread-safe. Sinks are called from add() and flush().
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "SystemChrono/Status.h"
+
+namespace SystemChrono {
+
+/// @brief Maximum buckets per hopping window.
+static constexpr uint8_t WINDOW_MAX_HOPS = 60U;
+
+/**
+ * @brief Aggregate over [startUs, endUs).
+ */
+struct WindowStats {
+  int64_t startUs = 0;  ///< Inclusive start (micros64() time base)
+  int64_t endUs = 0;    ///< Exclusive end
+  uint32_t count = 0U;  ///< Samples; 0 for an empty bucket or gap
+  int32_t min = 0;      ///< Smallest value (valid if count > 0)
+  int32_t max = 0;      ///< Largest value (valid if count > 0)
+  int32_t last = 0;     ///< Most recent value (valid if count > 0)
+  int64_t sum = 0;      ///< Sum of values
+
+  /// @brief Mean rounded toward zero, or 0 if empty.
+  int32_t mean() const { return count == 0U ? 0 : static_cast<int32_t>(sum / count); }
+
+  /// @brief True if no sample fell into the window.
+  bool empty() const { return count == 0U; }
+};
+
+/**
+ * @brief Receives completed windows.
+ */
+class WindowSink {
+ public:
+  virtual ~WindowSink() {}
+
+  /// @brief Called once per completed window, in time order.
+  virtual void onWindow(const WindowStats& window) = 0;
+};
+
+/**
+ * @brief Aggregator configuration.
+ */
+struct WindowConfig {
+  uint64_t bucketUs = 1000000U;  ///< Bucket width and hop (> 0)
+  uint8_t hops = 1U;             ///< Buckets per window (1..WINDOW_MAX_HOPS; 1 = tumbling)
+};
+
+/**
+ * @brief Fixed-memory time-bucketed aggregator.
+ */
+class WindowAggregator {
+ public:
+  WindowAggregator();
+
+  /**
+   * @brief Configure and reset.
+   * @param config Bucket width and window length in buckets.
+   * @param sink Receives completed windows (may be null for a cascade stage).
+   * @return OK on success.
+   * @return INVALID_CONFIG if bucketUs is 0 or hops is out of range.
+   */
+  Status begin(const WindowConfig& config, WindowSink* sink);
+
+  /**
+   * @brief Feed completed buckets into a coarser aggregator.
+   * @param next Aggregator whose bucketUs is a multiple of this one's.
+   * @return OK on success.
+   * @return NOT_INITIALIZED if either aggregator has not begun.
+   * @return INVALID_CONFIG if next is this or its bucket is not a multiple.
+   */
+  Status cascadeTo(WindowAggregator& next);
+
+  /**
+   * @brief Add one sample.
+   * @param micros Sample time; samples before the open bucket are dropped.
+   * @param value Sample value.
+   */
+  void add(int64_t micros, int32_t value) {
+    // Unsigned distance: one compare rejects both earlier and later buckets.
+    if (static_cast<uint64_t>(micros) - static_cast<uint64_t>(_open.startUs) < _openSpanUs) {
+      _open.min = value < _open.min ? value : _open.min;
+      _open.max = value > _open.max ? value : _open.max;
+      _open.last = value;
+      _open.sum += value;
+      ++_open.count;
+      return;
+    }
+    addSlow(micros, value);
+  }
+
+  /**
+   * @brief Merge an already aggregated bucket (what a cascade delivers).
+   * @param bucket Stats over [startUs, endUs) inside one of this aggregator's
+   *        buckets, or an empty record spanning a gap.
+   */
+  void addBucket(const WindowStats& bucket);
+
+  /**
+   * @brief Complete every bucket that ends at or before nowUs.
+   * @param nowUs Current time.
+   */
+  void flush(int64_t nowUs);
+
+  /// @brief The bucket currently filling.
+  const WindowStats& openBucket() const { return _open; }
+
+  /// @brief Samples dropped for arriving after their bucket completed.
+  uint32_t late() const { return _late; }
+
+ private:
+  void addSlow(int64_t micros, int32_t value);
+  void advanceTo(int64_t bucketStartUs);
+  void closeBucket();
+  void emitWindow(int64_t endUs);
+  void resetOpen(int64_t startUs);
+  int64_t bucketStart(int64_t micros) const;
+
+  WindowStats _ring[WINDOW_MAX_HOPS];  // last `hops` completed buckets
+  WindowStats _open;
+  WindowSink* _sink;
+  WindowAggregator* _next;
+  uint64_t _bucketUs;
+  uint64_t _openSpanUs;  // _bucketUs once a bucket is open, else 0 (forces the slow path)
+  uint32_t _late;
+  uint8_t _hops;
+  uint8_t _ringHead;  // slot the next completed bucket goes to
+  uint8_t _emptyRun;  // consecutive empty buckets completed (saturates at hops)
+  bool _started;
+  bool _initialized;
+};
+
+}  // namespace SystemChrono
@@ -0,0 +1,84 @@
+/**
+ * @file Int64Cell.h
+ * @brief Internal single-writer 64-bit cell with tear-free reads.
+ *
+ * Not part of the public API. Int64Cell is a plain std::atomic<int64_t>
+ * where 64-bit atomics are lock-free (host, 64-bit targets) and a seqlock
+ * over two 32-bit atomics elsewhere (ESP32: 32-bit Xtensa/RISC-V), so
+ * readers never take a lock and are safe against a concurrent writer.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <type_traits>
+
+namespace SystemChrono {
+namespace detail {
+
+/**
+ * @brief Cell backed by a lock-free std::atomic<int64_t>.
+ */
+class AtomicInt64Cell {
+ public:
+  AtomicInt64Cell() : _value(0) {}
+
+  void store(int64_t value) { _value.store(value, std::memory_order_release); }
+  int64_t load() const { return _value.load(std::memory_order_acquire); }
+
+ private:
+  std::atomic<int64_t> _value;
+};
+
+/**
+ * @brief Cell backed by a seqlock over two 32-bit halves.
+ *
+ * @note Single writer. Readers retry while a store is in progress, so a
+ *       reader must not preempt the writer on the same core indefinitely
+ *       (never store from a context that a spinning reader can block).
+ */
+class SeqlockInt64Cell {
+ public:
+  SeqlockInt64Cell() : _seq(0U), _lo(0U), _hi(0U) {}
+
+  void store(int64_t value) {
+    const uint32_t seq = _seq.load(std::memory_order_relaxed);
+    _seq.store(seq + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    const uint64_t bits = static_cast<uint64_t>(value);
+    _lo.store(static_cast<uint32_t>(bits), std::memory_order_relaxed);
+    _hi.store(static_cast<uint32_t>(bits >> 32), std::memory_order_relaxed);
+    _seq.store(seq + 2U, std::memory_order_release);
+  }
+
+  int64_t load() const {
+    for (;;) {
+      const uint32_t before = _seq.load(std::memory_order_acquire);
+      if ((before & 1U) != 0U) {
+        continue;
+      }
+      const uint32_t lo = _lo.load(std::memory_order_relaxed);
+      const uint32_t hi = _hi.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (_seq.load(std::memory_order_relaxed) == before) {
+        return static_cast<int64_t>((static_cast<uint64_t>(hi) << 32) | lo);
+      }
+    }
+  }
+
+ private:
+  std::atomic<uint32_t> _seq;
+  std::atomic<uint32_t> _lo;
+  std::atomic<uint32_t> _hi;
+};
+
+#if defined(ATOMIC_LLONG_LOCK_FREE) && (ATOMIC_LLONG_LOCK_FREE == 2)
+using Int64Cell = AtomicInt64Cell;
+#else
+using Int64Cell = SeqlockInt64Cell;
+#endif
+
+}  // namespace detail
+}  // namespace SystemChrono
@@ -0,0 +1,110 @@
+/**
+ * @file SaturatingMath.h
+ * @brief Internal saturating 64-bit arithmetic shared by the timer classes.
+ *
+ * Not part of the public API. Used by SystemChrono.cpp and by the header-only
+ * templates (ClockSource.h) so both saturate identically.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <limits>
+
+namespace SystemChrono {
+namespace detail {
+
+static constexpr int64_t INT64_MIN_VALUE = (std::numeric_limits<int64_t>::min)();
+static constexpr int64_t INT64_MAX_VALUE = (std::numeric_limits<int64_t>::max)();
+
+inline int64_t saturatingAdd(int64_t lhs, int64_t rhs) {
+#if defined(__GNUC__) || defined(__clang__)
+  int64_t out = 0;
+  if (!__builtin_add_overflow(lhs, rhs, &out)) {
+    return out;
+  }
+  return rhs >= 0 ? INT64_MAX_VALUE : INT64_MIN_VALUE;
+#else
+  if ((rhs > 0) && (lhs > (INT64_MAX_VALUE - rhs))) {
+    return INT64_MAX_VALUE;
+  }
+  if ((rhs < 0) && (lhs < (INT64_MIN_VALUE - rhs))) {
+    return INT64_MIN_VALUE;
+  }
+  return lhs + rhs;
+#endif
+}
+
+inline int64_t saturatingSub(int64_t lhs, int64_t rhs) {
+#if defined(__GNUC__) || defined(__clang__)
+  int64_t out = 0;
+  if (!__builtin_sub_overflow(lhs, rhs, &out)) {
+    return out;
+  }
+  return rhs >= 0 ? INT64_MIN_VALUE : INT64_MAX_VALUE;
+#else
+  if ((rhs > 0) && (lhs < (INT64_MIN_VALUE + rhs))) {
+    return INT64_MIN_VALUE;
+  }
+  if ((rhs < 0) && (lhs > (INT64_MAX_VALUE + rhs))) {
+    return INT64_MAX_VALUE;
+  }
+  return lhs - rhs;
+#endif
+}
+
+inline int64_t saturatingMul(int64_t lhs, int64_t rhs) {
+#if defined(__GNUC__) || defined(__clang__)
+  int64_t out = 0;
+  if (!__builtin_mul_overflow(lhs, rhs, &out)) {
+    return out;
+  }
+  const bool sameSign = (lhs < 0) == (rhs < 0);
+  return sameSign ? INT64_MAX_VALUE : INT64_MIN_VALUE;
+#else
+  if ((lhs == 0) || (rhs == 0)) {
+    return 0;
+  }
+  if ((lhs == -1) && (rhs == INT64_MIN_VALUE)) {
+    return INT64_MAX_VALUE;
+  }
+  if ((rhs == -1) && (lhs == INT64_MIN_VALUE)) {
+    return INT64_MAX_VALUE;
+  }
+
+  if (lhs > 0) {
+    if (rhs > 0) {
+      if (lhs > (INT64_MAX_VALUE / rhs)) {
+        return INT64_MAX_VALUE;
+      }
+    } else {
+      if (rhs < (INT64_MIN_VALUE / lhs)) {
+        return INT64_MIN_VALUE;
+      }
+    }
+  } else {
+    if (rhs > 0) {
+      if (lhs < (INT64_MIN_VALUE / rhs)) {
+        return INT64_MIN_VALUE;
+      }
+    } else {
+      if (lhs < (INT64_MAX_VALUE / rhs)) {
+        return INT64_MAX_VALUE;
+      }
+    }
+  }
+  return lhs * rhs;
+#endif
+}
+
+inline int64_t millisToMicrosSaturated(int64_t valueMs) {
+  return saturatingMul(valueMs, 1000LL);
+}
+
+inline int64_t secondsToMicrosSaturated(int64_t valueS) {
+  return saturatingMul(valueS, 1000000LL);
+}
+
+}  // namespace detail
+}  // namespace SystemChrono
@@ -0,0 +1,43 @@
+/**
+ * @file Stats.h
+ * @brief Internal order statistics for small sample arrays.
+ *
+ * Not part of the public API. Used by Bench.cpp and ClockCalibration.cpp,
+ * which sort a few dozen samples in place and take medians; insertion sort
+ * needs no heap and is fastest at that size.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace SystemChrono {
+namespace detail {
+
+/// @brief Sort values[0..count) ascending, in place.
+template <typename T>
+inline void sortAscending(T* values, size_t count) {
+  for (size_t i = 1; i < count; ++i) {
+    const T key = values[i];
+    size_t j = i;
+    while ((j > 0U) && (values[j - 1U] > key)) {
+      values[j] = values[j - 1U];
+      --j;
+    }
+    values[j] = key;
+  }
+}
+
+/// @brief Median of sorted values (mean of the middle two for even count > 0).
+template <typename T>
+inline T medianOfSorted(const T* values, size_t count) {
+  const size_t mid = count / 2U;
+  if ((count % 2U) != 0U) {
+    return values[mid];
+  }
+  return static_cast<T>((static_cast<int64_t>(values[mid - 1U]) + values[mid]) / 2);
+}
+
+}  // namespace detail
+}  // namespace SystemChrono
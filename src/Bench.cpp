@@ -0,0 +1,150 @@
+/**
+ * @file Bench.cpp
+ * @brief Implementation of the SystemChrono micro-benchmark harness.
+ */
+
+#include "SystemChrono/Bench.h"
+
+#include <stdio.h>
+
+#include "SystemChrono/ClockCalibration.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/Stats.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static inline int64_t perIterationPs(int64_t totalNs, uint32_t iterations) {
+  return (totalNs * 1000LL) / static_cast<int64_t>(iterations);
+}
+
+}  // namespace
+
+namespace detail {
+
+int64_t benchNowNs() {
+  // Cycle-counter nanoseconds once calibrateCycleClock() ran, micros64() otherwise.
+  return nanos64();
+}
+
+int64_t benchResolutionNs() {
+  const uint64_t hz = cycleClockHz();
+  if (hz == 0U) {
+    return 1000;
+  }
+  const uint64_t periodNs = 1000000000ULL / hz;
+  return periodNs > 0U ? static_cast<int64_t>(periodNs) : 1;
+}
+
+void benchYield() {
+#if defined(ARDUINO_ARCH_ESP32)
+  // Let the idle task run so long benchmark sessions do not trip the task watchdog.
+  delay(1);
+#elif defined(ARDUINO)
+  yield();
+#endif
+}
+
+uint32_t benchScaleIterations(uint32_t iterations, int64_t elapsedNs, int64_t targetUs,
+                              uint32_t maxIterations) {
+  const int64_t targetNs = targetUs * 1000LL;
+  uint64_t next = 0U;
+  if ((elapsedNs * 10) < targetNs) {
+    next = static_cast<uint64_t>(iterations) * 10U;
+  } else {
+    next = (static_cast<uint64_t>(iterations) * static_cast<uint64_t>(targetNs)) /
+           static_cast<uint64_t>(elapsedNs);
+  }
+  if (next < 1U) {
+    next = 1U;
+  }
+  if (next > maxIterations) {
+    next = maxIterations;
+  }
+  return static_cast<uint32_t>(next);
+}
+
+void benchSummarize(int64_t* rawNs, int64_t* emptyNs, uint8_t count, uint32_t iterations,
+                    BenchResult& out) {
+  sortAscending(emptyNs, count);
+  const int64_t overheadNs = medianOfSorted(emptyNs, count);
+
+  for (uint8_t i = 0; i < count; ++i) {
+    const int64_t net = rawNs[i] - overheadNs;
+    rawNs[i] = net > 0 ? net : 0;
+  }
+  sortAscending(rawNs, count);
+  const int64_t medianNs = medianOfSorted(rawNs, count);
+
+  // Reuse the empty-loop buffer for absolute deviations.
+  for (uint8_t i = 0; i < count; ++i) {
+    const int64_t dev = rawNs[i] - medianNs;
+    emptyNs[i] = dev >= 0 ? dev : -dev;
+  }
+  sortAscending(emptyNs, count);
+
+  out.iterations = iterations;
+  out.samples = count;
+  out.minPs = perIterationPs(rawNs[0], iterations);
+  out.medianPs = perIterationPs(medianNs, iterations);
+  out.madPs = perIterationPs(medianOfSorted(emptyNs, count), iterations);
+  out.overheadPs = perIterationPs(overheadNs, iterations);
+
+  // Two clock reads bracket every sample; each contributes its jitter.
+  const ClockCalibration& calibration = clockCalibration();
+  const int64_t jitterNs = calibration.valid ? 2LL * calibration.jitterNs : 0;
+  out.noiseFloorPs = perIterationPs(benchResolutionNs() + jitterNs, iterations);
+}
+
+}  // namespace detail
+
+Status formatBenchResultTo(const BenchResult& result, char* out, size_t outLen) {
+  if ((out == nullptr) || (outLen == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Output buffer is null or empty");
+  }
+
+  out[0] = '\0';
+
+  if (outLen < BENCH_RESULT_BUFFER_SIZE) {
+    return Status(Err::INVALID_CONFIG,
+                  static_cast<int32_t>(BENCH_RESULT_BUFFER_SIZE),
+                  "Output buffer too small");
+  }
+
+  const int written = snprintf(out,
+                               outLen,
+                               "%-28.28s median %lld.%03lld ns | min %lld.%03lld ns | "
+                               "mad %lld.%03lld ns | ovh %lld.%03lld ns | "
+                               "floor %lld.%03lld ns | %lu x %u",
+                               result.name,
+                               static_cast<long long>(result.medianPs / 1000),
+                               static_cast<long long>(result.medianPs % 1000),
+                               static_cast<long long>(result.minPs / 1000),
+                               static_cast<long long>(result.minPs % 1000),
+                               static_cast<long long>(result.madPs / 1000),
+                               static_cast<long long>(result.madPs % 1000),
+                               static_cast<long long>(result.overheadPs / 1000),
+                               static_cast<long long>(result.overheadPs % 1000),
+                               static_cast<long long>(result.noiseFloorPs / 1000),
+                               static_cast<long long>(result.noiseFloorPs % 1000),
+                               static_cast<unsigned long>(result.iterations),
+                               static_cast<unsigned>(result.samples));
+
+  if (written < 0) {
+    out[0] = '\0';
+    return Status(Err::INTERNAL_ERROR, written, "Benchmark formatting failed");
+  }
+
+  if (static_cast<size_t>(written) >= outLen) {
+    out[0] = '\0';
+    return Status(Err::INVALID_CONFIG,
+                  static_cast<int32_t>(written + 1),
+                  "Output buffer too small");
+  }
+
+  return Ok();
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,73 @@
+/**
+ * @file ClockCalibration.cpp
+ * @brief Implementation of clock-read overhead calibration.
+ */
+
+#include "SystemChrono/ClockCalibration.h"
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/Stats.h"
+
+namespace SystemChrono {
+
+namespace {
+
+ClockCalibration g_calibration;
+
+}  // namespace
+
+namespace detail {
+
+void summarizeCalibration(int32_t* blockCostNs, uint16_t blocks, uint16_t readsPerBlock,
+                          ClockCalibration& out) {
+  sortAscending(blockCostNs, blocks);
+  const int32_t median = medianOfSorted(blockCostNs, blocks);
+
+  for (uint16_t i = 0; i < blocks; ++i) {
+    const int32_t dev = blockCostNs[i] - median;
+    blockCostNs[i] = dev >= 0 ? dev : -dev;
+  }
+  sortAscending(blockCostNs, blocks);
+
+  out.readCostNs = median;
+  out.jitterNs = medianOfSorted(blockCostNs, blocks);
+  out.blocks = blocks;
+  out.readsPerBlock = readsPerBlock;
+  out.valid = true;
+}
+
+}  // namespace detail
+
+Status calibrateClockOverhead(uint16_t blocks, uint16_t readsPerBlock) {
+  ClockCalibration measured;
+  const Status status = measureClockReadCost(micros64, blocks, readsPerBlock, measured);
+  if (!status.ok()) {
+    return status;
+  }
+  g_calibration = measured;
+  return Ok();
+}
+
+const ClockCalibration& clockCalibration() {
+  return g_calibration;
+}
+
+void setClockCalibration(const ClockCalibration& calibration) {
+  g_calibration = calibration;
+  g_calibration.valid = true;
+}
+
+void clearClockCalibration() {
+  g_calibration = ClockCalibration();
+}
+
+int64_t compensateReadOverhead(int64_t elapsedUs, uint32_t intervals) {
+  if (!g_calibration.valid || (g_calibration.readCostNs <= 0) || (elapsedUs <= 0)) {
+    return elapsedUs;
+  }
+  const int64_t overheadUs =
+      (static_cast<int64_t>(intervals) * g_calibration.readCostNs + 500LL) / 1000LL;
+  return elapsedUs > overheadUs ? elapsedUs - overheadUs : 0;
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,98 @@
+/**
+ * @file CoarseClock.cpp
+ * @brief Implementation of the cached coarse clock.
+ */
+
+#include "SystemChrono/CoarseClock.h"
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/Int64Cell.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+  #include "esp_timer.h"
+#endif
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr uint32_t MIN_PERIOD_US = 100U;
+static constexpr uint32_t MAX_PERIOD_US = 1000000U;
+
+// Divisions happen once per update, never on the read path.
+detail::Int64Cell g_coarseUs;
+detail::Int64Cell g_coarseMs;
+detail::Int64Cell g_coarseS;
+
+#if defined(ARDUINO_ARCH_ESP32)
+esp_timer_handle_t g_timer = nullptr;
+
+void onCoarseTick(void* arg) {
+  (void)arg;
+  updateCoarseClock();
+}
+#endif
+
+}  // namespace
+
+Status startCoarseClock(uint32_t periodUs) {
+  if ((periodUs < MIN_PERIOD_US) || (periodUs > MAX_PERIOD_US)) {
+    return Status(Err::INVALID_CONFIG, static_cast<int32_t>(periodUs),
+                  "Coarse clock period out of range");
+  }
+#if defined(ARDUINO_ARCH_ESP32)
+  if (g_timer == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = &onCoarseTick;
+    args.arg = nullptr;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "coarse_clock";
+    const esp_err_t err = esp_timer_create(&args, &g_timer);
+    if (err != ESP_OK) {
+      g_timer = nullptr;
+      return Status(Err::EXTERNAL_LIB_ERROR, static_cast<int32_t>(err),
+                    "esp_timer_create failed");
+    }
+  } else {
+    (void)esp_timer_stop(g_timer);  // ESP_ERR_INVALID_STATE if not running
+  }
+  updateCoarseClock();
+  const esp_err_t err = esp_timer_start_periodic(g_timer, periodUs);
+  if (err != ESP_OK) {
+    return Status(Err::EXTERNAL_LIB_ERROR, static_cast<int32_t>(err),
+                  "esp_timer_start_periodic failed");
+  }
+  return Ok();
+#else
+  return Status(Err::INVALID_CONFIG, 0, "No periodic timer; call updateCoarseClock()");
+#endif
+}
+
+void stopCoarseClock() {
+#if defined(ARDUINO_ARCH_ESP32)
+  if (g_timer != nullptr) {
+    (void)esp_timer_stop(g_timer);
+  }
+#endif
+}
+
+void updateCoarseClock() {
+  const int64_t nowUs = micros64();
+  g_coarseUs.store(nowUs);
+  g_coarseMs.store(nowUs / 1000LL);
+  g_coarseS.store(nowUs / 1000000LL);
+}
+
+int64_t micros64Coarse() {
+  return g_coarseUs.load();
+}
+
+int64_t millis64Coarse() {
+  return g_coarseMs.load();
+}
+
+int64_t seconds64Coarse() {
+  return g_coarseS.load();
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,381 @@
+/**
+ * @file CronSchedule.cpp
+ * @brief Cron parser, bit-scan next-fire search and CronTimer.
+ */
+
+#include "SystemChrono/CronSchedule.h"
+
+#include <string.h>
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr int64_t US_PER_MINUTE = 60000000LL;
+static constexpr int64_t MINUTES_PER_DAY = 1440;
+static constexpr int FIELD_COUNT = 5;
+
+// The Gregorian calendar repeats every 400 years, so a schedule that passes
+// parse() fires within that span (Feb 29 on a given weekday can be 40 away).
+static constexpr int64_t SEARCH_YEARS = 400;
+
+struct FieldRange {
+  unsigned lo;
+  unsigned hi;
+};
+
+static const FieldRange FIELD_RANGES[FIELD_COUNT] = {{0U, 59U}, {0U, 23U}, {1U, 31U},
+                                                     {1U, 12U}, {0U, 7U}};
+
+struct Macro {
+  const char* name;
+  const char* expression;
+};
+
+static const Macro MACROS[] = {
+    {"@yearly", "0 0 1 1 *"}, {"@annually", "0 0 1 1 *"}, {"@monthly", "0 0 1 * *"},
+    {"@weekly", "0 0 * * 0"}, {"@daily", "0 0 * * *"},    {"@midnight", "0 0 * * *"},
+    {"@hourly", "0 * * * *"},
+};
+
+// Lowest set bit at or above `from`, or -1.
+static inline int nextBit(uint64_t mask, unsigned from) {
+  if (from >= 64U) {
+    return -1;
+  }
+  mask &= ~0ULL << from;
+  if (mask == 0U) {
+    return -1;
+  }
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(mask);
+#else
+  int bit = 0;
+  while ((mask & 1U) == 0U) {
+    mask >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+static inline int64_t floorDiv(int64_t value, int64_t divisor) {
+  const int64_t quotient = value / divisor;
+  return ((value % divisor) != 0) && (value < 0) ? quotient - 1 : quotient;
+}
+
+// Proleptic Gregorian calendar conversions (H. Hinnant, "chrono-Compatible
+// Low-Level Date Algorithms").
+int64_t daysFromCivil(int64_t year, unsigned month, unsigned day) {
+  year -= month <= 2U ? 1 : 0;
+  const int64_t era = floorDiv(year, 400);
+  const int64_t yoe = year - era * 400;
+  const int64_t doy = (153 * (month > 2U ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+void civilFromDays(int64_t days, int64_t& year, unsigned& month, unsigned& day) {
+  days += 719468;
+  const int64_t era = floorDiv(days, 146097);
+  const int64_t doe = days - era * 146097;
+  const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const int64_t mp = (5 * doy + 2) / 153;
+  day = static_cast<unsigned>(doy - (153 * mp + 2) / 5 + 1);
+  month = static_cast<unsigned>(mp < 10 ? mp + 3 : mp - 9);
+  year = yoe + era * 400 + (month <= 2U ? 1 : 0);
+}
+
+unsigned daysInMonth(int64_t year, unsigned month) {
+  static const uint8_t DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (month == 2U) {
+    const bool leap = ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+    return leap ? 29U : 28U;
+  }
+  return DAYS[month - 1U];
+}
+
+static inline bool isBlank(char c) {
+  return (c == ' ') || (c == '\t');
+}
+
+bool parseNumber(const char*& p, unsigned& value) {
+  if ((*p < '0') || (*p > '9')) {
+    return false;
+  }
+  value = 0U;
+  while ((*p >= '0') && (*p <= '9')) {
+    value = value * 10U + static_cast<unsigned>(*p - '0');
+    if (value > 99U) {
+      return false;
+    }
+    ++p;
+  }
+  return true;
+}
+
+// One field: comma-separated items of '*', 'a' or 'a-b', each with an
+// optional '/step'.
+bool parseField(const char*& p, const FieldRange& range, uint64_t& mask) {
+  mask = 0U;
+  for (;;) {
+    unsigned first = range.lo;
+    unsigned last = range.hi;
+    bool single = false;
+    if (*p == '*') {
+      ++p;
+    } else {
+      if (!parseNumber(p, first)) {
+        return false;
+      }
+      last = first;
+      single = true;
+      if (*p == '-') {
+        ++p;
+        if (!parseNumber(p, last)) {
+          return false;
+        }
+        single = false;
+      }
+    }
+    unsigned step = 1U;
+    if (*p == '/') {
+      ++p;
+      if (!parseNumber(p, step) || (step == 0U)) {
+        return false;
+      }
+      if (single) {
+        last = range.hi;
+      }
+    }
+    if ((first < range.lo) || (last > range.hi) || (first > last)) {
+      return false;
+    }
+    for (unsigned v = first; v <= last; v += step) {
+      mask |= 1ULL << v;
+    }
+    if (*p != ',') {
+      return (*p == '\0') || isBlank(*p);
+    }
+    ++p;
+  }
+}
+
+}  // namespace
+
+// ===========================================================================
+// CronSchedule
+// ===========================================================================
+
+CronSchedule::CronSchedule()
+    : _minutes(0U), _days(0U), _hours(0U), _months(0U), _weekdays(0U), _dayStar(false),
+      _weekdayStar(false), _valid(false) {}
+
+Status CronSchedule::parse(const char* expression) {
+  if (expression == nullptr) {
+    return Status(Err::INVALID_CONFIG, 0, "Cron expression is null");
+  }
+  const char* p = expression;
+  while (isBlank(*p)) {
+    ++p;
+  }
+  if (*p == '@') {
+    size_t length = 0U;
+    while ((p[length] != '\0') && !isBlank(p[length])) {
+      ++length;
+    }
+    const char* rest = p + length;
+    while (isBlank(*rest)) {
+      ++rest;
+    }
+    for (const Macro& macro : MACROS) {
+      if ((*rest == '\0') && (strlen(macro.name) == length) &&
+          (strncmp(macro.name, p, length) == 0)) {
+        return parse(macro.expression);
+      }
+    }
+    return Status(Err::INVALID_CONFIG, 0, "Unknown cron macro");
+  }
+
+  uint64_t masks[FIELD_COUNT];
+  bool stars[FIELD_COUNT];
+  for (int i = 0; i < FIELD_COUNT; ++i) {
+    while (isBlank(*p)) {
+      ++p;
+    }
+    if (*p == '\0') {
+      return Status(Err::INVALID_CONFIG, i + 1, "Cron expression needs five fields");
+    }
+    stars[i] = (*p == '*');
+    if (!parseField(p, FIELD_RANGES[i], masks[i])) {
+      return Status(Err::INVALID_CONFIG, i + 1, "Bad cron field");
+    }
+  }
+  while (isBlank(*p)) {
+    ++p;
+  }
+  if (*p != '\0') {
+    return Status(Err::INVALID_CONFIG, FIELD_COUNT + 1, "Text after the fifth cron field");
+  }
+
+  // Unless day-of-month and weekday are OR-ed, some selected month must be
+  // long enough for a selected day (February counts as 29 days).
+  if (!stars[2] && stars[4]) {
+    bool reachable = false;
+    for (unsigned month = 1U; month <= 12U; ++month) {
+      const unsigned longest = month == 2U ? 29U : daysInMonth(2001, month);
+      const uint64_t monthDays = ((1ULL << longest) - 1U) << 1;
+      if (((masks[3] >> month) & 1U) && ((masks[2] & monthDays) != 0U)) {
+        reachable = true;
+      }
+    }
+    if (!reachable) {
+      return Status(Err::INVALID_CONFIG, 3, "Schedule never fires");
+    }
+  }
+
+  _minutes = masks[0];
+  _hours = static_cast<uint32_t>(masks[1]);
+  _days = masks[2];
+  _months = static_cast<uint16_t>(masks[3]);
+  _weekdays = static_cast<uint8_t>((masks[4] | (masks[4] >> 7)) & 0x7FU);  // 7 is Sunday
+  _dayStar = stars[2];
+  _weekdayStar = stars[4];
+  _valid = true;
+  return Ok();
+}
+
+uint64_t CronSchedule::dayMask(int64_t year, unsigned month) const {
+  const uint64_t monthDays = ((1ULL << daysInMonth(year, month)) - 1U) << 1;  // bits 1..len
+  // Rotate the weekday set so bit k means "day k + 1 of this month", then
+  // repeat it over five weeks. 1970-01-01 was a Thursday (4).
+  const int64_t firstDay = daysFromCivil(year, month, 1U);
+  const unsigned first = static_cast<unsigned>(firstDay - floorDiv(firstDay + 4, 7) * 7 + 4);
+  const uint64_t week = ((static_cast<uint64_t>(_weekdays) >> first) |
+                         (static_cast<uint64_t>(_weekdays) << (7U - first))) & 0x7FU;
+  const uint64_t byWeekday =
+      ((week | (week << 7) | (week << 14) | (week << 21) | (week << 28)) << 1) & monthDays;
+  const uint64_t byDay = _days & monthDays;
+  return (_dayStar || _weekdayStar) ? (byDay & byWeekday) : (byDay | byWeekday);
+}
+
+int64_t CronSchedule::nextAfter(int64_t wallUs) const {
+  if (!_valid) {
+    return DEADLINE_NONE;
+  }
+  const int64_t startMinute = floorDiv(wallUs, US_PER_MINUTE) + 1;
+  const int64_t startDay = floorDiv(startMinute, MINUTES_PER_DAY);
+  const unsigned minuteOfDay = static_cast<unsigned>(startMinute - startDay * MINUTES_PER_DAY);
+  int64_t year = 0;
+  unsigned month = 1U;
+  unsigned day = 1U;
+  civilFromDays(startDay, year, month, day);
+  unsigned hour = minuteOfDay / 60U;
+  unsigned minute = minuteOfDay % 60U;
+  const int64_t lastYear = year + SEARCH_YEARS;
+
+  // Each step either accepts the current field value or moves to the next
+  // candidate of a larger field, resetting the smaller ones.
+  while (year <= lastYear) {
+    const int m = nextBit(_months, month);
+    if (m < 0) {
+      ++year;
+      month = 1U;
+      day = 1U;
+      hour = 0U;
+      minute = 0U;
+      continue;
+    }
+    if (static_cast<unsigned>(m) != month) {
+      month = static_cast<unsigned>(m);
+      day = 1U;
+      hour = 0U;
+      minute = 0U;
+    }
+    const int d = nextBit(dayMask(year, month), day);
+    if (d < 0) {
+      ++month;  // 13 finds no month bit and rolls the year
+      day = 1U;
+      hour = 0U;
+      minute = 0U;
+      continue;
+    }
+    if (static_cast<unsigned>(d) != day) {
+      day = static_cast<unsigned>(d);
+      hour = 0U;
+      minute = 0U;
+    }
+    const int h = nextBit(_hours, hour);
+    if (h < 0) {
+      ++day;  // past the month end finds no day bit and rolls the month
+      hour = 0U;
+      minute = 0U;
+      continue;
+    }
+    if (static_cast<unsigned>(h) != hour) {
+      hour = static_cast<unsigned>(h);
+      minute = 0U;
+    }
+    const int mi = nextBit(_minutes, minute);
+    if (mi < 0) {
+      ++hour;  // 24 finds no hour bit and rolls the day
+      minute = 0U;
+      continue;
+    }
+    const int64_t minutes = daysFromCivil(year, month, day) * MINUTES_PER_DAY +
+                            static_cast<int64_t>(hour) * 60 + mi;
+    return detail::saturatingMul(minutes, US_PER_MINUTE);
+  }
+  return DEADLINE_NONE;
+}
+
+// ===========================================================================
+// CronTimer
+// ===========================================================================
+
+CronTimer::CronTimer(DeadlineRegistry* registry)
+    : _deadline(registry), _schedule(), _wallOffsetUs(0) {}
+
+Status CronTimer::startAt(int64_t nowUs, const CronSchedule& schedule, int64_t wallOffsetUs) {
+  if (!schedule.valid()) {
+    return Status(Err::INVALID_CONFIG, 0, "Cron schedule not parsed");
+  }
+  _schedule = schedule;
+  _wallOffsetUs = wallOffsetUs;
+  return arm(nowUs);
+}
+
+Status CronTimer::start(const CronSchedule& schedule, int64_t wallOffsetUs) {
+  return startAt(micros64(), schedule, wallOffsetUs);
+}
+
+Status CronTimer::rebaseAt(int64_t nowUs, int64_t wallOffsetUs) {
+  return startAt(nowUs, _schedule, wallOffsetUs);
+}
+
+bool CronTimer::poll() {
+  return pollAt(micros64());
+}
+
+bool CronTimer::pollAt(int64_t nowUs) {
+  if (!_deadline.expiredAt(nowUs)) {
+    return false;
+  }
+  (void)arm(nowUs);  // re-arming in place never fails
+  return true;
+}
+
+Status CronTimer::arm(int64_t nowUs) {
+  const int64_t next = _schedule.nextAfter(detail::saturatingAdd(nowUs, _wallOffsetUs));
+  if (next == DEADLINE_NONE) {
+    _deadline.cancel();
+    return Status(Err::INVALID_CONFIG, 0, "No cron firing ahead");
+  }
+  return _deadline.armAt(detail::saturatingSub(next, _wallOffsetUs));
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,250 @@
+/**
+ * @file CycleClock.cpp
+ * @brief Implementation of the cycle-counter clock.
+ */
+
+#include "SystemChrono/CycleClock.h"
+
+#include <atomic>
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/VirtualClock.h"
+
+#if !defined(ARDUINO_ARCH_ESP32) && (defined(__x86_64__) || defined(__i386__))
+  #include <x86intrin.h>
+#endif
+
+namespace SystemChrono {
+
+namespace {
+
+// ===========================================================================
+// Internal: Platform cycle counter
+// ===========================================================================
+
+#if defined(ARDUINO_ARCH_ESP32)
+static constexpr bool HAS_CYCLE_COUNTER = true;
+
+// Per-core extension word. Bit 31 mirrors bit 31 of the last CCOUNT seen on
+// that core; bits 0..30 count wraps (Linux cnt32_to_63 scheme).
+static volatile uint32_t g_counterHi[portNUM_PROCESSORS];
+
+static inline uint64_t readCycles() {
+  volatile uint32_t& hiSlot = g_counterHi[xPortGetCoreID()];
+  uint32_t hi = hiSlot;
+  std::atomic_signal_fence(std::memory_order_acquire);  // read hi before the counter
+  const uint32_t lo = ESP.getCycleCount();
+  if (static_cast<int32_t>(hi ^ lo) < 0) {
+    // Top bits disagree: the counter crossed a half period since hi was stored.
+    hi = (hi ^ 0x80000000UL) + (hi >> 31);
+    hiSlot = hi;
+  }
+  return (static_cast<uint64_t>(hi & 0x7FFFFFFFUL) << 32) | static_cast<uint64_t>(lo);
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+static constexpr bool HAS_CYCLE_COUNTER = true;
+
+static inline uint64_t readCycles() {
+  return static_cast<uint64_t>(__rdtsc());
+}
+
+#elif defined(__aarch64__)
+static constexpr bool HAS_CYCLE_COUNTER = true;
+
+static inline uint64_t readCycles() {
+  uint64_t value = 0;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(value) : : "memory");
+  return value;
+}
+
+#else
+// No portable cycle counter: count microseconds (1 MHz).
+static constexpr bool HAS_CYCLE_COUNTER = false;
+
+static inline uint64_t readCycles() {
+  return static_cast<uint64_t>(micros64());
+}
+#endif
+
+// ===========================================================================
+// Internal: Calibration state (seqlock, single writer)
+// ===========================================================================
+
+static constexpr uint32_t MIN_WINDOW_US = 1000U;
+static constexpr uint32_t MAX_WINDOW_US = 1000000U;
+
+struct CycleState {
+  uint64_t baseCycles;  // cycles64() at the anchor
+  int64_t baseNs;       // micros64() * 1000 at the anchor
+  uint64_t hz;          // 0 = not calibrated
+  uint32_t mult;        // ns = (cycles * mult) >> shift
+  uint8_t shift;
+};
+
+CycleState g_state = {0U, 0, 0U, 0U, 0U};
+std::atomic<uint32_t> g_stateSeq(0U);
+
+static CycleState loadState() {
+  CycleState copy;
+  for (;;) {
+    const uint32_t before = g_stateSeq.load(std::memory_order_acquire);
+    if ((before & 1U) != 0U) {
+      continue;
+    }
+    copy = g_state;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (g_stateSeq.load(std::memory_order_relaxed) == before) {
+      return copy;
+    }
+  }
+}
+
+static void storeState(const CycleState& state) {
+  const uint32_t seq = g_stateSeq.load(std::memory_order_relaxed);
+  g_stateSeq.store(seq + 1U, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  g_state = state;
+  g_stateSeq.store(seq + 2U, std::memory_order_release);
+}
+
+// Largest shift whose multiplier still fits 32 bits (best precision).
+static void computeMultShift(uint64_t hz, uint32_t& mult, uint8_t& shift) {
+  for (uint8_t s = 32U; s > 0U; --s) {
+    const uint64_t m = ((1000000000ULL << s) + (hz / 2U)) / hz;
+    if (m <= 0xFFFFFFFFULL) {
+      mult = static_cast<uint32_t>(m);
+      shift = s;
+      return;
+    }
+  }
+  mult = 0U;
+  shift = 0U;
+}
+
+// 64x32 multiply split in halves so long cycle spans cannot overflow.
+static inline int64_t scaleCycles(uint64_t cycles, uint32_t mult, uint8_t shift) {
+  const uint64_t high = (cycles >> 32) * mult;
+  const uint64_t low = ((cycles & 0xFFFFFFFFULL) * mult) >> shift;
+  return static_cast<int64_t>((high << (32U - shift)) + low);
+}
+
+struct FrequencySample {
+  uint64_t hz;
+  uint64_t endCycles;
+  int64_t endUs;
+};
+
+static FrequencySample measureFrequency(uint32_t windowUs) {
+  // Start right after a micros64() tick so both window edges see the same phase.
+  const int64_t edge = micros64();
+  int64_t startUs = edge;
+  while (startUs == edge) {
+    startUs = micros64();
+  }
+  const uint64_t startCycles = cycles64();
+
+  int64_t endUs = startUs;
+  while ((endUs - startUs) < static_cast<int64_t>(windowUs)) {
+    endUs = micros64();
+  }
+  const uint64_t endCycles = cycles64();
+
+  FrequencySample sample;
+  sample.hz = ((endCycles - startCycles) * 1000000ULL) / static_cast<uint64_t>(endUs - startUs);
+  sample.endCycles = endCycles;
+  sample.endUs = endUs;
+  return sample;
+}
+
+}  // namespace
+
+// ===========================================================================
+// Public API
+// ===========================================================================
+
+bool hasCycleCounter() {
+  return HAS_CYCLE_COUNTER;
+}
+
+uint64_t cycles64() {
+  return readCycles();
+}
+
+int64_t nanos64() {
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+  if (isVirtualClockEnabled()) {
+    return micros64() * 1000LL;
+  }
+#endif
+  const CycleState state = loadState();
+  if (state.hz == 0U) {
+    return micros64() * 1000LL;
+  }
+  return state.baseNs + scaleCycles(readCycles() - state.baseCycles, state.mult, state.shift);
+}
+
+Status calibrateCycleClock(uint32_t windowUs) {
+  if ((windowUs < MIN_WINDOW_US) || (windowUs > MAX_WINDOW_US)) {
+    return Status(Err::INVALID_CONFIG, static_cast<int32_t>(windowUs),
+                  "Calibration window out of range");
+  }
+
+  const FrequencySample sample = measureFrequency(windowUs);
+  if (sample.hz == 0U) {
+    return Status(Err::HARDWARE_FAULT, 0, "Cycle counter did not advance");
+  }
+
+  CycleState state;
+  state.baseCycles = sample.endCycles;
+  state.baseNs = sample.endUs * 1000LL;
+  state.hz = sample.hz;
+  computeMultShift(sample.hz, state.mult, state.shift);
+  if (state.shift == 0U) {
+    return Status(Err::HARDWARE_FAULT, 0, "Cycle counter frequency out of range");
+  }
+  storeState(state);
+  return Ok();
+}
+
+uint64_t cycleClockHz() {
+  return loadState().hz;
+}
+
+int64_t cyclesToNanos(uint64_t cycles) {
+  const CycleState state = loadState();
+  if (state.hz == 0U) {
+    return 0;
+  }
+  return scaleCycles(cycles, state.mult, state.shift);
+}
+
+Status checkCycleClockDrift(uint32_t windowUs, uint32_t tolerancePpm, CycleClockDrift& out) {
+  const uint64_t calibratedHz = cycleClockHz();
+  if (calibratedHz == 0U) {
+    return Status(Err::NOT_INITIALIZED, 0, "Cycle clock not calibrated");
+  }
+  if ((windowUs < MIN_WINDOW_US) || (windowUs > MAX_WINDOW_US)) {
+    return Status(Err::INVALID_CONFIG, static_cast<int32_t>(windowUs),
+                  "Calibration window out of range");
+  }
+
+  const FrequencySample sample = measureFrequency(windowUs);
+  const int64_t diffHz = static_cast<int64_t>(sample.hz) - static_cast<int64_t>(calibratedHz);
+  int64_t ppm = (diffHz * 1000000LL) / static_cast<int64_t>(calibratedHz);
+  if (ppm > INT32_MAX) {
+    ppm = INT32_MAX;
+  } else if (ppm < INT32_MIN) {
+    ppm = INT32_MIN;
+  }
+
+  out = CycleClockDrift();
+  out.calibratedHz = calibratedHz;
+  out.measuredHz = sample.hz;
+  out.errorPpm = static_cast<int32_t>(ppm);
+  out.drifted = (ppm > static_cast<int64_t>(tolerancePpm)) ||
+                (-ppm > static_cast<int64_t>(tolerancePpm));
+  return Ok();
+}
+
+}  // namespace SystemChrono
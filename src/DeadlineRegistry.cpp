@@ -0,0 +1,244 @@
+/**
+ * @file DeadlineRegistry.cpp
+ * @brief Implementation of Deadline, Interval and the deadline min-heap.
+ */
+
+#include "SystemChrono/DeadlineRegistry.h"
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr uint32_t NO_SLOT = 0xFFFFFFFFU;
+static constexpr size_t MAX_CAPACITY = 0x7FFFFFFFU;
+
+}  // namespace
+
+// ===========================================================================
+// Deadline
+// ===========================================================================
+
+Deadline::Deadline(DeadlineRegistry* registry)
+    : _registry(registry), _dueUs(DEADLINE_NONE), _slot(NO_SLOT) {}
+
+Deadline::~Deadline() {
+  cancel();
+}
+
+Status Deadline::armAt(int64_t dueUs) {
+  if (dueUs == DEADLINE_NONE) {
+    dueUs = DEADLINE_NONE - 1;  // DEADLINE_NONE marks "disarmed"
+  }
+  if (_registry == nullptr) {
+    _dueUs = dueUs;
+    return Ok();
+  }
+  if (_slot != NO_SLOT) {
+    const int64_t previous = _dueUs;
+    _dueUs = dueUs;
+    _registry->update(this, previous);
+    return Ok();
+  }
+  _dueUs = dueUs;
+  if (!_registry->insert(this)) {
+    _dueUs = DEADLINE_NONE;
+    return Status(Err::OUT_OF_MEMORY, static_cast<int32_t>(_registry->capacity()),
+                  "Deadline registry full");
+  }
+  return Ok();
+}
+
+Status Deadline::armIn(int64_t durationUs) {
+  return armAt(detail::saturatingAdd(micros64(), durationUs));
+}
+
+void Deadline::cancel() {
+  if ((_registry != nullptr) && (_slot != NO_SLOT)) {
+    _registry->remove(this);
+  }
+  _dueUs = DEADLINE_NONE;
+}
+
+void Deadline::attach(DeadlineRegistry* registry) {
+  cancel();
+  _registry = registry;
+}
+
+bool Deadline::expired() const {
+  return expiredAt(micros64());
+}
+
+bool Deadline::expiredAt(int64_t nowUs) const {
+  return armed() && (nowUs >= _dueUs);
+}
+
+bool Deadline::poll() {
+  return pollAt(micros64());
+}
+
+bool Deadline::pollAt(int64_t nowUs) {
+  if (!expiredAt(nowUs)) {
+    return false;
+  }
+  cancel();
+  return true;
+}
+
+int64_t Deadline::remainingAt(int64_t nowUs) const {
+  if (!armed()) {
+    return DEADLINE_NONE;
+  }
+  return nowUs >= _dueUs ? 0 : _dueUs - nowUs;
+}
+
+// ===========================================================================
+// Interval
+// ===========================================================================
+
+Interval::Interval(DeadlineRegistry* registry) : _deadline(registry), _periodUs(0), _missed(0U) {}
+
+Status Interval::start(int64_t periodUs) {
+  return startAt(micros64(), periodUs);
+}
+
+Status Interval::startAt(int64_t nowUs, int64_t periodUs) {
+  if (periodUs <= 0) {
+    return Status(Err::INVALID_CONFIG, 0, "Interval period must be positive");
+  }
+  _periodUs = periodUs;
+  _missed = 0U;
+  return _deadline.armAt(detail::saturatingAdd(nowUs, periodUs));
+}
+
+bool Interval::poll() {
+  return pollAt(micros64());
+}
+
+bool Interval::pollAt(int64_t nowUs) {
+  if (!_deadline.expiredAt(nowUs)) {
+    return false;
+  }
+  // Next grid point strictly after nowUs; re-arming in place never fails.
+  const int64_t behind = (nowUs - _deadline.dueUs()) / _periodUs;
+  _missed += static_cast<uint32_t>(behind);
+  (void)_deadline.armAt(
+      detail::saturatingAdd(_deadline.dueUs(), detail::saturatingMul(behind + 1, _periodUs)));
+  return true;
+}
+
+// ===========================================================================
+// DeadlineRegistry
+// ===========================================================================
+
+DeadlineRegistry::DeadlineRegistry() : _heap(nullptr), _capacity(0U), _size(0U), _slackUs(0U) {}
+
+Status DeadlineRegistry::begin(Deadline** storage, size_t capacity,
+                               const DeadlineRegistryConfig& config) {
+  if ((storage == nullptr) || (capacity == 0U) || (capacity > MAX_CAPACITY)) {
+    return Status(Err::INVALID_CONFIG, 0, "Registry storage is null, empty or too large");
+  }
+  if (_size != 0U) {
+    return Status(Err::RESOURCE_BUSY, static_cast<int32_t>(_size), "Timers still armed");
+  }
+  _heap = storage;
+  _capacity = static_cast<uint32_t>(capacity);
+  _slackUs = config.slackUs;
+  return Ok();
+}
+
+int64_t DeadlineRegistry::nextWakeUs() const {
+  if (_size == 0U) {
+    return DEADLINE_NONE;
+  }
+  return detail::saturatingAdd(_heap[0]->_dueUs, static_cast<int64_t>(_slackUs));
+}
+
+int64_t DeadlineRegistry::idleForAt(int64_t nowUs) const {
+  const int64_t wake = nextWakeUs();
+  if (wake == DEADLINE_NONE) {
+    return DEADLINE_NONE;
+  }
+  return wake > nowUs ? wake - nowUs : 0;
+}
+
+int64_t DeadlineRegistry::idleFor() const {
+  return idleForAt(micros64());
+}
+
+bool DeadlineRegistry::insert(Deadline* deadline) {
+  if (_size >= _capacity) {
+    return false;
+  }
+  const uint32_t slot = _size++;
+  place(slot, deadline);
+  siftUp(slot);
+  return true;
+}
+
+void DeadlineRegistry::remove(Deadline* deadline) {
+  const uint32_t slot = deadline->_slot;
+  deadline->_slot = NO_SLOT;
+  --_size;
+  if (slot == _size) {
+    return;
+  }
+  // Move the last entry into the hole and restore order in whichever
+  // direction it violates.
+  Deadline* last = _heap[_size];
+  place(slot, last);
+  if ((slot > 0U) && (last->_dueUs < _heap[(slot - 1U) / 2U]->_dueUs)) {
+    siftUp(slot);
+  } else {
+    siftDown(slot);
+  }
+}
+
+void DeadlineRegistry::update(Deadline* deadline, int64_t previousDueUs) {
+  if (deadline->_dueUs < previousDueUs) {
+    siftUp(deadline->_slot);
+  } else if (deadline->_dueUs > previousDueUs) {
+    siftDown(deadline->_slot);
+  }
+}
+
+void DeadlineRegistry::siftUp(uint32_t slot) {
+  Deadline* moving = _heap[slot];
+  while (slot > 0U) {
+    const uint32_t parent = (slot - 1U) / 2U;
+    if (_heap[parent]->_dueUs <= moving->_dueUs) {
+      break;
+    }
+    place(slot, _heap[parent]);
+    slot = parent;
+  }
+  place(slot, moving);
+}
+
+void DeadlineRegistry::siftDown(uint32_t slot) {
+  Deadline* moving = _heap[slot];
+  for (;;) {
+    uint32_t child = 2U * slot + 1U;
+    if (child >= _size) {
+      break;
+    }
+    if ((child + 1U < _size) && (_heap[child + 1U]->_dueUs < _heap[child]->_dueUs)) {
+      ++child;
+    }
+    if (moving->_dueUs <= _heap[child]->_dueUs) {
+      break;
+    }
+    place(slot, _heap[child]);
+    slot = child;
+  }
+  place(slot, moving);
+}
+
+void DeadlineRegistry::place(uint32_t slot, Deadline* deadline) {
+  _heap[slot] = deadline;
+  deadline->_slot = slot;
+}
+
+}  // namespace SystemChrono
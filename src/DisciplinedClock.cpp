@@ -0,0 +1,207 @@
+/**
+ * @file DisciplinedClock.cpp
+ * @brief Implementation of the PI/FLL clock discipline loop.
+ */
+
+#include "SystemChrono/DisciplinedClock.h"
+
+#include "SystemChrono/SystemChrono.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr uint8_t Q = 32U;
+static constexpr int64_t PPM_Q32 = (1LL << Q) / 1000000LL;
+// Re-anchor before (local - anchor) * rate can overflow: 2^32 us is ~71 min.
+static constexpr int64_t MAX_ANCHOR_SPAN_US = 1LL << 32;
+// Phase errors are clamped before shifting into Q32.
+static constexpr int64_t MAX_PHASE_US = 1LL << 30;
+
+static inline int64_t clamp64(int64_t value, int64_t lo, int64_t hi) {
+  return value < lo ? lo : (value > hi ? hi : value);
+}
+
+/// (numeratorUs / denominatorUs) as Q32, numerator clamped to MAX_PHASE_US.
+/// The numerator is usually negative, so it is multiplied (a signed left
+/// shift is undefined before C++20); 2^30 * 2^32 still fits.
+static inline int64_t ratioQ32(int64_t numeratorUs, int64_t denominatorUs) {
+  return clamp64(numeratorUs, -MAX_PHASE_US, MAX_PHASE_US) * (1LL << Q) / denominatorUs;
+}
+
+static inline int32_t q32ToPpb(int64_t q32) {
+  return static_cast<int32_t>((q32 * 1000000000LL) >> Q);
+}
+
+}  // namespace
+
+DisciplinedClock::DisciplinedClock()
+    : _anchorLocalUs(0),
+      _anchorCorrectedUs(0),
+      _rateQ32(0),
+      _frequencyQ32(0),
+      _lastCorrectedUs(0),
+      _firstLocalUs(0),
+      _firstReferenceUs(0),
+      _lastSampleLocalUs(0),
+      _lastOffsetUs(0),
+      _samples(0U),
+      _initialized(false),
+      _holdover(false),
+      _read(false) {}
+
+Status DisciplinedClock::begin(const DisciplinedClockConfig& config) {
+  if ((config.phaseShift > 16U) || (config.frequencyShift > 16U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Loop gain shift exceeds 16");
+  }
+  if (config.acquireSamples == 0U) {
+    return Status(Err::INVALID_CONFIG, 0, "acquireSamples must be at least 1");
+  }
+  if ((config.maxFrequencyPpm == 0U) || (config.maxFrequencyPpm > 1000U) ||
+      (config.maxSlewPpm == 0U) || (config.maxSlewPpm > 1000U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Frequency and slew limits must be 1..1000 ppm");
+  }
+  if (config.holdoverAfterUs == 0U) {
+    return Status(Err::INVALID_CONFIG, 0, "holdoverAfterUs must be non-zero");
+  }
+  _config = config;
+  const int64_t now = readLocal();
+  _anchorLocalUs = now;
+  _anchorCorrectedUs = now;
+  _rateQ32 = 0;
+  _frequencyQ32 = 0;
+  _lastCorrectedUs = now;
+  _firstLocalUs = 0;
+  _firstReferenceUs = 0;
+  _lastSampleLocalUs = 0;
+  _lastOffsetUs = 0;
+  _samples = 0U;
+  _holdover = false;
+  _read = false;
+  _initialized = true;
+  return Ok();
+}
+
+int64_t DisciplinedClock::readLocal() const {
+  return (_config.clock != nullptr) ? _config.clock() : micros64();
+}
+
+int64_t DisciplinedClock::toCorrected(int64_t localUs) const {
+  const int64_t d = localUs - _anchorLocalUs;
+  return _anchorCorrectedUs + d + ((d * _rateQ32) >> Q);
+}
+
+void DisciplinedClock::reanchor(int64_t localUs) {
+  _anchorCorrectedUs = toCorrected(localUs);
+  _anchorLocalUs = localUs;
+}
+
+// Switch to holdover at the exact instant it became due, so the rate change
+// does not depend on when the clock happens to be read.
+void DisciplinedClock::updateHoldover(int64_t nowUs) {
+  if (_holdover || (_samples == 0U) ||
+      (nowUs - _lastSampleLocalUs <= static_cast<int64_t>(_config.holdoverAfterUs))) {
+    return;
+  }
+  int64_t switchUs = _lastSampleLocalUs + static_cast<int64_t>(_config.holdoverAfterUs);
+  if (switchUs < _anchorLocalUs) {
+    switchUs = _anchorLocalUs;
+  }
+  reanchor(switchUs);
+  _rateQ32 = _frequencyQ32;
+  _holdover = true;
+}
+
+Status DisciplinedClock::addSample(int64_t localUs, int64_t referenceUs) {
+  if (!_initialized) {
+    return Status(Err::NOT_INITIALIZED, 0, "DisciplinedClock not initialized");
+  }
+  const int64_t now = readLocal();
+  if (localUs > now) {
+    return Status(Err::INVALID_CONFIG, 0, "Sample is in the future");
+  }
+  if ((_samples != 0U) && (localUs <= _lastSampleLocalUs)) {
+    return Status(Err::INVALID_CONFIG, 1, "Samples must be in local-time order");
+  }
+  updateHoldover(now);
+
+  const int64_t offsetUs = referenceUs - toCorrected(localUs);
+  if (_samples == 0U) {
+    _firstLocalUs = localUs;
+    _firstReferenceUs = referenceUs;
+    if ((offsetUs >= 0) || !_read) {
+      _anchorCorrectedUs += offsetUs;  // initial phase alignment
+    }
+    reanchor(now);
+  } else {
+    const int64_t dtUs = localUs - _lastSampleLocalUs;
+    const int64_t maxFreq = static_cast<int64_t>(_config.maxFrequencyPpm) * PPM_Q32;
+    const int64_t maxSlew = static_cast<int64_t>(_config.maxSlewPpm) * PPM_Q32;
+    const int64_t errorQ32 = ratioQ32(offsetUs, dtUs);
+    const int64_t phaseQ32 = errorQ32 >> _config.phaseShift;
+    const bool slewSaturated = (phaseQ32 > maxSlew) || (phaseQ32 < -maxSlew);
+
+    if (_samples < _config.acquireSamples) {
+      // FLL: frequency over the whole span measured so far.
+      const int64_t spanUs = localUs - _firstLocalUs;
+      _frequencyQ32 = ratioQ32((referenceUs - _firstReferenceUs) - spanUs, spanUs);
+    } else if (!slewSaturated) {
+      // Anti-windup: a large phase error is worked off by the slew alone.
+      _frequencyQ32 += errorQ32 >> _config.frequencyShift;
+    }
+    _frequencyQ32 = clamp64(_frequencyQ32, -maxFreq, maxFreq);
+
+    reanchor(now);
+    _rateQ32 = _frequencyQ32 + clamp64(phaseQ32, -maxSlew, maxSlew);
+  }
+
+  _holdover = false;
+  _lastSampleLocalUs = localUs;
+  _lastOffsetUs = offsetUs;
+  ++_samples;
+  return Ok();
+}
+
+int64_t DisciplinedClock::correctedMicros64() {
+  if (!_initialized) {
+    return micros64();
+  }
+  const int64_t now = readLocal();
+  updateHoldover(now);
+  if (now - _anchorLocalUs > MAX_ANCHOR_SPAN_US) {
+    reanchor(now);
+  }
+  int64_t corrected = toCorrected(now);
+  if (corrected < _lastCorrectedUs) {
+    corrected = _lastCorrectedUs;  // absorbs 1 us rounding at re-anchors
+  }
+  _lastCorrectedUs = corrected;
+  _read = true;
+  return corrected;
+}
+
+DisciplineState DisciplinedClock::state() const {
+  if (!_initialized || (_samples == 0U)) {
+    return DisciplineState::UNSYNCHRONIZED;
+  }
+  if (_holdover ||
+      (readLocal() - _lastSampleLocalUs > static_cast<int64_t>(_config.holdoverAfterUs))) {
+    return DisciplineState::HOLDOVER;
+  }
+  return (_samples < _config.acquireSamples) ? DisciplineState::ACQUIRING
+                                             : DisciplineState::LOCKED;
+}
+
+DisciplineTelemetry DisciplinedClock::telemetry() const {
+  DisciplineTelemetry t;
+  t.state = state();
+  t.samples = _samples;
+  t.lastOffsetUs = _lastOffsetUs;
+  t.frequencyPpb = q32ToPpb(_frequencyQ32);
+  // In a pending (not yet applied) holdover the effective rate is the frequency.
+  t.rateAdjustPpb = q32ToPpb(t.state == DisciplineState::HOLDOVER ? _frequencyQ32 : _rateQ32);
+  t.sinceSampleUs = (_initialized && (_samples != 0U)) ? readLocal() - _lastSampleLocalUs : 0;
+  return t;
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,141 @@
+/**
+ * @file EventMerger.cpp
+ * @brief Implementation of the k-way event merge.
+ */
+
+#include "SystemChrono/EventMerger.h"
+
+#include "SystemChrono/detail/SaturatingMath.h"
+
+namespace SystemChrono {
+
+namespace {
+
+// Padding leaves and empty sources sort after every real event.
+static constexpr int64_t EMPTY_KEY = detail::INT64_MAX_VALUE;
+
+static inline uint8_t lowestBit(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint8_t>(__builtin_ctzll(mask));
+#else
+  uint8_t bit = 0U;
+  while ((mask & 1U) == 0U) {
+    mask >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+}  // namespace
+
+EventMerger::EventMerger()
+    : _sources(), _heads(), _tree(), _emptyMask(0U), _merged(0U), _lastUs(0), _late(0U),
+      _latenessUs(0U), _count(0U), _leaves(0U) {}
+
+Status EventMerger::begin(EventSource* const* sources, size_t count,
+                          const EventMergerConfig& config) {
+  if ((count == 0U) || (count > EVENT_MERGE_MAX_SOURCES) || (sources == nullptr)) {
+    return Status(Err::INVALID_CONFIG, static_cast<int32_t>(count),
+                  "Source count must be 1..EVENT_MERGE_MAX_SOURCES");
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (sources[i] == nullptr) {
+      return Status(Err::INVALID_CONFIG, static_cast<int32_t>(i), "Null event source");
+    }
+  }
+  uint8_t leaves = 1U;
+  while (leaves < count) {
+    leaves = static_cast<uint8_t>(leaves << 1);
+  }
+  _count = static_cast<uint8_t>(count);
+  _leaves = leaves;
+  _latenessUs = config.latenessUs;
+  for (uint8_t i = 0U; i < leaves; ++i) {
+    _sources[i] = i < count ? sources[i] : nullptr;
+    _heads[i] = TimedEvent();
+    _heads[i].micros = EMPTY_KEY;
+    _heads[i].source = i;
+    _tree[leaves + i] = i;
+  }
+  for (uint8_t node = static_cast<uint8_t>(leaves - 1U); node != 0U; --node) {
+    _tree[node] = _tree[2U * node];  // all keys equal: the lower index wins
+  }
+  _emptyMask = count == 64U ? ~0ULL : ((1ULL << count) - 1U);
+  _merged = 0U;
+  _lastUs = detail::INT64_MIN_VALUE;
+  _late = 0U;
+  return Ok();
+}
+
+// Replay the matches on the path from one leaf to the root.
+void EventMerger::update(uint8_t leaf) {
+  for (size_t node = (_leaves + static_cast<size_t>(leaf)) >> 1; node != 0U; node >>= 1) {
+    const uint8_t a = _tree[2U * node];
+    const uint8_t b = _tree[2U * node + 1U];
+    const int64_t ka = _heads[a].micros;
+    const int64_t kb = _heads[b].micros;
+    _tree[node] = ((kb < ka) || ((kb == ka) && (b < a))) ? b : a;
+  }
+}
+
+void EventMerger::pollEmpty() {
+  uint64_t pending = _emptyMask;
+  while (pending != 0U) {
+    const uint8_t i = lowestBit(pending);
+    pending &= pending - 1U;
+    TimedEvent ev;
+    if (_sources[i]->next(ev)) {
+      ev.source = i;
+      _heads[i] = ev;
+      _emptyMask &= ~(1ULL << i);
+      update(i);
+    }
+  }
+}
+
+bool EventMerger::pop(int64_t nowUs, TimedEvent& out) {
+  if (_count == 0U) {
+    return false;
+  }
+  if (_emptyMask != 0U) {
+    pollEmpty();
+  }
+  // Ties go to the lower index, so the winner is never a padding leaf.
+  const uint8_t w = _tree[1];
+  if ((_emptyMask >> w) & 1U) {
+    return false;  // every source is empty
+  }
+  if ((_emptyMask != 0U) &&
+      (_heads[w].micros > detail::saturatingSub(nowUs, static_cast<int64_t>(_latenessUs)))) {
+    return false;  // an empty source may still deliver something older
+  }
+  out = _heads[w];
+  if (out.micros < _lastUs) {
+    ++_late;
+  } else {
+    _lastUs = out.micros;
+  }
+  ++_merged;
+
+  TimedEvent ev;
+  if (_sources[w]->next(ev)) {
+    ev.source = w;
+    _heads[w] = ev;
+  } else {
+    _heads[w].micros = EMPTY_KEY;
+    _emptyMask |= 1ULL << w;
+  }
+  update(w);
+  return true;
+}
+
+size_t EventMerger::drain(int64_t nowUs, TimedEvent* out, size_t capacity) {
+  size_t n = 0U;
+  while ((n < capacity) && pop(nowUs, out[n])) {
+    ++n;
+  }
+  return n;
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,237 @@
+/**
+ * @file Ewma.cpp
+ * @brief Implementation of the time-aware exponential averages.
+ */
+
+#include "SystemChrono/Ewma.h"
+
+#include "SystemChrono/SystemChrono.h"
+
+namespace SystemChrono {
+
+namespace {
+
+// log2(e) in Q56.
+static constexpr uint64_t LOG2E_Q56 = 103957133576908769ULL;
+static constexpr uint8_t TABLE_BITS = 8U;
+static constexpr uint64_t FRAC_MASK_Q56 = (1ULL << 56) - 1U;
+// (ln(2) / 256)^2 / 2 in Q32: curvature of 2^-f across one table cell.
+static constexpr uint64_t CELL_CURVE_Q32 = 15743U;
+// A shift of 32 or more clears a Q31 value.
+static constexpr int64_t ZERO_AFTER_TAUS = 22;
+
+// 2^(-i / 256) in Q31, i = 0..256.
+static const uint32_t POW2_NEG_Q31[(1U << TABLE_BITS) + 1U] = {
+    0x80000000U, 0x7FA765ADU, 0x7F4F08AEU, 0x7EF6E8DAU, 0x7E9F0606U, 0x7E476009U,
+    0x7DEFF6B6U, 0x7D98C9E6U, 0x7D41D96EU, 0x7CEB2523U, 0x7C94ACDEU, 0x7C3E7073U,
+    0x7BE86FBAU, 0x7B92AA88U, 0x7B3D20B6U, 0x7AE7D21AU, 0x7A92BE8BU, 0x7A3DE5DFU,
+    0x79E947EFU, 0x7994E492U, 0x7940BB9EU, 0x78ECCCECU, 0x78991854U, 0x78459DACU,
+    0x77F25CCEU, 0x779F5590U, 0x774C87CCU, 0x76F9F359U, 0x76A7980FU, 0x765575C8U,
+    0x76038C5BU, 0x75B1DBA2U, 0x75606374U, 0x750F23ABU, 0x74BE1C20U, 0x746D4CACU,
+    0x741CB528U, 0x73CC556DU, 0x737C2D55U, 0x732C3CBAU, 0x72DC8374U, 0x728D015DU,
+    0x723DB650U, 0x71EEA226U, 0x719FC4B9U, 0x71511DE4U, 0x7102AD80U, 0x70B47368U,
+    0x70666F76U, 0x7018A185U, 0x6FCB096FU, 0x6F7DA710U, 0x6F307A41U, 0x6EE382DEU,
+    0x6E96C0C3U, 0x6E4A33C9U, 0x6DFDDBCCU, 0x6DB1B8A8U, 0x6D65CA38U, 0x6D1A1057U,
+    0x6CCE8AE1U, 0x6C8339B2U, 0x6C381CA6U, 0x6BED3399U, 0x6BA27E65U, 0x6B57FCE9U,
+    0x6B0DAEFFU, 0x6AC39485U, 0x6A79AD56U, 0x6A2FF94FU, 0x69E6784DU, 0x699D2A2CU,
+    0x69540EC9U, 0x690B2601U, 0x68C26FB1U, 0x6879EBB6U, 0x683199EDU, 0x67E97A34U,
+    0x67A18C68U, 0x6759D065U, 0x6712460BU, 0x66CAED35U, 0x6683C5C3U, 0x663CCF92U,
+    0x65F60A7FU, 0x65AF766AU, 0x6569132FU, 0x6522E0ADU, 0x64DCDEC3U, 0x64970D4FU,
+    0x64516C2EU, 0x640BFB41U, 0x63C6BA64U, 0x6381A978U, 0x633CC85BU, 0x62F816EBU,
+    0x62B39509U, 0x626F4292U, 0x622B1F66U, 0x61E72B65U, 0x61A3666DU, 0x615FD05EU,
+    0x611C6919U, 0x60D9307BU, 0x60962665U, 0x60534AB7U, 0x60109D51U, 0x5FCE1E12U,
+    0x5F8BCCDBU, 0x5F49A98CU, 0x5F07B405U, 0x5EC5EC26U, 0x5E8451D0U, 0x5E42E4E3U,
+    0x5E01A53FU, 0x5DC092C7U, 0x5D7FAD59U, 0x5D3EF4D7U, 0x5CFE6923U, 0x5CBE0A1CU,
+    0x5C7DD7A4U, 0x5C3DD19CU, 0x5BFDF7E5U, 0x5BBE4A61U, 0x5B7EC8F2U, 0x5B3F7377U,
+    0x5B0049D4U, 0x5AC14BEAU, 0x5A82799AU, 0x5A43D2C6U, 0x5A055751U, 0x59C7071CU,
+    0x5988E209U, 0x594AE7FBU, 0x590D18D3U, 0x58CF7474U, 0x5891FAC1U, 0x5854AB9BU,
+    0x581786E6U, 0x57DA8C83U, 0x579DBC57U, 0x57611642U, 0x57249A29U, 0x56E847EFU,
+    0x56AC1F75U, 0x567020A0U, 0x56344B52U, 0x55F89F70U, 0x55BD1CDBU, 0x5581C378U,
+    0x55469329U, 0x550B8BD4U, 0x54D0AD5AU, 0x5495F7A1U, 0x545B6A8BU, 0x542105FDU,
+    0x53E6C9DAU, 0x53ACB607U, 0x5372CA68U, 0x533906E0U, 0x52FF6B55U, 0x52C5F7AAU,
+    0x528CABC3U, 0x52538786U, 0x521A8AD7U, 0x51E1B59AU, 0x51A907B4U, 0x5170810BU,
+    0x51382182U, 0x50FFE8FEU, 0x50C7D765U, 0x508FEC9CU, 0x50582888U, 0x50208B0EU,
+    0x4FE91413U, 0x4FB1C37CU, 0x4F7A9930U, 0x4F439514U, 0x4F0CB70CU, 0x4ED5FF00U,
+    0x4E9F6CD4U, 0x4E69006EU, 0x4E32B9B4U, 0x4DFC988CU, 0x4DC69CDDU, 0x4D90C68BU,
+    0x4D5B157EU, 0x4D25899CU, 0x4CF022CAU, 0x4CBAE0EFU, 0x4C85C3F1U, 0x4C50CBB8U,
+    0x4C1BF829U, 0x4BE7492BU, 0x4BB2BEA5U, 0x4B7E587EU, 0x4B4A169CU, 0x4B15F8E6U,
+    0x4AE1FF43U, 0x4AAE299BU, 0x4A7A77D4U, 0x4A46E9D6U, 0x4A137F88U, 0x49E038D0U,
+    0x49AD1598U, 0x497A15C4U, 0x4947393FU, 0x49147FEEU, 0x48E1E9BAU, 0x48AF768AU,
+    0x487D2646U, 0x484AF8D6U, 0x4818EE22U, 0x47E70611U, 0x47B5408CU, 0x47839D7BU,
+    0x47521CC6U, 0x4720BE55U, 0x46EF8210U, 0x46BE67E0U, 0x468D6FAEU, 0x465C9961U,
+    0x462BE4E2U, 0x45FB521AU, 0x45CAE0F2U, 0x459A9152U, 0x456A6323U, 0x453A564DU,
+    0x450A6ABBU, 0x44DAA054U, 0x44AAF702U, 0x447B6EADU, 0x444C0740U, 0x441CC0A3U,
+    0x43ED9AC0U, 0x43BE957FU, 0x438FB0CBU, 0x4360EC8DU, 0x433248AEU, 0x4303C518U,
+    0x42D561B4U, 0x42A71E6CU, 0x4278FB2BU, 0x424AF7DAU, 0x421D1462U, 0x41EF50AEU,
+    0x41C1ACA7U, 0x41942839U, 0x4166C34CU, 0x41397DCCU, 0x410C57A2U, 0x40DF50B8U,
+    0x40B268FAU, 0x4085A051U, 0x4058F6A8U, 0x402C6BE9U, 0x40000000U,
+};
+
+// a * f / 2^31 for |a| < 2^62 without a 128-bit product.
+static inline int64_t mulQ31(int64_t a, uint32_t f) {
+  const bool negative = a < 0;
+  const uint64_t u = negative ? static_cast<uint64_t>(-a) : static_cast<uint64_t>(a);
+  const uint64_t r = (u >> 31) * f + (((u & 0x7FFFFFFFU) * f) >> 31);
+  return negative ? -static_cast<int64_t>(r) : static_cast<int64_t>(r);
+}
+
+}  // namespace
+
+// ===========================================================================
+// DecayFactor
+// ===========================================================================
+
+Status DecayFactor::begin(uint32_t tauUs) {
+  if (tauUs == 0U) {
+    return Status(Err::INVALID_CONFIG, 0, "tauUs must be non-zero");
+  }
+  _log2ePerUsQ56 = (LOG2E_Q56 + tauUs / 2U) / tauUs;
+  _zeroAfterUs = ZERO_AFTER_TAUS * static_cast<int64_t>(tauUs);
+  return Ok();
+}
+
+uint32_t DecayFactor::at(int64_t elapsedUs) const {
+  if (elapsedUs <= 0) {
+    return EWMA_ONE_Q31;
+  }
+  if (elapsedUs >= _zeroAfterUs) {
+    return 0U;
+  }
+  // exp(-t / tau) = 2^-y, y = t * log2(e) / tau: shift by int(y), table for frac(y).
+  const uint64_t y = static_cast<uint64_t>(elapsedUs) * _log2ePerUsQ56;
+  const uint32_t shift = static_cast<uint32_t>(y >> 56);
+  const uint64_t frac = y & FRAC_MASK_Q56;
+  const uint32_t index = static_cast<uint32_t>(frac >> (56U - TABLE_BITS));
+  const uint64_t within = (frac >> (56U - TABLE_BITS - 32U)) & 0xFFFFFFFFU;  // Q32 in cell
+  const uint32_t hi = POW2_NEG_Q31[index];
+  const uint64_t step = hi - POW2_NEG_Q31[index + 1U];
+  // Chord minus its bow: the curve sags below the chord by ~c * u * (1 - u).
+  const uint64_t bow = (within * ((1ULL << 32) - within)) >> 32;
+  const uint64_t sag = (((static_cast<uint64_t>(hi) * CELL_CURVE_Q32) >> 32) * bow) >> 32;
+  const uint32_t value = hi - static_cast<uint32_t>(((step * within) >> 32) + sag);
+  return value >> shift;
+}
+
+// ===========================================================================
+// TimeEwma
+// ===========================================================================
+
+TimeEwma::TimeEwma() : _avgQ16(0), _lastUs(0), _seeded(false), _initialized(false) {}
+
+Status TimeEwma::begin(uint32_t tauUs) {
+  const Status st = _decay.begin(tauUs);
+  if (!st.ok()) {
+    return st;
+  }
+  _avgQ16 = 0;
+  _lastUs = 0;
+  _seeded = false;
+  _initialized = true;
+  return Ok();
+}
+
+void TimeEwma::update(int32_t value) {
+  updateAt(micros64(), value);
+}
+
+void TimeEwma::updateAt(int64_t nowUs, int32_t value) {
+  if (!_initialized) {
+    return;
+  }
+  const int64_t valueQ16 = static_cast<int64_t>(value) * 65536;
+  if (!_seeded) {
+    _seeded = true;
+    _avgQ16 = valueQ16;
+    _lastUs = nowUs;
+    return;
+  }
+  _avgQ16 = valueQ16 + mulQ31(_avgQ16 - valueQ16, _decay.at(nowUs - _lastUs));
+  _lastUs = nowUs > _lastUs ? nowUs : _lastUs;
+}
+
+// ===========================================================================
+// DecayingRate
+// ===========================================================================
+
+DecayingRate::DecayingRate()
+    : _countQ16(0), _lastUs(0), _firstUs(0), _tauUs(0U), _seeded(false), _initialized(false) {}
+
+Status DecayingRate::begin(uint32_t tauUs) {
+  const Status st = _decay.begin(tauUs);
+  if (!st.ok()) {
+    return st;
+  }
+  _tauUs = tauUs;
+  _countQ16 = 0;
+  _lastUs = 0;
+  _firstUs = 0;
+  _seeded = false;
+  _initialized = true;
+  return Ok();
+}
+
+void DecayingRate::add(uint32_t events) {
+  addAt(micros64(), events);
+}
+
+void DecayingRate::addAt(int64_t nowUs, uint32_t events) {
+  if (!_initialized) {
+    return;
+  }
+  if (!_seeded) {
+    _seeded = true;
+    _firstUs = nowUs;
+    _lastUs = nowUs;
+  }
+  _countQ16 = mulQ31(_countQ16, _decay.at(nowUs - _lastUs)) +
+              static_cast<int64_t>(events) * 65536;
+  _lastUs = nowUs > _lastUs ? nowUs : _lastUs;
+}
+
+uint32_t DecayingRate::rate(uint32_t perUs) const {
+  return rateAt(micros64(), perUs);
+}
+
+uint32_t DecayingRate::rateAt(int64_t nowUs, uint32_t perUs) const {
+  if (!_seeded) {
+    return 0U;
+  }
+  const uint64_t countQ16 = static_cast<uint64_t>(mulQ31(_countQ16, _decay.at(nowUs - _lastUs)));
+  // Effective window: tau * (1 - exp(-elapsed / tau)), elapsed >= tau / 16.
+  int64_t elapsed = nowUs - _firstUs;
+  const int64_t minElapsed = static_cast<int64_t>(_tauUs / 16U);
+  elapsed = elapsed < minElapsed ? minElapsed : elapsed;
+  const uint64_t cover = EWMA_ONE_Q31 - _decay.at(elapsed);
+  uint64_t windowUs = (static_cast<uint64_t>(_tauUs) * cover) >> 31;
+  windowUs = windowUs == 0U ? 1U : windowUs;
+  const uint64_t scaled = (countQ16 >> 16) * perUs + (((countQ16 & 0xFFFFU) * perUs) >> 16);
+  const uint64_t result = (scaled + windowUs / 2U) / windowUs;
+  return result > 0xFFFFFFFFULL ? 0xFFFFFFFFU : static_cast<uint32_t>(result);
+}
+
+// ===========================================================================
+// LoadAverage
+// ===========================================================================
+
+Status LoadAverage::begin() {
+  Status st = _one.begin(60000000U);
+  if (st.ok()) {
+    st = _five.begin(300000000U);
+  }
+  if (st.ok()) {
+    st = _fifteen.begin(900000000U);
+  }
+  return st;
+}
+
+void LoadAverage::sample(int32_t value) {
+  sampleAt(micros64(), value);
+}
+
+void LoadAverage::sampleAt(int64_t nowUs, int32_t value) {
+  _one.updateAt(nowUs, value);
+  _five.updateAt(nowUs, value);
+  _fifteen.updateAt(nowUs, value);
+}
+
+}  // namespace SystemChrono
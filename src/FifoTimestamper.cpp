@@ -0,0 +1,130 @@
+/**
+ * @file FifoTimestamper.cpp
+ * @brief Implementation of the FIFO batch timestamper.
+ */
+
+#include "SystemChrono/FifoTimestamper.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr uint8_t Q = 12U;
+static constexpr int64_t HALF_Q = 1LL << (Q - 1U);
+
+static inline int64_t clamp64(int64_t value, int64_t lo, int64_t hi) {
+  return value < lo ? lo : (value > hi ? hi : value);
+}
+
+// A multiply, not `us << Q`: shifting a negative value left is undefined
+// before C++20, and stamps before time zero are negative.
+static inline int64_t toQ(int64_t us) {
+  return us * (1LL << Q);
+}
+
+}  // namespace
+
+FifoTimestamper::FifoTimestamper()
+    : _periodQ(0), _minPeriodQ(0), _maxPeriodQ(0), _lastQ(0), _batches(0U), _resyncs(0U),
+      _initialized(false) {}
+
+Status FifoTimestamper::begin(const FifoTimestamperConfig& config) {
+  if (config.nominalPeriodNs == 0U) {
+    return Status(Err::INVALID_CONFIG, 0, "nominalPeriodNs must be non-zero");
+  }
+  if (config.maxPeriodErrorPpm > 500000U) {
+    return Status(Err::INVALID_CONFIG, 0, "maxPeriodErrorPpm exceeds 50%");
+  }
+  if ((config.phaseShift > 16U) || (config.periodShift > 16U) || (config.resyncPeriods == 0U)) {
+    return Status(Err::INVALID_CONFIG, 1, "Loop gain or resync threshold out of range");
+  }
+  _config = config;
+  _periodQ = toQ(static_cast<int64_t>(config.nominalPeriodNs)) / 1000;
+  if (_periodQ == 0) {
+    return Status(Err::INVALID_CONFIG, 0, "nominalPeriodNs below Q12 resolution");
+  }
+  const int64_t slack = (_periodQ * config.maxPeriodErrorPpm) / 1000000;
+  _minPeriodQ = _periodQ - slack;
+  _maxPeriodQ = _periodQ + slack;
+  _lastQ = 0;
+  _batches = 0U;
+  _resyncs = 0U;
+  _initialized = true;
+  return Ok();
+}
+
+int64_t FifoTimestamper::periodNs() const {
+  return (_periodQ * 1000 + HALF_Q) >> Q;
+}
+
+Status FifoTimestamper::stamp(int64_t readUs, size_t count, int64_t* out,
+                              const FifoWatermark* marks, size_t markCount) {
+  if (!_initialized) {
+    return Status(Err::NOT_INITIALIZED, 0, "FifoTimestamper not initialized");
+  }
+  if (count == 0U) {
+    return Ok();
+  }
+  if ((out == nullptr) || ((markCount != 0U) && (marks == nullptr))) {
+    return Status(Err::INVALID_CONFIG, 0, "Null output or watermark array");
+  }
+  for (size_t m = 0; m < markCount; ++m) {
+    if (marks[m].index >= count) {
+      return Status(Err::INVALID_CONFIG, static_cast<int32_t>(marks[m].index),
+                    "Watermark index beyond batch");
+    }
+  }
+
+  const int64_t n = static_cast<int64_t>(count);
+  const int64_t readQ = toQ(readUs);
+  const int64_t predictedQ = _lastQ + n * _periodQ;
+
+  // Measured position of the newest sample: average over the watermarks,
+  // each mapped to the newest sample along the current period; otherwise the
+  // middle of the last period before the read.
+  int64_t measuredQ = readQ - _periodQ / 2;
+  if (markCount != 0U) {
+    int64_t sum = 0;
+    const int64_t latencyQ = toQ(_config.watermarkLatencyUs);
+    for (size_t m = 0; m < markCount; ++m) {
+      sum += toQ(marks[m].micros) - latencyQ + (n - 1 - marks[m].index) * _periodQ;
+    }
+    measuredQ = sum / static_cast<int64_t>(markCount);
+  }
+
+  const int64_t errQ = measuredQ - predictedQ;
+  const int64_t resyncQ = static_cast<int64_t>(_config.resyncPeriods) * _periodQ;
+  int64_t lastQ = 0;
+  if ((_batches == 0U) || (errQ > resyncQ) || (errQ < -resyncQ)) {
+    if (_batches != 0U) {
+      ++_resyncs;
+    }
+    lastQ = measuredQ;
+  } else {
+    _periodQ = clamp64(_periodQ + ((errQ / n) >> _config.periodShift), _minPeriodQ, _maxPeriodQ);
+    // Never move back more than half a period, so batches stay ordered.
+    const int64_t stepQ = errQ >> _config.phaseShift;
+    lastQ = predictedQ + (stepQ < -_periodQ / 2 ? -_periodQ / 2 : stepQ);
+  }
+  if (lastQ > readQ) {
+    lastQ = readQ;  // a sample cannot be produced after the read
+  }
+  _lastQ = lastQ;
+  ++_batches;
+
+  // Back-fill: out[i] = first + i * period, rounded. The first stamp may be
+  // negative (samples before the clock's zero), so its whole microseconds
+  // are floored once; the loop then only shifts the non-negative fraction
+  // plus i periods, which stays unsigned and vectorizes on SSE2/NEON.
+  const int64_t periodQ = _periodQ;
+  const int64_t firstQ = lastQ - (n - 1) * periodQ + HALF_Q;
+  const int64_t baseUs = firstQ >= 0 ? (firstQ >> Q) : -((-firstQ + (1LL << Q) - 1) >> Q);
+  const uint64_t fractionQ = static_cast<uint64_t>(firstQ - toQ(baseUs));
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = baseUs +
+             static_cast<int64_t>((fractionQ + static_cast<uint64_t>(i) * periodQ) >> Q);
+  }
+  return Ok();
+}
+
+}  // namespace SystemChrono
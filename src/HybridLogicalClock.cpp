@@ -0,0 +1,81 @@
+/**
+ * @file HybridLogicalClock.cpp
+ * @brief Implementation of the hybrid logical clock.
+ */
+
+#include "SystemChrono/HybridLogicalClock.h"
+
+#include "SystemChrono/SystemChrono.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static inline uint64_t packPhysical(int64_t physicalUs) {
+  return (physicalUs > 0) ? (static_cast<uint64_t>(physicalUs) << HLC_LOGICAL_BITS) : 0U;
+}
+
+static inline int32_t clampToMs(int64_t us) {
+  const int64_t ms = us / 1000LL;
+  return (ms > 0x7FFFFFFFLL) ? 0x7FFFFFFF : static_cast<int32_t>(ms);
+}
+
+}  // namespace
+
+HybridLogicalClock::HybridLogicalClock() : _last(0U), _epochOffsetUs(0), _maxOffsetUs(0) {}
+
+Status HybridLogicalClock::begin(const HlcConfig& config) {
+  if (config.maxOffsetUs < 0) {
+    return Status(Err::INVALID_CONFIG, 0, "Max offset is negative");
+  }
+  _epochOffsetUs = config.epochOffsetUs;
+  _maxOffsetUs = config.maxOffsetUs;
+  _last.store(0U, std::memory_order_relaxed);
+  return Ok();
+}
+
+// new = max(last + 1, floor); one CAS per uncontended call.
+HlcTimestamp HybridLogicalClock::update(uint64_t floor) {
+  uint64_t last = _last.load(std::memory_order_relaxed);
+  for (;;) {
+    const uint64_t next = (last + 1U > floor) ? last + 1U : floor;
+    if (_last.compare_exchange_weak(last, next, std::memory_order_acq_rel,
+                                    std::memory_order_relaxed)) {
+      return HlcTimestamp(next);
+    }
+  }
+}
+
+HlcTimestamp HybridLogicalClock::send() {
+  return sendAt(physicalNowUs());
+}
+
+HlcTimestamp HybridLogicalClock::sendAt(int64_t physicalUs) {
+  return update(packPhysical(physicalUs));
+}
+
+Status HybridLogicalClock::receive(HlcTimestamp message, HlcTimestamp& out) {
+  return receiveAt(message, physicalNowUs(), out);
+}
+
+Status HybridLogicalClock::receiveAt(HlcTimestamp message, int64_t physicalUs,
+                                     HlcTimestamp& out) {
+  const int64_t aheadUs = message.physicalUs() - physicalUs;
+  if ((_maxOffsetUs > 0) && (aheadUs > _maxOffsetUs)) {
+    return Status(Err::INVALID_CONFIG, clampToMs(aheadUs), "Remote clock beyond max offset");
+  }
+  const uint64_t local = packPhysical(physicalUs);
+  const uint64_t remote = message.packed + 1U;
+  out = update(remote > local ? remote : local);
+  return Ok();
+}
+
+HlcTimestamp HybridLogicalClock::last() const {
+  return HlcTimestamp(_last.load(std::memory_order_acquire));
+}
+
+int64_t HybridLogicalClock::physicalNowUs() const {
+  return micros64() + _epochOffsetUs;
+}
+
+}  // namespace SystemChrono
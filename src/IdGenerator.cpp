@@ -0,0 +1,109 @@
+/**
+ * @file IdGenerator.cpp
+ * @brief Implementation of the Snowflake ID generator.
+ */
+
+#include "SystemChrono/IdGenerator.h"
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr int64_t MAX_TIME_MS = (1LL << ID_TIME_BITS) - 1LL;
+
+}  // namespace
+
+IdGenerator::IdGenerator()
+    : _state(0U),
+      _timeBaseMs(0),
+      _leadMs(0),
+      _epochMs(0),
+      _nodeId(0U),
+      _policy(IdExhaustPolicy::SPIN),
+      _initialized(false) {}
+
+Status IdGenerator::begin(const IdGeneratorConfig& config) {
+  if (config.nodeId > ID_MAX_NODE) {
+    return Status(Err::INVALID_CONFIG, static_cast<int32_t>(config.nodeId),
+                  "Node ID exceeds 10 bits");
+  }
+  _epochMs = config.epochMs;
+  _nodeId = config.nodeId;
+  _policy = config.policy;
+  _timeBaseMs.store(config.timeBaseMs, std::memory_order_relaxed);
+  _leadMs.store(0, std::memory_order_relaxed);
+  _state.store(0U, std::memory_order_relaxed);
+  _initialized = true;
+  return Ok();
+}
+
+Status IdGenerator::next(uint64_t& outId) {
+  if (!_initialized) {
+    return Status(Err::NOT_INITIALIZED, 0, "IdGenerator not initialized");
+  }
+
+  uint64_t last = _state.load(std::memory_order_relaxed);
+  for (;;) {
+    const int64_t nowMs = millis64() + _timeBaseMs.load(std::memory_order_relaxed) - _epochMs;
+    if (nowMs < 0) {
+      return Status(Err::INVALID_CONFIG, 0, "Clock is before the ID epoch");
+    }
+    if (nowMs > MAX_TIME_MS) {
+      return Status(Err::INVALID_CONFIG, 1, "Clock is past the 41-bit ID range");
+    }
+
+    const uint64_t now = static_cast<uint64_t>(nowMs);
+    const uint64_t lastMs = last >> ID_SEQUENCE_BITS;
+    const uint64_t sequence = last & ID_MAX_SEQUENCE;
+    uint64_t candidate = 0U;
+    if (now > lastMs) {
+      candidate = now << ID_SEQUENCE_BITS;
+    } else if (sequence < ID_MAX_SEQUENCE) {
+      // Same millisecond, or the time base moved backwards: keep counting
+      // from the last issued time.
+      candidate = last + 1U;
+    } else if ((now < lastMs) &&
+               (static_cast<int64_t>(lastMs + 1U - now) <=
+                _leadMs.load(std::memory_order_relaxed))) {
+      // Behind after a re-base and out of sequence numbers: borrow the next
+      // millisecond instead of waiting for the new time base to catch up,
+      // but never run ahead of the time base the IDs were issued on.
+      candidate = (lastMs + 1U) << ID_SEQUENCE_BITS;
+    } else if (_policy == IdExhaustPolicy::FAIL) {
+      return Status(Err::RESOURCE_BUSY, static_cast<int32_t>(ID_MAX_SEQUENCE + 1U),
+                    "ID sequence exhausted for this millisecond");
+    } else {
+      last = _state.load(std::memory_order_relaxed);
+      continue;  // spin until the next millisecond
+    }
+
+    if (_state.compare_exchange_weak(last, candidate, std::memory_order_acq_rel,
+                                     std::memory_order_relaxed)) {
+      const uint64_t timeField = candidate >> ID_SEQUENCE_BITS;
+      outId = (timeField << (ID_NODE_BITS + ID_SEQUENCE_BITS)) |
+              (static_cast<uint64_t>(_nodeId) << ID_SEQUENCE_BITS) |
+              (candidate & ID_MAX_SEQUENCE);
+      return Ok();
+    }
+  }
+}
+
+void IdGenerator::rebase(int64_t timeBaseMs) {
+  const int64_t previous = _timeBaseMs.exchange(timeBaseMs, std::memory_order_relaxed);
+  // The lead shrinks when time moves forward, but never below 0.
+  int64_t lead = _leadMs.load(std::memory_order_relaxed);
+  int64_t next = 0;
+  do {
+    next = detail::saturatingAdd(lead, detail::saturatingSub(previous, timeBaseMs));
+    next = next > 0 ? next : 0;
+  } while (!_leadMs.compare_exchange_weak(lead, next, std::memory_order_relaxed));
+}
+
+int64_t IdGenerator::timeBase() const {
+  return _timeBaseMs.load(std::memory_order_relaxed);
+}
+
+}  // namespace SystemChrono
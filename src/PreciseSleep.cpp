@@ -0,0 +1,242 @@
+/**
+ * @file PreciseSleep.cpp
+ * @brief Implementation of the hybrid sleep/yield/spin wait.
+ */
+
+#include "SystemChrono/PreciseSleep.h"
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+  #include "freertos/FreeRTOS.h"
+  #include "freertos/task.h"
+#elif !defined(ARDUINO)
+  #include <sched.h>
+  #include <time.h>
+#endif
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr int32_t MAX_GUARD_LIMIT_US = 1000000;
+static constexpr int32_t MAX_MIN_SPIN_US = 1000;
+static constexpr int32_t UNLEARNED = -1;
+
+// Longest single OS sleep; longer waits re-plan every second, and the
+// budget always fits the platform sleep argument.
+static constexpr int64_t MAX_OS_SLEEP_US = 1000000LL;
+
+// ===========================================================================
+// Platform backends
+// ===========================================================================
+
+#if defined(ARDUINO_ARCH_ESP32)
+static constexpr int64_t OS_SLEEP_QUANTUM_US = 1000000LL / configTICK_RATE_HZ;
+#elif defined(ARDUINO)
+static constexpr int64_t OS_SLEEP_QUANTUM_US = 1000LL;
+#else
+static constexpr int64_t OS_SLEEP_QUANTUM_US = 1LL;
+#endif
+
+/// Sleep for at most budgetUs rounded down to the quantum; returns the
+/// duration asked of the OS.
+int64_t osSleep(int64_t budgetUs) {
+#if defined(ARDUINO_ARCH_ESP32)
+  // vTaskDelay(n) wakes on the n-th tick interrupt: between n - 1 and n
+  // ticks from now, never a full tick late.
+  const int64_t ticks = budgetUs / OS_SLEEP_QUANTUM_US;
+  vTaskDelay(static_cast<TickType_t>(ticks));
+  return ticks * OS_SLEEP_QUANTUM_US;
+#elif defined(ARDUINO)
+  const int64_t ms = budgetUs / OS_SLEEP_QUANTUM_US;
+  delay(static_cast<unsigned long>(ms));
+  return ms * OS_SLEEP_QUANTUM_US;
+#else
+  struct timespec ts;
+  ts.tv_sec = static_cast<time_t>(budgetUs / 1000000LL);
+  ts.tv_nsec = static_cast<long>((budgetUs % 1000000LL) * 1000LL);
+  (void)nanosleep(&ts, nullptr);  // EINTR: the caller re-plans from micros64()
+  return budgetUs;
+#endif
+}
+
+void osYield() {
+#if defined(ARDUINO_ARCH_ESP32)
+  taskYIELD();
+#elif defined(ARDUINO)
+  yield();
+#else
+  (void)sched_yield();
+#endif
+}
+
+// ===========================================================================
+// Guard estimators
+// ===========================================================================
+
+/// Samples are clamped to [-maxUs, ceilingUs]. The caller passes about
+/// twice the current guard as the ceiling, so one stall (preemption, a
+/// page fault) cannot blow the guard up, while a real shift still gets
+/// through within a few samples as the guard doubles.
+void learn(std::atomic<int32_t>& meanQ4, std::atomic<int32_t>& devQ4, int64_t sampleUs,
+           int64_t ceilingUs, int32_t maxUs) {
+  if (ceilingUs > maxUs) {
+    ceilingUs = maxUs;
+  }
+  if (sampleUs > ceilingUs) {
+    sampleUs = ceilingUs;
+  } else if (sampleUs < -maxUs) {
+    sampleUs = -maxUs;
+  }
+  const int32_t x = static_cast<int32_t>(sampleUs) * 16;
+  const int32_t dev = devQ4.load(std::memory_order_relaxed);
+  if (dev == UNLEARNED) {
+    // First sample (as RFC 6298): mean = x, deviation = |x| / 2.
+    meanQ4.store(x, std::memory_order_relaxed);
+    devQ4.store((x < 0 ? -x : x) / 2, std::memory_order_relaxed);
+    return;
+  }
+  const int32_t mean = meanQ4.load(std::memory_order_relaxed);
+  const int32_t diff = x - mean;
+  const int32_t absDiff = diff < 0 ? -diff : diff;
+  meanQ4.store(mean + diff / 8, std::memory_order_relaxed);
+  devQ4.store(dev + (absDiff - dev) / 4, std::memory_order_relaxed);
+}
+
+int32_t guardUs(const std::atomic<int32_t>& meanQ4, const std::atomic<int32_t>& devQ4,
+                int32_t minUs, int32_t maxUs) {
+  // Before the first sample the deviation is UNLEARNED and the mean holds
+  // the configured initial guard.
+  const int32_t dev = devQ4.load(std::memory_order_relaxed);
+  const int32_t q4 = meanQ4.load(std::memory_order_relaxed) + (dev == UNLEARNED ? 0 : 4 * dev);
+  const int32_t us = (q4 + 15) / 16;
+  return us < minUs ? minUs : (us > maxUs ? maxUs : us);
+}
+
+}  // namespace
+
+// ===========================================================================
+// Sleeper
+// ===========================================================================
+
+Sleeper::Sleeper()
+    : _sleepMeanQ4(0),
+      _sleepDevQ4(0),
+      _yieldMeanQ4(0),
+      _yieldDevQ4(0),
+      _maxGuardUs(0),
+      _minSpinUs(0),
+      _clock(micros64),
+      _osSleep(osSleep),
+      _osYield(osYield) {
+  (void)begin(SleeperConfig());
+}
+
+Status Sleeper::begin(const SleeperConfig& config) {
+  if ((config.maxGuardUs == 0U) || (config.maxGuardUs > MAX_GUARD_LIMIT_US)) {
+    return Status(Err::INVALID_CONFIG, 0, "maxGuardUs must be 1..1000000");
+  }
+  if (config.initialGuardUs > config.maxGuardUs) {
+    return Status(Err::INVALID_CONFIG, 1, "initialGuardUs exceeds maxGuardUs");
+  }
+  if (config.minSpinUs > MAX_MIN_SPIN_US) {
+    return Status(Err::INVALID_CONFIG, 2, "minSpinUs above 1000");
+  }
+  _maxGuardUs = static_cast<int32_t>(config.maxGuardUs);
+  _minSpinUs = static_cast<int32_t>(config.minSpinUs);
+  _clock = (config.clock != nullptr) ? config.clock : micros64;
+  _osSleep = (config.osSleep != nullptr) ? config.osSleep : osSleep;
+  _osYield = (config.osYield != nullptr) ? config.osYield : osYield;
+  _sleepMeanQ4.store(static_cast<int32_t>(config.initialGuardUs) * 16, std::memory_order_relaxed);
+  _sleepDevQ4.store(UNLEARNED, std::memory_order_relaxed);
+  _yieldMeanQ4.store(0, std::memory_order_relaxed);
+  _yieldDevQ4.store(UNLEARNED, std::memory_order_relaxed);
+  return Ok();
+}
+
+int64_t Sleeper::sleepUntil(int64_t deadlineUs, SleepReport* report) {
+  SleepReport local;
+  int64_t now = _clock();
+  if (deadlineUs <= now) {
+    local.lateUs = detail::saturatingSub(now, deadlineUs);
+    if (report != nullptr) {
+      *report = local;
+    }
+    return local.lateUs;
+  }
+
+  // Phase 1: OS sleep while the remaining time clears both guards by at
+  // least one quantum. An early wake-up (signal, tick rounding) re-plans.
+  for (;;) {
+    const int64_t sleepGuard = sleepGuardUs();
+    int64_t budget = detail::saturatingSub(deadlineUs - now, sleepGuard + spinGuardUs());
+    if (budget < OS_SLEEP_QUANTUM_US) {
+      break;
+    }
+    if (budget > MAX_OS_SLEEP_US) {
+      budget = MAX_OS_SLEEP_US;
+    }
+    const int64_t requested = _osSleep(budget);
+    const int64_t after = _clock();
+    learn(_sleepMeanQ4, _sleepDevQ4, after - now - requested,
+          2 * sleepGuard + OS_SLEEP_QUANTUM_US, _maxGuardUs);
+    local.sleptUs += after - now;
+    ++local.osSleeps;
+    now = after;
+  }
+
+  // Phase 2: yield until one yield could overrun the deadline.
+  const int64_t yieldStart = now;
+  for (;;) {
+    const int64_t spinGuard = spinGuardUs();
+    if (deadlineUs - now <= spinGuard) {
+      break;
+    }
+    _osYield();
+    const int64_t after = _clock();
+    learn(_yieldMeanQ4, _yieldDevQ4, after - now, 2 * spinGuard + 1, _maxGuardUs);
+    now = after;
+  }
+  local.yieldedUs = now - yieldStart;
+
+  // Phase 3: spin.
+  const int64_t spinStart = now;
+  while (now < deadlineUs) {
+    now = _clock();
+  }
+  local.spunUs = now - spinStart;
+  local.lateUs = now - deadlineUs;
+  if (report != nullptr) {
+    *report = local;
+  }
+  return local.lateUs;
+}
+
+int64_t Sleeper::sleepFor(int64_t durationUs, SleepReport* report) {
+  return sleepUntil(detail::saturatingAdd(_clock(), durationUs), report);
+}
+
+uint32_t Sleeper::sleepGuardUs() const {
+  return static_cast<uint32_t>(guardUs(_sleepMeanQ4, _sleepDevQ4, 0, _maxGuardUs));
+}
+
+uint32_t Sleeper::spinGuardUs() const {
+  return static_cast<uint32_t>(guardUs(_yieldMeanQ4, _yieldDevQ4, _minSpinUs, _maxGuardUs));
+}
+
+// ===========================================================================
+// Process-wide sleeper
+// ===========================================================================
+
+Sleeper& defaultSleeper() {
+  static Sleeper sleeper;
+  return sleeper;
+}
+
+int64_t sleepUntil(int64_t deadlineUs) {
+  return defaultSleeper().sleepUntil(deadlineUs);
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,85 @@
+/**
+ * @file RateLimiter.cpp
+ * @brief Implementation of the GCRA rate limiter.
+ */
+
+#include "SystemChrono/RateLimiter.h"
+
+#include "SystemChrono/SystemChrono.h"
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr int64_t MAX_LIMIT_NS = 1LL << 62;
+static constexpr int64_t NS_PER_US = 1000;
+
+}  // namespace
+
+RateLimiter::RateLimiter()
+    : _tatNs(0), _intervalNs(0), _limitNs(0), _burst(0U), _initialized(false) {}
+
+Status RateLimiter::begin(const RateLimiterConfig& config) {
+  if ((config.rate == 0U) || (config.periodUs == 0U) || (config.burst == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "rate, periodUs and burst must be non-zero");
+  }
+  const int64_t intervalNs = static_cast<int64_t>(config.periodUs) * NS_PER_US / config.rate;
+  if (intervalNs == 0) {
+    return Status(Err::INVALID_CONFIG, 1, "Emission interval below 1 ns");
+  }
+  if (intervalNs > MAX_LIMIT_NS / config.burst) {
+    return Status(Err::INVALID_CONFIG, 2, "burst * interval too large");
+  }
+  _intervalNs = intervalNs;
+  _limitNs = intervalNs * config.burst;
+  _burst = config.burst;
+  _initialized = true;
+  reset();
+  return Ok();
+}
+
+void RateLimiter::reset() {
+  // A TAT in the distant past: the first request sees full burst capacity.
+  _tatNs.store(-MAX_LIMIT_NS, std::memory_order_relaxed);
+}
+
+int64_t RateLimiter::tryAcquire(uint32_t tokens) {
+  return tryAcquireAt(micros64(), tokens);
+}
+
+int64_t RateLimiter::tryAcquireAt(int64_t nowUs, uint32_t tokens) {
+  if (!_initialized || (tokens > _burst)) {
+    return RATE_LIMIT_NEVER;
+  }
+  const int64_t nowNs = nowUs * NS_PER_US;
+  const int64_t costNs = _intervalNs * tokens;
+  int64_t tat = _tatNs.load(std::memory_order_relaxed);
+  for (;;) {
+    const int64_t base = tat > nowNs ? tat : nowNs;
+    const int64_t next = base + costNs;
+    const int64_t excessNs = next - nowNs - _limitNs;
+    if (excessNs > 0) {
+      return (excessNs + NS_PER_US - 1) / NS_PER_US;
+    }
+    if (_tatNs.compare_exchange_weak(tat, next, std::memory_order_acq_rel,
+                                     std::memory_order_relaxed)) {
+      return 0;
+    }
+  }
+}
+
+uint32_t RateLimiter::available() const {
+  return availableAt(micros64());
+}
+
+uint32_t RateLimiter::availableAt(int64_t nowUs) const {
+  if (!_initialized) {
+    return 0U;
+  }
+  const int64_t nowNs = nowUs * NS_PER_US;
+  const int64_t tat = _tatNs.load(std::memory_order_relaxed);
+  const int64_t backlogNs = tat > nowNs ? tat - nowNs : 0;
+  return static_cast<uint32_t>((_limitNs - backlogNs) / _intervalNs);
+}
+
+}  // namespace SystemChrono
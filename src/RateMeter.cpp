@@ -0,0 +1,119 @@
+/**
+ * @file RateMeter.cpp
+ * @brief Implementation of the sliding-window rate meter.
+ */
+
+#include "SystemChrono/RateMeter.h"
+
+#include "SystemChrono/SystemChrono.h"
+
+namespace SystemChrono {
+
+RateMeter::RateMeter()
+    : _slots(),
+      _headStartUs(0),
+      _firstUs(0),
+      _bucketUs(0),
+      _total(0U),
+      _buckets(0U),
+      _head(0U),
+      _started(false),
+      _initialized(false) {}
+
+Status RateMeter::begin(const RateMeterConfig& config) {
+  if ((config.buckets == 0U) || (config.buckets > RATE_METER_MAX_BUCKETS)) {
+    return Status(Err::INVALID_CONFIG, config.buckets, "buckets must be 1..RATE_METER_MAX_BUCKETS");
+  }
+  if ((config.windowUs < config.buckets) || ((config.windowUs % config.buckets) != 0U)) {
+    return Status(Err::INVALID_CONFIG, config.buckets, "windowUs must be a multiple of buckets");
+  }
+  _bucketUs = static_cast<int64_t>(config.windowUs / config.buckets);
+  _buckets = config.buckets;
+  _initialized = true;
+  reset();
+  return Ok();
+}
+
+void RateMeter::reset() {
+  for (uint8_t i = 0U; i < RATE_METER_MAX_BUCKETS; ++i) {
+    _slots[i] = 0U;
+  }
+  _total = 0U;
+  _head = 0U;
+  _started = false;
+}
+
+void RateMeter::advance(int64_t nowUs) {
+  if (!_started) {
+    _started = true;
+    _headStartUs = nowUs;
+    _firstUs = nowUs;
+    return;
+  }
+  const int64_t sinceHead = nowUs - _headStartUs;
+  if (sinceHead < _bucketUs) {
+    return;  // same slot (or a slightly older stamp): nothing expires
+  }
+  const int64_t steps = sinceHead / _bucketUs;
+  _headStartUs += steps * _bucketUs;
+  if (steps >= _buckets) {
+    for (uint8_t i = 0U; i < _buckets; ++i) {
+      _slots[i] = 0U;
+    }
+    _total = 0U;
+    return;
+  }
+  for (int64_t i = 0; i < steps; ++i) {
+    _head = (_head + 1U == _buckets) ? 0U : static_cast<uint8_t>(_head + 1U);
+    _total -= _slots[_head];
+    _slots[_head] = 0U;
+  }
+}
+
+void RateMeter::record(uint32_t events) {
+  recordAt(micros64(), events);
+}
+
+void RateMeter::recordAt(int64_t nowUs, uint32_t events) {
+  if (!_initialized) {
+    return;
+  }
+  advance(nowUs);
+  _slots[_head] += events;
+  _total += events;
+}
+
+uint32_t RateMeter::count() {
+  return countAt(micros64());
+}
+
+uint32_t RateMeter::countAt(int64_t nowUs) {
+  if (!_initialized) {
+    return 0U;
+  }
+  advance(nowUs);
+  return _total;
+}
+
+uint32_t RateMeter::rate(uint32_t perUs) {
+  return rateAt(micros64(), perUs);
+}
+
+uint32_t RateMeter::rateAt(int64_t nowUs, uint32_t perUs) {
+  const uint32_t events = countAt(nowUs);
+  if (events == 0U) {
+    return 0U;
+  }
+  // Covered span: the full older slots plus the elapsed part of the newest,
+  // or less while the meter has not yet run a full window.
+  int64_t covered = static_cast<int64_t>(_buckets - 1U) * _bucketUs + (nowUs - _headStartUs);
+  const int64_t sinceFirst = nowUs - _firstUs;
+  covered = sinceFirst < covered ? sinceFirst : covered;
+  covered = covered < _bucketUs ? _bucketUs : covered;
+  const uint64_t scaled = static_cast<uint64_t>(events) * perUs;
+  const uint64_t result = (scaled + static_cast<uint64_t>(covered) / 2U) /
+                          static_cast<uint64_t>(covered);
+  return result > 0xFFFFFFFFULL ? 0xFFFFFFFFU : static_cast<uint32_t>(result);
+}
+
+}  // namespace SystemChrono
@@ -8,108 +8,31 @@
 #include <limits>
 #include <stdio.h>
 
-#if !defined(ARDUINO)
-  #error "SystemChrono: this library currently supports Arduino builds only."
+#include "SystemChrono/Chrono.h"
+#include "SystemChrono/ClockCalibration.h"
+#include "SystemChrono/VirtualClock.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+#if !defined(ARDUINO) && !defined(__linux__) && !defined(__APPLE__)
+  #error "SystemChrono: this library supports Arduino builds and POSIX hosts only."
 #endif
 
 #if defined(ARDUINO_ARCH_ESP32)
   #include "esp_timer.h"
+#elif !defined(ARDUINO)
+  #include <time.h>
 #endif
 
 namespace SystemChrono {
 
 namespace {
 
-static constexpr int64_t INT64_MIN_VALUE = (std::numeric_limits<int64_t>::min)();
-static constexpr int64_t INT64_MAX_VALUE = (std::numeric_limits<int64_t>::max)();
-
-static inline int64_t saturatingAdd(int64_t lhs, int64_t rhs) {
-#if defined(__GNUC__) || defined(__clang__)
-  int64_t out = 0;
-  if (!__builtin_add_overflow(lhs, rhs, &out)) {
-    return out;
-  }
-  return rhs >= 0 ? INT64_MAX_VALUE : INT64_MIN_VALUE;
-#else
-  if ((rhs > 0) && (lhs > (INT64_MAX_VALUE - rhs))) {
-    return INT64_MAX_VALUE;
-  }
-  if ((rhs < 0) && (lhs < (INT64_MIN_VALUE - rhs))) {
-    return INT64_MIN_VALUE;
-  }
-  return lhs + rhs;
-#endif
-}
-
-static inline int64_t saturatingSub(int64_t lhs, int64_t rhs) {
-#if defined(__GNUC__) || defined(__clang__)
-  int64_t out = 0;
-  if (!__builtin_sub_overflow(lhs, rhs, &out)) {
-    return out;
-  }
-  return rhs >= 0 ? INT64_MIN_VALUE : INT64_MAX_VALUE;
-#else
-  if ((rhs > 0) && (lhs < (INT64_MIN_VALUE + rhs))) {
-    return INT64_MIN_VALUE;
-  }
-  if ((rhs < 0) && (lhs > (INT64_MAX_VALUE + rhs))) {
-    return INT64_MAX_VALUE;
-  }
-  return lhs - rhs;
-#endif
-}
-
-static inline int64_t saturatingMul(int64_t lhs, int64_t rhs) {
-#if defined(__GNUC__) || defined(__clang__)
-  int64_t out = 0;
-  if (!__builtin_mul_overflow(lhs, rhs, &out)) {
-    return out;
-  }
-  const bool sameSign = (lhs < 0) == (rhs < 0);
-  return sameSign ? INT64_MAX_VALUE : INT64_MIN_VALUE;
-#else
-  if ((lhs == 0) || (rhs == 0)) {
-    return 0;
-  }
-  if ((lhs == -1) && (rhs == INT64_MIN_VALUE)) {
-    return INT64_MAX_VALUE;
-  }
-  if ((rhs == -1) && (lhs == INT64_MIN_VALUE)) {
-    return INT64_MAX_VALUE;
-  }
-
-  if (lhs > 0) {
-    if (rhs > 0) {
-      if (lhs > (INT64_MAX_VALUE / rhs)) {
-        return INT64_MAX_VALUE;
-      }
-    } else {
-      if (rhs < (INT64_MIN_VALUE / lhs)) {
-        return INT64_MIN_VALUE;
-      }
-    }
-  } else {
-    if (rhs > 0) {
-      if (lhs < (INT64_MIN_VALUE / rhs)) {
-        return INT64_MIN_VALUE;
-      }
-    } else {
-      if (lhs < (INT64_MAX_VALUE / rhs)) {
-        return INT64_MAX_VALUE;
-      }
-    }
-  }
-  return lhs * rhs;
-#endif
-}
-
-static inline int64_t millisToMicrosSaturated(int64_t valueMs) {
-  return saturatingMul(valueMs, 1000LL);
-}
-
-static inline int64_t secondsToMicrosSaturated(int64_t valueS) {
-  return saturatingMul(valueS, 1000000LL);
-}
+using detail::INT64_MAX_VALUE;
+using detail::INT64_MIN_VALUE;
+using detail::millisToMicrosSaturated;
+using detail::saturatingAdd;
+using detail::saturatingSub;
+using detail::secondsToMicrosSaturated;
 
 static inline uint64_t absToUnsigned(int64_t value) {
   if (value >= 0) {
@@ -128,11 +51,22 @@ static inline int32_t sizeToDetail(size_t value) {
 
 }  // namespace
 
+#if SYSTEMCHRONO_HAS_CHRONO
+constexpr bool steady_clock::is_steady;  // out-of-line definition for C++11
+#endif
+
 // ===========================================================================
 // Internal: Platform microsecond source
 // ===========================================================================
 
 static inline int64_t micros64Impl() {
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+  int64_t virtualUs = 0;
+  if (detail::readVirtualClock(virtualUs)) {
+    return virtualUs;
+  }
+#endif
+
 #if defined(ARDUINO_ARCH_ESP32)
   // ESP32: monotonic microseconds since boot
   return static_cast<int64_t>(esp_timer_get_time());
@@ -154,6 +88,17 @@ static inline int64_t micros64Impl() {
 
   return static_cast<int64_t>(full);
 
+#elif defined(__linux__) || defined(__APPLE__)
+  // Host: on Linux both clocks are served by the vDSO (no syscall).
+  // CLOCK_MONOTONIC is NTP-slewed; CLOCK_MONOTONIC_RAW is the raw oscillator.
+  struct timespec ts;
+  #if defined(SYSTEMCHRONO_HOST_CLOCK_MONOTONIC_RAW) && defined(CLOCK_MONOTONIC_RAW)
+  clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+  #else
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  #endif
+  return static_cast<int64_t>(ts.tv_sec) * 1000000LL + static_cast<int64_t>(ts.tv_nsec) / 1000LL;
+
 #else
   #error "SystemChrono: unsupported platform."
 #endif
@@ -251,10 +196,12 @@ String formatNow() {
 // Stopwatch Implementation
 // ===========================================================================
 
-Stopwatch::Stopwatch() : _startUs(0), _totalUs(0), _running(false) {}
+Stopwatch::Stopwatch()
+    : _startUs(0), _totalUs(0), _intervals(0), _running(false), _compensated(false) {}
 
 void Stopwatch::start() {
   _totalUs = 0;
+  _intervals = 0;
   _startUs = micros64();
   _running = true;
 }
@@ -262,6 +209,7 @@ void Stopwatch::start() {
 void Stopwatch::stop() {
   if (_running) {
     _totalUs = saturatingAdd(_totalUs, microsSince(_startUs));
+    ++_intervals;
     _running = false;
     _startUs = 0;
   }
@@ -276,6 +224,7 @@ void Stopwatch::resume() {
 
 void Stopwatch::reset() {
   _totalUs = 0;
+  _intervals = 0;
   if (_running) {
     _startUs = micros64();
   } else {
@@ -285,10 +234,12 @@ void Stopwatch::reset() {
 
 int64_t Stopwatch::elapsedMicros() const {
   int64_t acc = _totalUs;
+  uint32_t intervals = _intervals;
   if (_running) {
     acc = saturatingAdd(acc, microsSince(_startUs));
+    ++intervals;
   }
-  return acc;
+  return _compensated ? compensateReadOverhead(acc, intervals) : acc;
 }
 
 int64_t Stopwatch::elapsedMillis() const {
@@ -303,6 +254,14 @@ bool Stopwatch::isRunning() const {
   return _running;
 }
 
+void Stopwatch::setOverheadCompensation(bool enabled) {
+  _compensated = enabled;
+}
+
+bool Stopwatch::isOverheadCompensated() const {
+  return _compensated;
+}
+
 // ===========================================================================
 // ElapsedMicros64 Implementation
 // ===========================================================================
@@ -355,6 +314,10 @@ ElapsedMicros64 ElapsedMicros64::operator+(int64_t valUs) const {
   return r;
 }
 
+int64_t ElapsedMicros64::compensated() const {
+  return compensateReadOverhead(saturatingSub(micros64Impl(), _us));
+}
+
 // ===========================================================================
 // ElapsedMillis64 Implementation
 // ===========================================================================
@@ -0,0 +1,197 @@
+/**
+ * @file TickCorrelator.cpp
+ * @brief Implementation of the streaming tick-to-micros correlator.
+ */
+
+#include "SystemChrono/TickCorrelator.h"
+
+#include <math.h>
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr uint32_t HALF_RANGE_TICKS = 1UL << 31;
+static constexpr double Q32_ONE = 4294967296.0;
+static constexpr double MAX_SLOPE_US = Q32_ONE - 1.0;
+// Re-centre the fit before tick offsets lose precision as doubles.
+static constexpr uint64_t MAX_ANCHOR_SPAN_TICKS = 1ULL << 32;
+
+}  // namespace
+
+TickCorrelator::TickCorrelator()
+    : _anchorTicks(0U),
+      _anchorMicros(0),
+      _extendedTicks(0U),
+      _lastRawTicks(0U),
+      _lambda(0.0),
+      _weight(0.0),
+      _meanX(0.0),
+      _meanY(0.0),
+      _cxx(0.0),
+      _cxy(0.0),
+      _cyy(0.0),
+      _slope(0.0),
+      _fitted(0U),
+      _consecutiveRejects(0U),
+      _initialized(false),
+      _valid(false),
+      _convBaseTicks(0U),
+      _convMulInt(0U),
+      _convMulFrac(0U),
+      _convBaseFrac(0U),
+      _convBaseMicros(0) {}
+
+Status TickCorrelator::begin(const TickCorrelatorConfig& config) {
+  if ((config.weightShift == 0U) || (config.weightShift > 16U)) {
+    return Status(Err::INVALID_CONFIG, config.weightShift, "weightShift must be 1..16");
+  }
+  if (config.minSamples < 2U) {
+    return Status(Err::INVALID_CONFIG, config.minSamples, "minSamples must be at least 2");
+  }
+  if (config.maxRejects == 0U) {
+    return Status(Err::INVALID_CONFIG, 0, "maxRejects must be at least 1");
+  }
+  _config = config;
+  _lambda = 1.0 - ldexp(1.0, -static_cast<int>(config.weightShift));
+  _stats = TickCorrelatorStats();
+  _fitted = 0U;
+  _valid = false;
+  _convBaseTicks = 0U;
+  _convMulInt = 0U;
+  _convMulFrac = 0U;
+  _convBaseFrac = 0U;
+  _convBaseMicros = 0;
+  _initialized = true;
+  return Ok();
+}
+
+void TickCorrelator::restart(uint64_t ticks, int64_t micros) {
+  _anchorTicks = ticks;
+  _anchorMicros = micros;
+  _weight = 1.0;
+  _meanX = 0.0;
+  _meanY = 0.0;
+  _cxx = 0.0;
+  _cxy = 0.0;
+  _cyy = 0.0;
+  _fitted = 1U;
+  _consecutiveRejects = 0U;
+  // Conversions keep the previous fit until the new one is valid.
+}
+
+double TickCorrelator::residualUs() const {
+  if ((_fitted < 2U) || (_cxx <= 0.0)) {
+    return 0.0;
+  }
+  const double sse = _cyy - (_cxy * _cxy) / _cxx;
+  return sse > 0.0 ? sqrt(sse / _weight) : 0.0;
+}
+
+// Snapshot the double fit as integer + Q32 fixed point.
+void TickCorrelator::publish() {
+  if (_slope >= MAX_SLOPE_US) {
+    _valid = false;  // slope outside what the fixed-point form can hold
+    return;
+  }
+  const double slopeInt = floor(_slope);
+  double slopeFrac = floor(ldexp(_slope - slopeInt, 32) + 0.5);
+  uint32_t mulInt = static_cast<uint32_t>(slopeInt);
+  if (slopeFrac >= Q32_ONE) {
+    slopeFrac = 0.0;  // rounding carried into the integer part
+    ++mulInt;
+  }
+  const double x = static_cast<double>(static_cast<int64_t>(_extendedTicks - _anchorTicks)) -
+                   static_cast<double>(HALF_RANGE_TICKS);
+  const double y = _meanY + _slope * (x - _meanX) + 0.5;  // +0.5: round to nearest
+  const double whole = floor(y);
+
+  _convBaseTicks = _lastRawTicks - HALF_RANGE_TICKS;
+  _convMulInt = mulInt;
+  _convMulFrac = static_cast<uint32_t>(slopeFrac);
+  _convBaseFrac = static_cast<uint32_t>(ldexp(y - whole, 32));
+  _convBaseMicros = _anchorMicros + static_cast<int64_t>(whole);
+}
+
+Status TickCorrelator::addSample(uint32_t ticks, int64_t micros) {
+  if (!_initialized) {
+    return Status(Err::NOT_INITIALIZED, 0, "TickCorrelator not initialized");
+  }
+  if ((_fitted == 0U) && (_stats.accepted == 0U)) {
+    _extendedTicks = ticks;
+  } else {
+    if (ticks < _lastRawTicks) {
+      ++_stats.wraps;
+    }
+    _extendedTicks += static_cast<uint32_t>(ticks - _lastRawTicks);
+  }
+  _lastRawTicks = ticks;
+
+  if (_fitted == 0U) {
+    restart(_extendedTicks, micros);
+    ++_stats.accepted;
+    return Ok();
+  }
+
+  const double x = static_cast<double>(static_cast<int64_t>(_extendedTicks - _anchorTicks));
+  const double y = static_cast<double>(micros - _anchorMicros);
+
+  if (_valid && (_config.outlierFactor != 0U)) {
+    const double residual = fabs(y - (_meanY + _slope * (x - _meanX)));
+    const double limit = _config.outlierFactor * residualUs() + _config.outlierFloorUs;
+    if (residual > limit) {
+      ++_stats.rejected;
+      if (++_consecutiveRejects >= _config.maxRejects) {
+        ++_stats.restarts;  // the counter or the clock jumped: start over
+        restart(_extendedTicks, micros);
+        _valid = false;
+        ++_stats.accepted;
+      }
+      return Ok();
+    }
+  }
+  _consecutiveRejects = 0U;
+
+  // Exponentially weighted Welford update.
+  _weight = _lambda * _weight + 1.0;
+  const double dx = x - _meanX;
+  const double dy = y - _meanY;
+  _meanX += dx / _weight;
+  _meanY += dy / _weight;
+  _cxx = _lambda * _cxx + dx * (x - _meanX);
+  _cxy = _lambda * _cxy + dx * (y - _meanY);
+  _cyy = _lambda * _cyy + dy * (y - _meanY);
+  ++_fitted;
+  ++_stats.accepted;
+
+  if ((_fitted >= _config.minSamples) && (_cxx > 0.0) && (_cxy > 0.0)) {
+    _slope = _cxy / _cxx;
+    _valid = true;
+    publish();
+  }
+
+  if (_extendedTicks - _anchorTicks > MAX_ANCHOR_SPAN_TICKS) {
+    // Move the origin to this sample; covariances are translation invariant.
+    _meanX -= x;
+    _meanY -= y;
+    _anchorTicks = _extendedTicks;
+    _anchorMicros = micros;
+  }
+  return Ok();
+}
+
+// Same arithmetic as the inline scalar form, with the snapshot hoisted into
+// locals so the loop body is branch-free and independent per element.
+void TickCorrelator::toMicros(const uint32_t* ticks, int64_t* out, size_t count) const {
+  const uint32_t baseTicks = _convBaseTicks;
+  const uint64_t mulInt = _convMulInt;
+  const uint64_t mulFrac = _convMulFrac;
+  const uint64_t baseFrac = _convBaseFrac;
+  const uint64_t baseMicros = static_cast<uint64_t>(_convBaseMicros);
+  for (size_t i = 0; i < count; ++i) {
+    const uint64_t d = ticks[i] - baseTicks;
+    out[i] = static_cast<int64_t>(baseMicros + d * mulInt + ((d * mulFrac + baseFrac) >> 32));
+  }
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,250 @@
+/**
+ * @file TimeSync.cpp
+ * @brief Implementation of the two-way time synchronization engine.
+ */
+
+#include "SystemChrono/TimeSync.h"
+
+#include "SystemChrono/SystemChrono.h"
+
+namespace SystemChrono {
+
+namespace {
+
+// Wire format (little endian):
+//   [0] magic  [1] type  [2..3] sequence  [4..11] t1  [12..19] t2  [20..27] t3
+static constexpr uint8_t PACKET_MAGIC = 0xC5U;
+static constexpr uint8_t TYPE_REQUEST = 1U;
+static constexpr uint8_t TYPE_RESPONSE = 2U;
+
+struct Packet {
+  uint8_t type;
+  uint16_t sequence;
+  int64_t t1;
+  int64_t t2;
+  int64_t t3;
+};
+
+static void putInt64(uint8_t* out, int64_t value) {
+  const uint64_t bits = static_cast<uint64_t>(value);
+  for (uint8_t i = 0; i < 8U; ++i) {
+    out[i] = static_cast<uint8_t>(bits >> (8U * i));
+  }
+}
+
+static int64_t getInt64(const uint8_t* in) {
+  uint64_t bits = 0U;
+  for (uint8_t i = 0; i < 8U; ++i) {
+    bits |= static_cast<uint64_t>(in[i]) << (8U * i);
+  }
+  return static_cast<int64_t>(bits);
+}
+
+static void encode(const Packet& packet, uint8_t* out) {
+  out[0] = PACKET_MAGIC;
+  out[1] = packet.type;
+  out[2] = static_cast<uint8_t>(packet.sequence);
+  out[3] = static_cast<uint8_t>(packet.sequence >> 8);
+  putInt64(out + 4, packet.t1);
+  putInt64(out + 12, packet.t2);
+  putInt64(out + 20, packet.t3);
+}
+
+static bool decode(const uint8_t* in, size_t len, Packet& packet) {
+  if ((len != TIMESYNC_PACKET_SIZE) || (in[0] != PACKET_MAGIC)) {
+    return false;
+  }
+  packet.type = in[1];
+  packet.sequence = static_cast<uint16_t>(in[2] | (static_cast<uint16_t>(in[3]) << 8));
+  packet.t1 = getInt64(in + 4);
+  packet.t2 = getInt64(in + 12);
+  packet.t3 = getInt64(in + 20);
+  return true;
+}
+
+static inline int64_t readClock(TimeSyncClockFn clock) {
+  return (clock != nullptr) ? clock() : micros64();
+}
+
+}  // namespace
+
+// ===========================================================================
+// TimeSyncServer
+// ===========================================================================
+
+TimeSyncServer::TimeSyncServer() : _transport(nullptr), _clock(nullptr), _answered(0U) {}
+
+Status TimeSyncServer::begin(TimeSyncTransport& transport, TimeSyncClockFn clock) {
+  _transport = &transport;
+  _clock = clock;
+  _answered = 0U;
+  return Ok();
+}
+
+Status TimeSyncServer::poll() {
+  if (_transport == nullptr) {
+    return Status(Err::NOT_INITIALIZED, 0, "TimeSyncServer not initialized");
+  }
+  uint8_t buf[TIMESYNC_PACKET_SIZE];
+  for (;;) {
+    size_t len = 0U;
+    const Status rx = _transport->receive(buf, sizeof(buf), len);
+    if (!rx.ok()) {
+      return rx;
+    }
+    if (len == 0U) {
+      return Ok();
+    }
+    const int64_t t2 = readClock(_clock);
+    Packet packet;
+    if (!decode(buf, len, packet) || (packet.type != TYPE_REQUEST)) {
+      continue;
+    }
+    packet.type = TYPE_RESPONSE;
+    packet.t2 = t2;
+    packet.t3 = readClock(_clock);
+    encode(packet, buf);
+    const Status tx = _transport->send(buf, sizeof(buf));
+    if (!tx.ok()) {
+      return tx;
+    }
+    ++_answered;
+  }
+}
+
+// ===========================================================================
+// TimeSyncClient
+// ===========================================================================
+
+TimeSyncClient::TimeSyncClient()
+    : _transport(nullptr),
+      _pendingT1Us(0),
+      _lastRequestUs(0),
+      _sequence(0U),
+      _count(0U),
+      _next(0U),
+      _waiting(false),
+      _requestNow(false) {}
+
+Status TimeSyncClient::begin(TimeSyncTransport& transport, const TimeSyncConfig& config) {
+  if ((config.minSamples == 0U) || (config.minSamples > TIMESYNC_FILTER_SIZE)) {
+    return Status(Err::INVALID_CONFIG, config.minSamples, "minSamples out of range");
+  }
+  if ((config.intervalUs == 0U) || (config.timeoutUs == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Interval and timeout must be non-zero");
+  }
+  _transport = &transport;
+  _config = config;
+  _best = TimeSyncSample();
+  _last = TimeSyncSample();
+  _stats = TimeSyncStats();
+  _pendingT1Us = 0;
+  _lastRequestUs = 0;
+  _count = 0U;
+  _next = 0U;
+  _waiting = false;
+  _requestNow = true;  // first exchange on the first poll()
+  return Ok();
+}
+
+void TimeSyncClient::requestNow() {
+  _requestNow = true;
+}
+
+bool TimeSyncClient::isSynchronized() const {
+  return (_transport != nullptr) && (_count >= _config.minSamples);
+}
+
+void TimeSyncClient::addSample(const TimeSyncSample& sample) {
+  _last = sample;
+  _window[_next] = sample;
+  _next = static_cast<uint8_t>((_next + 1U) % TIMESYNC_FILTER_SIZE);
+  if (_count < TIMESYNC_FILTER_SIZE) {
+    ++_count;
+  }
+  // Minimum-RTT selection over the window; ties prefer the newest sample.
+  uint8_t bestIndex = 0U;
+  int64_t bestDelay = 0;
+  int64_t bestT4 = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    const TimeSyncSample& s = _window[i];
+    if ((i == 0U) || (s.delayUs < bestDelay) ||
+        ((s.delayUs == bestDelay) && (s.t4Us > bestT4))) {
+      bestIndex = i;
+      bestDelay = s.delayUs;
+      bestT4 = s.t4Us;
+    }
+  }
+  _best = _window[bestIndex];
+}
+
+Status TimeSyncClient::poll() {
+  if (_transport == nullptr) {
+    return Status(Err::NOT_INITIALIZED, 0, "TimeSyncClient not initialized");
+  }
+  Status result = Ok();
+
+  uint8_t buf[TIMESYNC_PACKET_SIZE];
+  for (;;) {
+    size_t len = 0U;
+    const Status rx = _transport->receive(buf, sizeof(buf), len);
+    if (!rx.ok()) {
+      ++_stats.transportErrors;
+      result = rx;
+      break;
+    }
+    if (len == 0U) {
+      break;
+    }
+    const int64_t t4 = readClock(_config.clock);
+    Packet packet;
+    if (!decode(buf, len, packet) || (packet.type != TYPE_RESPONSE) || !_waiting ||
+        (packet.sequence != _sequence) || (packet.t1 != _pendingT1Us)) {
+      ++_stats.rejected;  // malformed, unsolicited or late reply
+      continue;
+    }
+    _waiting = false;
+    TimeSyncSample sample;
+    sample.delayUs = (t4 - packet.t1) - (packet.t3 - packet.t2);
+    sample.offsetUs = ((packet.t2 - packet.t1) + (packet.t3 - t4)) / 2;
+    sample.t4Us = t4;
+    if (sample.delayUs < 0) {
+      ++_stats.rejected;  // impossible timing: a clock stepped mid-exchange
+      continue;
+    }
+    ++_stats.samples;
+    addSample(sample);
+  }
+
+  const int64_t now = readClock(_config.clock);
+  if (_waiting && (now - _pendingT1Us >= static_cast<int64_t>(_config.timeoutUs))) {
+    ++_stats.timeouts;
+    _waiting = false;
+  }
+  if (!_waiting &&
+      (_requestNow || (now - _lastRequestUs >= static_cast<int64_t>(_config.intervalUs)))) {
+    Packet packet;
+    packet.type = TYPE_REQUEST;
+    packet.sequence = ++_sequence;
+    packet.t2 = 0;
+    packet.t3 = 0;
+    packet.t1 = readClock(_config.clock);
+    encode(packet, buf);
+    _requestNow = false;
+    _lastRequestUs = packet.t1;
+    const Status tx = _transport->send(buf, sizeof(buf));
+    if (tx.ok()) {
+      ++_stats.requests;
+      _pendingT1Us = packet.t1;
+      _waiting = true;
+    } else {
+      ++_stats.transportErrors;
+      if (result.ok()) {
+        result = tx;
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,144 @@
+/**
+ * @file TimerScheduler.cpp
+ * @brief Implementation of coalesced timers and their scheduler.
+ */
+
+#include "SystemChrono/TimerScheduler.h"
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/detail/SaturatingMath.h"
+
+namespace SystemChrono {
+
+// ===========================================================================
+// CoalescedTimer
+// ===========================================================================
+
+CoalescedTimer::CoalescedTimer(TimerScheduler& scheduler, TimerHandler& handler)
+    : _early(&scheduler._byStart, this),
+      _late(&scheduler._byEnd, this),
+      _handler(&handler),
+      _periodUs(0),
+      _slackUs(0U) {}
+
+Status CoalescedTimer::armAt(int64_t dueUs, uint32_t slackUs) {
+  _periodUs = 0;
+  _slackUs = slackUs;
+  return arm(dueUs);
+}
+
+Status CoalescedTimer::startAt(int64_t nowUs, int64_t periodUs, uint32_t slackUs) {
+  if ((periodUs <= 0) || (static_cast<int64_t>(slackUs) >= periodUs)) {
+    return Status(Err::INVALID_CONFIG, 0, "Period must be positive and exceed the slack");
+  }
+  _periodUs = periodUs;
+  _slackUs = slackUs;
+  return arm(detail::saturatingAdd(nowUs, periodUs));
+}
+
+Status CoalescedTimer::start(int64_t periodUs, uint32_t slackUs) {
+  return startAt(micros64(), periodUs, slackUs);
+}
+
+void CoalescedTimer::cancel() {
+  _early.cancel();
+  _late.cancel();
+}
+
+Status CoalescedTimer::arm(int64_t dueUs) {
+  Status status = _early.armAt(dueUs);
+  if (!status.ok()) {
+    _late.cancel();
+    return status;
+  }
+  status = _late.armAt(detail::saturatingAdd(dueUs, static_cast<int64_t>(_slackUs)));
+  if (!status.ok()) {
+    _early.cancel();
+  }
+  return status;
+}
+
+void CoalescedTimer::fire(int64_t nowUs) {
+  if (_periodUs > 0) {
+    // Next window on the grid that has not started yet. Re-arming in place
+    // never fails.
+    int64_t next = _early.dueUs() + _periodUs;
+    if (next <= nowUs) {
+      next += ((nowUs - next) / _periodUs + 1) * _periodUs;
+    }
+    (void)arm(next);
+  } else {
+    cancel();
+  }
+  _handler->onTimer(nowUs);
+}
+
+// ===========================================================================
+// TimerScheduler
+// ===========================================================================
+
+TimerScheduler::TimerScheduler() : _alignUs(0), _batches(0U), _dispatched(0U) {}
+
+Status TimerScheduler::begin(Deadline** storage, size_t capacity,
+                             const TimerSchedulerConfig& config) {
+  if ((storage == nullptr) || (capacity == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Scheduler storage is null or empty");
+  }
+  Status status = _byStart.begin(storage, capacity);
+  if (status.ok()) {
+    status = _byEnd.begin(storage + capacity, capacity);
+  }
+  if (!status.ok()) {
+    return status;
+  }
+  _alignUs = static_cast<int64_t>(config.alignUs);
+  return Ok();
+}
+
+int64_t TimerScheduler::nextWakeUs() const {
+  const int64_t end = _byEnd.nextDueUs();
+  if ((end == DEADLINE_NONE) || (_alignUs == 0)) {
+    return end;
+  }
+  int64_t remainder = end % _alignUs;
+  if (remainder < 0) {
+    remainder += _alignUs;
+  }
+  // The aligned wake must still fall inside the window that ends first;
+  // an earlier start of some other window does not make it useful.
+  const int64_t aligned = end - remainder;
+  const CoalescedTimer* first = static_cast<CoalescedTimer::Edge*>(_byEnd.peek())->owner;
+  return aligned >= first->dueUs() ? aligned : end;
+}
+
+int64_t TimerScheduler::idleForAt(int64_t nowUs) const {
+  const int64_t wake = nextWakeUs();
+  if (wake == DEADLINE_NONE) {
+    return DEADLINE_NONE;
+  }
+  return wake > nowUs ? wake - nowUs : 0;
+}
+
+uint32_t TimerScheduler::runAt(int64_t nowUs) {
+  const size_t limit = _byStart.size();
+  uint32_t ran = 0U;
+  while (ran < limit) {
+    Deadline* first = _byStart.peek();
+    if ((first == nullptr) || (first->dueUs() > nowUs)) {
+      break;
+    }
+    static_cast<CoalescedTimer::Edge*>(first)->owner->fire(nowUs);
+    ++ran;
+  }
+  if (ran > 0U) {
+    ++_batches;
+    _dispatched += ran;
+  }
+  return ran;
+}
+
+uint32_t TimerScheduler::run() {
+  return runAt(micros64());
+}
+
+}  // namespace SystemChrono
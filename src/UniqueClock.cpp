@@ -0,0 +1,50 @@
+/**
+ * @file UniqueClock.cpp
+ * @brief Implementation of uniqueMicros64().
+ */
+
+#include "SystemChrono/UniqueClock.h"
+
+#include <atomic>
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/VirtualClock.h"
+
+namespace SystemChrono {
+
+namespace {
+
+std::atomic<int64_t> g_lastUs(0);
+
+}  // namespace
+
+int64_t uniqueMicros64() {
+  int64_t last = g_lastUs.load(std::memory_order_relaxed);
+  for (;;) {
+    const int64_t now = micros64();
+    int64_t candidate = (now > last) ? now : last + 1;
+    if ((candidate - now > UNIQUE_MICROS_MAX_SKEW_US) && !isVirtualClockEnabled()) {
+      // `last` was loaded before `now`, so a lead beyond the bound cannot
+      // come from this loop: it was left by virtual time. Waiting for real
+      // time to catch up could take hours, so restart at the clock.
+      if (last - now > UNIQUE_MICROS_MAX_SKEW_US) {
+        candidate = now;
+      } else {
+        // Running ahead of real time: wait for the clock to catch up.
+        last = g_lastUs.load(std::memory_order_relaxed);
+        continue;
+      }
+    }
+    // On failure `last` is refreshed with the winner's value.
+    if (g_lastUs.compare_exchange_weak(last, candidate, std::memory_order_acq_rel,
+                                       std::memory_order_relaxed)) {
+      return candidate;
+    }
+  }
+}
+
+int64_t lastUniqueMicros64() {
+  return g_lastUs.load(std::memory_order_acquire);
+}
+
+}  // namespace SystemChrono
@@ -0,0 +1,224 @@
+/**
+ * @file VirtualClock.cpp
+ * @brief Implementation of the deterministic virtual clock.
+ */
+
+#include "SystemChrono/VirtualClock.h"
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+  #include <atomic>
+
+  #include "SystemChrono/detail/SaturatingMath.h"
+#endif
+
+namespace SystemChrono {
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+
+namespace {
+
+// Readers (micros64) only touch g_enabled and g_nowUs. The wakeup heap is
+// owned by the simulation driver.
+static std::atomic<bool> g_enabled(false);
+static std::atomic<int64_t> g_nowUs(0);
+
+static VirtualWakeup* g_heap = nullptr;
+static size_t g_capacity = 0U;
+static size_t g_size = 0U;
+static uint32_t g_nextSeq = 0U;
+
+static inline bool earlier(const VirtualWakeup& a, const VirtualWakeup& b) {
+  if (a.atUs != b.atUs) {
+    return a.atUs < b.atUs;
+  }
+  return static_cast<int32_t>(a.seq - b.seq) < 0;  // wrap-safe FIFO tie-break
+}
+
+static void siftUp(size_t index) {
+  const VirtualWakeup item = g_heap[index];
+  while (index > 0U) {
+    const size_t parent = (index - 1U) / 2U;
+    if (!earlier(item, g_heap[parent])) {
+      break;
+    }
+    g_heap[index] = g_heap[parent];
+    index = parent;
+  }
+  g_heap[index] = item;
+}
+
+static void siftDown(size_t index) {
+  const VirtualWakeup item = g_heap[index];
+  for (;;) {
+    size_t child = 2U * index + 1U;
+    if (child >= g_size) {
+      break;
+    }
+    if ((child + 1U < g_size) && earlier(g_heap[child + 1U], g_heap[child])) {
+      ++child;
+    }
+    if (!earlier(g_heap[child], item)) {
+      break;
+    }
+    g_heap[index] = g_heap[child];
+    index = child;
+  }
+  g_heap[index] = item;
+}
+
+}  // namespace
+
+Status enableVirtualClock(int64_t startUs, VirtualWakeup* wakeupStorage, size_t wakeupCapacity) {
+  if (startUs < 0) {
+    return Status(Err::INVALID_CONFIG, 0, "Virtual start time is negative");
+  }
+  if ((wakeupStorage == nullptr) != (wakeupCapacity == 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Wakeup storage and capacity mismatch");
+  }
+  g_heap = wakeupStorage;
+  g_capacity = wakeupCapacity;
+  g_size = 0U;
+  g_nextSeq = 0U;
+  g_nowUs.store(startUs, std::memory_order_relaxed);
+  g_enabled.store(true, std::memory_order_release);
+  return Ok();
+}
+
+void disableVirtualClock() {
+  g_enabled.store(false, std::memory_order_release);
+  g_heap = nullptr;
+  g_capacity = 0U;
+  g_size = 0U;
+}
+
+bool isVirtualClockEnabled() {
+  return g_enabled.load(std::memory_order_acquire);
+}
+
+Status advanceVirtualClock(int64_t deltaUs) {
+  if (!isVirtualClockEnabled()) {
+    return Status(Err::NOT_INITIALIZED, 0, "Virtual clock not enabled");
+  }
+  if (deltaUs < 0) {
+    return Status(Err::INVALID_CONFIG, 0, "Virtual time cannot move backwards");
+  }
+  const int64_t now = g_nowUs.load(std::memory_order_relaxed);
+  g_nowUs.store(detail::saturatingAdd(now, deltaUs), std::memory_order_release);
+  return Ok();
+}
+
+Status advanceVirtualClockTo(int64_t timeUs) {
+  if (!isVirtualClockEnabled()) {
+    return Status(Err::NOT_INITIALIZED, 0, "Virtual clock not enabled");
+  }
+  if (timeUs < g_nowUs.load(std::memory_order_relaxed)) {
+    return Status(Err::INVALID_CONFIG, 0, "Virtual time cannot move backwards");
+  }
+  g_nowUs.store(timeUs, std::memory_order_release);
+  return Ok();
+}
+
+Status scheduleVirtualWakeup(int64_t atUs, uint32_t tag) {
+  if (!isVirtualClockEnabled()) {
+    return Status(Err::NOT_INITIALIZED, 0, "Virtual clock not enabled");
+  }
+  if (g_size >= g_capacity) {
+    return Status(Err::OUT_OF_MEMORY, static_cast<int32_t>(g_capacity),
+                  "Virtual wakeup storage full");
+  }
+  VirtualWakeup& slot = g_heap[g_size];
+  slot.atUs = atUs;
+  slot.tag = tag;
+  slot.seq = g_nextSeq++;
+  siftUp(g_size);
+  ++g_size;
+  return Ok();
+}
+
+bool advanceToNextVirtualWakeup(VirtualWakeup* fired) {
+  if (!isVirtualClockEnabled() || (g_size == 0U)) {
+    return false;
+  }
+  const VirtualWakeup top = g_heap[0];
+  --g_size;
+  if (g_size > 0U) {
+    g_heap[0] = g_heap[g_size];
+    siftDown(0U);
+  }
+  if (top.atUs > g_nowUs.load(std::memory_order_relaxed)) {
+    g_nowUs.store(top.atUs, std::memory_order_release);
+  }
+  if (fired != nullptr) {
+    *fired = top;
+  }
+  return true;
+}
+
+size_t pendingVirtualWakeups() {
+  return isVirtualClockEnabled() ? g_size : 0U;
+}
+
+namespace detail {
+
+bool readVirtualClock(int64_t& outUs) {
+  if (!g_enabled.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  outUs = g_nowUs.load(std::memory_order_acquire);
+  return true;
+}
+
+}  // namespace detail
+
+#else  // !SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK
+
+Status enableVirtualClock(int64_t startUs, VirtualWakeup* wakeupStorage, size_t wakeupCapacity) {
+  (void)startUs;
+  (void)wakeupStorage;
+  (void)wakeupCapacity;
+  return Status(Err::INVALID_CONFIG, 0, "Built without SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK");
+}
+
+void disableVirtualClock() {}
+
+bool isVirtualClockEnabled() {
+  return false;
+}
+
+Status advanceVirtualClock(int64_t deltaUs) {
+  (void)deltaUs;
+  return Status(Err::NOT_INITIALIZED, 0, "Virtual clock not enabled");
+}
+
+Status advanceVirtualClockTo(int64_t timeUs) {
+  (void)timeUs;
+  return Status(Err::NOT_INITIALIZED, 0, "Virtual clock not enabled");
+}
+
+Status scheduleVirtualWakeup(int64_t atUs, uint32_t tag) {
+  (void)atUs;
+  (void)tag;
+  return Status(Err::NOT_INITIALIZED, 0, "Virtual clock not enabled");
+}
+
+bool advanceToNextVirtualWakeup(VirtualWakeup* fired) {
+  (void)fired;
+  return false;
+}
+
+size_t pendingVirtualWakeups() {
+  return 0U;
+}
+
+namespace detail {
+
+bool readVirtualClock(int64_t& outUs) {
+  (void)outUs;
+  return false;
+}
+
+}  // namespace detail
+
+#endif  // SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK
+
+}  // namespace SystemChrono
@@ -0,0 +1,216 @@
+/**
+ * @file WindowAggregator.cpp
+ * @brief Implementation of the time-bucketed aggregator.
+ */
+
+#include "SystemChrono/WindowAggregator.h"
+
+#include <limits>
+
+namespace SystemChrono {
+
+namespace {
+
+static constexpr int32_t VALUE_MAX = (std::numeric_limits<int32_t>::max)();
+static constexpr int32_t VALUE_MIN = (std::numeric_limits<int32_t>::min)();
+// Keeps bucket arithmetic on int64_t timestamps free of overflow.
+static constexpr uint64_t MAX_BUCKET_US = 1ULL << 60;
+
+static inline void mergeStats(WindowStats& into, const WindowStats& from) {
+  if (from.count == 0U) {
+    return;
+  }
+  into.min = from.min < into.min ? from.min : into.min;
+  into.max = from.max > into.max ? from.max : into.max;
+  into.last = from.last;
+  into.sum += from.sum;
+  into.count += from.count;
+}
+
+static inline void clearIfEmpty(WindowStats& stats) {
+  if (stats.count == 0U) {
+    stats.min = 0;
+    stats.max = 0;
+    stats.last = 0;
+  }
+}
+
+}  // namespace
+
+WindowAggregator::WindowAggregator()
+    : _ring(),
+      _open(),
+      _sink(nullptr),
+      _next(nullptr),
+      _bucketUs(0U),
+      _openSpanUs(0U),
+      _late(0U),
+      _hops(1U),
+      _ringHead(0U),
+      _emptyRun(0U),
+      _started(false),
+      _initialized(false) {}
+
+Status WindowAggregator::begin(const WindowConfig& config, WindowSink* sink) {
+  if ((config.bucketUs == 0U) || (config.bucketUs > MAX_BUCKET_US)) {
+    return Status(Err::INVALID_CONFIG, 0, "bucketUs must be non-zero and below 2^60");
+  }
+  if ((config.hops == 0U) || (config.hops > WINDOW_MAX_HOPS)) {
+    return Status(Err::INVALID_CONFIG, config.hops, "hops must be 1..WINDOW_MAX_HOPS");
+  }
+  _sink = sink;
+  _next = nullptr;
+  _bucketUs = config.bucketUs;
+  _openSpanUs = 0U;
+  _late = 0U;
+  _hops = config.hops;
+  _ringHead = 0U;
+  _emptyRun = config.hops;  // nothing seen yet: the window is empty
+  for (uint8_t i = 0U; i < WINDOW_MAX_HOPS; ++i) {
+    _ring[i] = WindowStats();
+  }
+  _open = WindowStats();
+  _started = false;
+  _initialized = true;
+  return Ok();
+}
+
+Status WindowAggregator::cascadeTo(WindowAggregator& next) {
+  if (!_initialized || !next._initialized) {
+    return Status(Err::NOT_INITIALIZED, 0, "WindowAggregator not initialized");
+  }
+  if ((&next == this) || ((next._bucketUs % _bucketUs) != 0U)) {
+    return Status(Err::INVALID_CONFIG, 0, "Cascade bucket must be a multiple of this bucket");
+  }
+  _next = &next;
+  return Ok();
+}
+
+int64_t WindowAggregator::bucketStart(int64_t micros) const {
+  const int64_t width = static_cast<int64_t>(_bucketUs);
+  int64_t rem = micros % width;
+  rem = rem < 0 ? rem + width : rem;
+  return micros - rem;
+}
+
+void WindowAggregator::resetOpen(int64_t startUs) {
+  _open = WindowStats();
+  _open.startUs = startUs;
+  _open.endUs = startUs + static_cast<int64_t>(_bucketUs);
+  _open.min = VALUE_MAX;
+  _open.max = VALUE_MIN;
+}
+
+void WindowAggregator::emitWindow(int64_t endUs) {
+  WindowStats window;
+  window.startUs = endUs - static_cast<int64_t>(_bucketUs) * _hops;
+  window.endUs = endUs;
+  window.min = VALUE_MAX;
+  window.max = VALUE_MIN;
+  uint8_t slot = _ringHead;  // oldest first, so `last` ends on the newest
+  for (uint8_t i = 0U; i < _hops; ++i) {
+    mergeStats(window, _ring[slot]);
+    slot = (slot + 1U == _hops) ? 0U : static_cast<uint8_t>(slot + 1U);
+  }
+  clearIfEmpty(window);
+  _sink->onWindow(window);
+}
+
+void WindowAggregator::closeBucket() {
+  WindowStats done = _open;
+  clearIfEmpty(done);
+  _ring[_ringHead] = done;
+  _ringHead = (_ringHead + 1U == _hops) ? 0U : static_cast<uint8_t>(_ringHead + 1U);
+  if (done.count != 0U) {
+    _emptyRun = 0U;
+  } else if (_emptyRun < _hops) {
+    ++_emptyRun;
+  }
+  if (_sink != nullptr) {
+    if (_hops == 1U) {
+      _sink->onWindow(done);
+    } else {
+      emitWindow(done.endUs);
+    }
+  }
+  if (_next != nullptr) {
+    _next->addBucket(done);
+  }
+  resetOpen(done.endUs);
+}
+
+void WindowAggregator::advanceTo(int64_t bucketStartUs) {
+  while (_open.startUs < bucketStartUs) {
+    if ((_open.count == 0U) && (_emptyRun + 1U >= _hops)) {
+      // Every window from here to bucketStartUs is empty: one record covers
+      // the whole gap instead of one per bucket.
+      WindowStats gap;
+      gap.startUs = _open.startUs;
+      gap.endUs = bucketStartUs;
+      _ring[_ringHead] = WindowStats();
+      _ringHead = (_ringHead + 1U == _hops) ? 0U : static_cast<uint8_t>(_ringHead + 1U);
+      _emptyRun = _hops;
+      if (_sink != nullptr) {
+        _sink->onWindow(gap);
+      }
+      if (_next != nullptr) {
+        _next->addBucket(gap);
+      }
+      resetOpen(bucketStartUs);
+      return;
+    }
+    closeBucket();
+  }
+}
+
+void WindowAggregator::addSlow(int64_t micros, int32_t value) {
+  if (!_initialized) {
+    return;
+  }
+  if (!_started) {
+    _started = true;
+    _openSpanUs = _bucketUs;
+    resetOpen(bucketStart(micros));
+  } else if (micros < _open.startUs) {
+    ++_late;
+    return;
+  } else {
+    advanceTo(bucketStart(micros));
+  }
+  add(micros, value);
+}
+
+void WindowAggregator::addBucket(const WindowStats& bucket) {
+  if (!_initialized) {
+    return;
+  }
+  if (bucket.count == 0U) {
+    if (_started && (bucket.endUs > _open.startUs)) {
+      advanceTo(bucketStart(bucket.endUs));
+    }
+    return;
+  }
+  if (!_started) {
+    _started = true;
+    _openSpanUs = _bucketUs;
+    resetOpen(bucketStart(bucket.startUs));
+  } else if (bucket.startUs < _open.startUs) {
+    _late += bucket.count;
+    return;
+  } else {
+    advanceTo(bucketStart(bucket.startUs));
+  }
+  mergeStats(_open, bucket);
+  if (bucket.endUs >= _open.endUs) {
+    closeBucket();  // the finer stage completed our last sub-bucket
+  }
+}
+
+void WindowAggregator::flush(int64_t nowUs) {
+  if (!_started) {
+    return;
+  }
+  advanceTo(bucketStart(nowUs));
+}
+
+}  // namespace SystemChrono
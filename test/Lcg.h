@@ -0,0 +1,52 @@
+/**
+ * @file Lcg.h
+ * @brief Seeded random numbers for the host tests and benchmarks.
+ *
+ * Shared by test/ and bench/ (the benchmarks add test/ to their include
+ * path), so both draw from the same generator.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace test {
+
+/**
+ * @brief Seeded linear congruential generator for reproducible simulations.
+ *
+ * Numerical Recipes constants; the low 8 bits are dropped because they
+ * have short periods. Each file seeds its own generator, so sequences do
+ * not depend on which other code drew first.
+ */
+class Lcg {
+ public:
+  explicit Lcg(uint32_t seed) : _state(seed) {}
+
+  /// @brief Uniform in [0, range); 0 (still advancing) when range is 0.
+  uint32_t next(uint32_t range) {
+    _state = _state * 1664525U + 1013904223U;
+    return range == 0U ? 0U : (_state >> 8) % range;
+  }
+
+  /// @brief Uniform in [lo, hi].
+  int64_t uniform(int64_t lo, int64_t hi) {
+    return lo + static_cast<int64_t>(next(static_cast<uint32_t>(hi - lo + 1)));
+  }
+
+  /// @brief Uniform in [-amplitude, amplitude].
+  int64_t noise(uint32_t amplitude) {
+    return static_cast<int64_t>(next(2U * amplitude + 1U)) - amplitude;
+  }
+
+  /// @brief Uniform in [0, 1), 24-bit resolution.
+  double unit() {
+    _state = _state * 1664525U + 1013904223U;
+    return static_cast<double>(_state >> 8) / 16777216.0;
+  }
+
+ private:
+  uint32_t _state;
+};
+
+}  // namespace test
@@ -0,0 +1,65 @@
+/**
+ * @file TestSupport.h
+ * @brief Minimal assertion helpers for the host unit tests.
+ *
+ * Each test file is its own executable: it calls its test functions from
+ * main() and returns testExitCode(). Simulations draw from a seeded Lcg.
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+#include "Lcg.h"
+
+namespace test {
+
+inline int& failureCount() {
+  static int failures = 0;
+  return failures;
+}
+
+inline int testExitCode() {
+  if (failureCount() == 0) {
+    printf("OK\n");
+    return 0;
+  }
+  printf("%d check(s) failed\n", failureCount());
+  return 1;
+}
+
+}  // namespace test
+
+/// @brief Record a failure if `cond` is false.
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);   \
+      ++test::failureCount();                                           \
+    }                                                                   \
+  } while (0)
+
+/// @brief Record a failure if two integer values differ.
+#define CHECK_EQ(actual, expected)                                      \
+  do {                                                                  \
+    const long long checkActual = static_cast<long long>(actual);       \
+    const long long checkExpected = static_cast<long long>(expected);   \
+    if (checkActual != checkExpected) {                                 \
+      printf("%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, \
+             __LINE__, #actual, #expected, checkActual, checkExpected); \
+      ++test::failureCount();                                           \
+    }                                                                   \
+  } while (0)
+
+/// @brief Record a failure if |actual - expected| > tolerance.
+#define CHECK_NEAR(actual, expected, tolerance)                         \
+  do {                                                                  \
+    const double checkActual = static_cast<double>(actual);             \
+    const double checkExpected = static_cast<double>(expected);         \
+    const double checkDiff = checkActual - checkExpected;               \
+    if ((checkDiff > (tolerance)) || (checkDiff < -(tolerance))) {      \
+      printf("%s:%d: CHECK_NEAR(%s, %s) failed: %g vs %g\n", __FILE__,  \
+             __LINE__, #actual, #expected, checkActual, checkExpected); \
+      ++test::failureCount();                                           \
+    }                                                                   \
+  } while (0)
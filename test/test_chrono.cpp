@@ -0,0 +1,121 @@
+/**
+ * @file test_chrono.cpp
+ * @brief steady_clock adapter and std::chrono overloads of the core API.
+ */
+
+#include <string.h>
+
+#include <chrono>
+#include <type_traits>
+
+#include "SystemChrono/Chrono.h"
+#include "SystemChrono/VirtualClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+using std::chrono::duration_cast;
+using std::chrono::hours;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::minutes;
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+
+namespace {
+
+// TrivialClock requirements, checked at compile time.
+static_assert(std::is_same<steady_clock::duration, microseconds>::value,
+              "duration must be std::chrono::microseconds");
+static_assert(std::is_same<steady_clock::time_point::clock, steady_clock>::value,
+              "time_point must refer to steady_clock");
+static_assert(std::is_same<steady_clock::rep, int64_t>::value, "rep must be int64_t");
+static_assert(steady_clock::is_steady, "steady_clock must be steady");
+static_assert(noexcept(steady_clock::now()), "now() must be noexcept");
+static_assert(steady_clock::to_micros64(steady_clock::from_micros64(42)) == 42,
+              "micros64 round trip must be constexpr (C++14 and later)");
+
+// Lossless conversions are implicit; lossy ones must not compile.
+static_assert(std::is_convertible<milliseconds, microseconds>::value, "ms -> us");
+static_assert(!std::is_convertible<nanoseconds, microseconds>::value, "ns -> us is lossy");
+
+void testNowFollowsMicros64() {
+  const int64_t before = micros64();
+  const steady_clock::time_point now = steady_clock::now();
+  const int64_t after = micros64();
+  CHECK(steady_clock::to_micros64(now) >= before);
+  CHECK(steady_clock::to_micros64(now) <= after);
+
+  steady_clock::time_point prev = steady_clock::now();
+  for (int i = 0; i < 1000; ++i) {
+    const steady_clock::time_point t = steady_clock::now();
+    CHECK(t >= prev);
+    prev = t;
+  }
+}
+
+void testFormatters() {
+  char buf[TIME_FORMAT_BUFFER_SIZE];
+  CHECK(formatTimeTo(hours(1) + minutes(23) + seconds(45) + milliseconds(678), buf, sizeof(buf))
+            .ok());
+  CHECK(strcmp(buf, "1:23:45.678") == 0);
+  CHECK(formatTimeTo(steady_clock::from_micros64(1500000), buf, sizeof(buf)).ok());
+  CHECK(strcmp(buf, "0:00:01.500") == 0);
+  CHECK(formatTime(seconds(-2)) == "-0:00:02.000");
+  CHECK(formatTimeTo(milliseconds(1), nullptr, 0U).code == Err::INVALID_CONFIG);
+}
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+void testTimersWithDurations() {
+  CHECK(enableVirtualClock(0).ok());
+
+  const steady_clock::time_point t0 = steady_clock::now();
+  Stopwatch sw;
+  sw.start();
+  ElapsedMicros64 us(milliseconds(5));
+  ElapsedMillis64 ms;
+  ElapsedSeconds64 s(minutes(1));
+  CHECK(us.elapsed() == microseconds(5000));
+  CHECK(s.elapsed() == seconds(60));
+
+  CHECK(advanceVirtualClock(2500000).ok());
+  CHECK(steady_clock::now() - t0 == milliseconds(2500));
+  CHECK(duration_cast<seconds>(steady_clock::now() - t0) == seconds(2));
+  CHECK(sw.elapsed() == milliseconds(2500));
+  CHECK(us.elapsed() == microseconds(2505000));
+  CHECK(ms.elapsed() == milliseconds(2500));
+  CHECK(s.elapsed() == seconds(62));
+
+  us = seconds(1);
+  CHECK_EQ(static_cast<int64_t>(us), 1000000);
+  us += milliseconds(3);
+  CHECK_EQ(static_cast<int64_t>(us), 1003000);
+  us -= microseconds(3000);
+  CHECK_EQ(static_cast<int64_t>(us), 1000000);
+  ms = seconds(2);
+  CHECK_EQ(static_cast<int64_t>(ms), 2000);
+  ms -= milliseconds(500);
+  CHECK_EQ(static_cast<int64_t>(ms), 1500);
+  s = hours(1);
+  CHECK_EQ(static_cast<int64_t>(s), 3600);
+  s += minutes(1);
+  CHECK_EQ(static_cast<int64_t>(s), 3660);
+
+  disableVirtualClock();
+}
+#else
+void testTimersWithDurations() {
+  ElapsedMillis64 ms(seconds(2));
+  CHECK(ms.elapsed() >= milliseconds(2000));
+  Stopwatch sw;
+  CHECK(sw.elapsed() == microseconds(0));
+}
+#endif
+
+}  // namespace
+
+int main() {
+  testNowFollowsMicros64();
+  testFormatters();
+  testTimersWithDurations();
+  return test::testExitCode();
+}
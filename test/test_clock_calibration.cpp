@@ -0,0 +1,123 @@
+/**
+ * @file test_clock_calibration.cpp
+ * @brief Clock-read calibration against a simulated clock with known costs.
+ */
+
+#include "SystemChrono/ClockCalibration.h"
+#include "SystemChrono/SystemChrono.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+/// Simulated microsecond clock: every read costs a known number of nanoseconds.
+struct SimulatedClock {
+  int64_t* nowNs;
+  int64_t* reads;
+  const int32_t* costsNs;
+  uint32_t costCount;
+  uint32_t readsPerCost;
+
+  int64_t operator()() {
+    const uint32_t slot = static_cast<uint32_t>((*reads / readsPerCost) % costCount);
+    *nowNs += costsNs[slot];
+    ++*reads;
+    return *nowNs / 1000;
+  }
+};
+
+void testFixedReadCost() {
+  static const int32_t costs[] = {250};
+  int64_t nowNs = 123456;
+  int64_t reads = 0;
+  const SimulatedClock clock = {&nowNs, &reads, costs, 1U, 1U};
+
+  ClockCalibration cal;
+  CHECK(measureClockReadCost(clock, 9U, 999U, cal).ok());
+  CHECK(cal.valid);
+  CHECK_EQ(cal.readCostNs, 250);
+  CHECK_EQ(cal.jitterNs, 0);
+  CHECK_EQ(cal.blocks, 9);
+  CHECK_EQ(cal.readsPerBlock, 999);
+  CHECK_EQ(reads, 9 * 1001);
+}
+
+void testJitteredReadCost() {
+  // Cost changes every block (1001 reads): 240, 250, 260, 240, ...
+  static const int32_t costs[] = {240, 250, 260};
+  int64_t nowNs = 0;
+  int64_t reads = 0;
+  const SimulatedClock clock = {&nowNs, &reads, costs, 3U, 1001U};
+
+  ClockCalibration cal;
+  CHECK(measureClockReadCost(clock, 9U, 999U, cal).ok());
+  CHECK_EQ(cal.readCostNs, 250);
+  CHECK_EQ(cal.jitterNs, 10);
+}
+
+void testInvalidConfig() {
+  static const int32_t costs[] = {100};
+  int64_t nowNs = 0;
+  int64_t reads = 0;
+  const SimulatedClock clock = {&nowNs, &reads, costs, 1U, 1U};
+
+  ClockCalibration cal;
+  CHECK(measureClockReadCost(clock, 0U, 10U, cal).code == Err::INVALID_CONFIG);
+  CHECK(measureClockReadCost(clock, CALIBRATION_MAX_BLOCKS + 1U, 10U, cal).code ==
+        Err::INVALID_CONFIG);
+  CHECK(measureClockReadCost(clock, 5U, 0U, cal).code == Err::INVALID_CONFIG);
+  CHECK_EQ(reads, 0);
+}
+
+void testCompensateReadOverhead() {
+  clearClockCalibration();
+  CHECK(!clockCalibration().valid);
+  CHECK_EQ(compensateReadOverhead(10, 3U), 10);
+
+  ClockCalibration cal;
+  cal.readCostNs = 400;
+  setClockCalibration(cal);
+  CHECK(clockCalibration().valid);
+  CHECK_EQ(compensateReadOverhead(10, 1U), 10);  // 0.4 us rounds to 0
+  CHECK_EQ(compensateReadOverhead(10, 3U), 9);   // 1.2 us rounds to 1
+  CHECK_EQ(compensateReadOverhead(10, 5U), 8);
+  CHECK_EQ(compensateReadOverhead(1, 10U), 0);   // never below zero
+  CHECK_EQ(compensateReadOverhead(0, 10U), 0);
+  clearClockCalibration();
+}
+
+void testStopwatchCompensationIsOptIn() {
+  ClockCalibration cal;
+  cal.readCostNs = 1000000000;  // 1 s per read: any short interval compensates to 0
+  setClockCalibration(cal);
+
+  Stopwatch sw;
+  CHECK(!sw.isOverheadCompensated());
+  sw.start();
+  sw.stop();
+  const int64_t raw = sw.elapsedMicros();
+  CHECK(raw >= 0);
+
+  sw.setOverheadCompensation(true);
+  CHECK(sw.isOverheadCompensated());
+  CHECK_EQ(sw.elapsedMicros(), 0);
+
+  sw.setOverheadCompensation(false);
+  CHECK_EQ(sw.elapsedMicros(), raw);
+
+  ElapsedMicros64 timer;
+  CHECK_EQ(timer.compensated(), 0);
+  clearClockCalibration();
+}
+
+}  // namespace
+
+int main() {
+  testFixedReadCost();
+  testJitteredReadCost();
+  testInvalidConfig();
+  testCompensateReadOverhead();
+  testStopwatchCompensationIsOptIn();
+  return test::testExitCode();
+}
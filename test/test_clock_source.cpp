@@ -0,0 +1,109 @@
+/**
+ * @file test_clock_source.cpp
+ * @brief Templated timers and *Since() helpers on a simulated clock.
+ */
+
+#include <type_traits>
+
+#include "SystemChrono/ClockSource.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+struct FakeClock {
+  static int64_t now;
+  static int64_t nowMicros() { return now; }
+};
+int64_t FakeClock::now = 0;
+
+struct NotAClock {};
+
+static_assert(IsClockSource<SystemClock>::value, "SystemClock must be a ClockSource");
+static_assert(IsClockSource<FakeClock>::value, "FakeClock must be a ClockSource");
+static_assert(!IsClockSource<NotAClock>::value, "NotAClock must be rejected");
+static_assert(!IsClockSource<int>::value, "int must be rejected");
+static_assert(std::is_same<BasicStopwatch<>, BasicStopwatch<SystemClock>>::value,
+              "BasicStopwatch defaults to SystemClock");
+static_assert(std::is_same<BasicElapsed<>, BasicElapsed<SystemClock, 1>>::value,
+              "BasicElapsed defaults to SystemClock microseconds");
+static_assert(std::is_same<BasicElapsedMillis64<>, BasicElapsed<SystemClock, 1000>>::value,
+              "BasicElapsedMillis64 defaults to SystemClock");
+
+void testSinceHelpers() {
+  FakeClock::now = 5000000;
+  CHECK_EQ(microsSince<FakeClock>(4000000), 1000000);
+  CHECK_EQ(millisSince<FakeClock>(4000), 1000);
+  CHECK_EQ(secondsSince<FakeClock>(3), 2);
+  CHECK_EQ(microsSince<FakeClock>(INT64_MIN), INT64_MAX);
+}
+
+void testStopwatch() {
+  FakeClock::now = 1000;
+  BasicStopwatch<FakeClock> sw;
+  CHECK(!sw.isRunning());
+  sw.start();
+  FakeClock::now += 2500;
+  CHECK_EQ(sw.elapsedMicros(), 2500);
+  sw.stop();
+  FakeClock::now += 10000;
+  CHECK_EQ(sw.elapsedMicros(), 2500);
+  sw.resume();
+  FakeClock::now += 1500000;
+  CHECK_EQ(sw.elapsedMicros(), 1502500);
+  CHECK_EQ(sw.elapsedMillis(), 1502);
+  CHECK_EQ(sw.elapsedSeconds(), 1);
+  sw.reset();
+  CHECK(sw.isRunning());
+  CHECK_EQ(sw.elapsedMicros(), 0);
+  FakeClock::now += 7;
+  CHECK_EQ(sw.elapsedMicros(), 7);
+}
+
+void testElapsed() {
+  FakeClock::now = 0;
+  BasicElapsedMillis64<FakeClock> ms;
+  FakeClock::now = 1999;
+  CHECK_EQ(static_cast<int64_t>(ms), 1);
+  ms = 0;
+  FakeClock::now += 5000;
+  CHECK_EQ(static_cast<int64_t>(ms), 5);
+  ms -= 5;
+  CHECK_EQ(static_cast<int64_t>(ms), 0);
+  const int64_t tenMs = 10;
+  const BasicElapsedMillis64<FakeClock> later = ms + tenMs;
+  CHECK_EQ(static_cast<int64_t>(later), 10);
+
+  BasicElapsedMicros64<FakeClock> us(250);
+  CHECK_EQ(static_cast<int64_t>(us), 250);
+
+  BasicElapsedSeconds64<FakeClock> s(60);
+  FakeClock::now += 1000000;
+  CHECK_EQ(static_cast<int64_t>(s), 61);
+  BasicElapsedSeconds64<FakeClock> huge(INT64_MAX);
+  CHECK(static_cast<int64_t>(huge) > 0);  // saturated, no overflow
+}
+
+void testSystemClockMatchesDefault() {
+  const int64_t start = micros64();
+  BasicElapsedMicros64<> timer;  // started first, read last
+  BasicStopwatch<> sw;
+  sw.start();
+  while (microsSince<SystemClock>(start) < 1000) {
+  }
+  sw.stop();
+  CHECK(sw.elapsedMicros() > 0);
+  CHECK(static_cast<int64_t>(timer) >= sw.elapsedMicros());
+  CHECK(microsSince(start) >= 1000);
+}
+
+}  // namespace
+
+int main() {
+  testSinceHelpers();
+  testStopwatch();
+  testElapsed();
+  testSystemClockMatchesDefault();
+  return test::testExitCode();
+}
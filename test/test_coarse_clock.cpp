@@ -0,0 +1,118 @@
+/**
+ * @file test_coarse_clock.cpp
+ * @brief Coarse cached clock, its timers, and the tear-free 64-bit cells.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include "SystemChrono/CoarseClock.h"
+#include "SystemChrono/VirtualClock.h"
+#include "SystemChrono/detail/Int64Cell.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+void testUpdateAndRead() {
+  updateCoarseClock();
+  const int64_t us = micros64Coarse();
+  CHECK(us > 0);
+  CHECK(us <= micros64());
+  CHECK_EQ(millis64Coarse(), us / 1000);
+  CHECK_EQ(seconds64Coarse(), us / 1000000);
+  CHECK(micros64Coarse() == us);  // frozen between updates
+}
+
+void testStartOnHost() {
+  const Status range = startCoarseClock(10U);
+  CHECK(range.code == Err::INVALID_CONFIG);
+  CHECK_EQ(range.detail, 10);
+#if !defined(ARDUINO_ARCH_ESP32)
+  CHECK(startCoarseClock().code == Err::INVALID_CONFIG);  // no esp_timer
+  stopCoarseClock();
+#endif
+}
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+static_assert(IsClockSource<CoarseMillisClock>::value, "coarse ms ticks are a ClockSource");
+static_assert(IsClockSource<CoarseSecondsClock>::value, "coarse s ticks are a ClockSource");
+
+void testTimersFollowUpdates() {
+  CHECK(enableVirtualClock(5000000).ok());
+  updateCoarseClock();
+  CoarseElapsedMillis64 ms;
+  CoarseElapsedSeconds64 s(10);
+  CHECK_EQ(static_cast<int64_t>(ms), 0);
+  CHECK_EQ(static_cast<int64_t>(s), 10);
+
+  CHECK(advanceVirtualClock(2500000).ok());
+  CHECK_EQ(static_cast<int64_t>(ms), 0);  // stale until the next update
+  CHECK_EQ(millis64Coarse(), 5000);
+  updateCoarseClock();
+  CHECK_EQ(static_cast<int64_t>(ms), 2500);
+  CHECK_EQ(static_cast<int64_t>(s), 12);
+  CHECK_EQ(millis64Coarse(), 7500);
+  CHECK_EQ(seconds64Coarse(), 7);
+
+  ms = 0;
+  CHECK(advanceVirtualClock(999).ok());
+  updateCoarseClock();
+  CHECK_EQ(static_cast<int64_t>(ms), 0);
+
+  // Ticks of the cached counter: 7500.999 -> 7501.199 ms is one tick.
+  CHECK(advanceVirtualClock(200).ok());
+  updateCoarseClock();
+  CHECK_EQ(static_cast<int64_t>(ms), 1);
+  ms += 5;
+  CHECK_EQ(static_cast<int64_t>(ms), 6);
+  ms -= 6;
+  CHECK_EQ(static_cast<int64_t>(ms), 0);
+  CoarseElapsedSeconds64 copy = s;
+  CHECK_EQ(static_cast<int64_t>(copy), 12);
+  disableVirtualClock();
+  updateCoarseClock();
+}
+#endif
+
+/// A concurrent writer alternates two values whose halves differ; a torn
+/// read would mix them.
+template <typename Cell>
+void testCellNeverTears() {
+  static constexpr int64_t A = 0x0000000100000001LL;
+  static constexpr int64_t B = 0x7FFFFFFEFFFFFFFELL;
+  Cell cell;
+  cell.store(A);
+  std::atomic<bool> stop(false);
+  std::thread writer([&] {
+    bool flip = false;
+    while (!stop.load(std::memory_order_relaxed)) {
+      cell.store(flip ? A : B);
+      flip = !flip;
+    }
+  });
+  int torn = 0;
+  for (int i = 0; i < 200000; ++i) {
+    const int64_t v = cell.load();
+    if ((v != A) && (v != B)) {
+      ++torn;
+    }
+  }
+  stop.store(true);
+  writer.join();
+  CHECK_EQ(torn, 0);
+}
+
+}  // namespace
+
+int main() {
+  testUpdateAndRead();
+  testStartOnHost();
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+  testTimersFollowUpdates();
+#endif
+  testCellNeverTears<detail::AtomicInt64Cell>();
+  testCellNeverTears<detail::SeqlockInt64Cell>();
+  return test::testExitCode();
+}
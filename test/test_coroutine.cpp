@@ -0,0 +1,221 @@
+/**
+ * @file test_coroutine.cpp
+ * @brief Coroutine tasks resume exactly when their waits end, signals and
+ *        timeouts race correctly, and frames come from (and return to) the
+ *        fixed pool.
+ */
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "SystemChrono/Coroutine.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+Task sleeper(std::vector<int64_t>* wakes, Executor* executor, int count) {
+  for (int i = 0; i < count; ++i) {
+    co_await sleepFor(250_ms);
+    wakes->push_back(executor->nowUs());
+  }
+}
+
+Task absoluteSleeper(int64_t* woke, Executor* executor) {
+  co_await sleepUntil(steady_clock::from_micros64(5000));
+  *woke = executor->nowUs();
+}
+
+Task waiter(Signal* signal, std::chrono::microseconds timeout, int* result) {
+  *result = (co_await withTimeout(*signal, timeout)) ? 1 : 0;
+}
+
+Task foreverWaiter(Signal* signal, int* wakes) {
+  for (;;) {
+    co_await *signal;
+    ++*wakes;
+  }
+}
+
+Task yielder(int* count) {
+  for (;;) {
+    ++*count;
+    co_await sleepFor(0_us);
+  }
+}
+
+Task sleepOnce(std::chrono::microseconds duration, int* woke) {
+  co_await sleepFor(duration);
+  ++*woke;
+}
+
+void testLiterals() {
+  CHECK_EQ((250_ms).count(), 250);
+  CHECK_EQ(std::chrono::microseconds(250_ms).count(), 250000);
+  CHECK_EQ(std::chrono::microseconds(2_s).count(), 2000000);
+  CHECK_EQ((20_us).count(), 20);
+}
+
+void testConfig() {
+  Executor executor;
+  Deadline* slots[1];
+  CHECK(executor.begin(nullptr, 1U).code == Err::INVALID_CONFIG);
+  CHECK(executor.spawn(Task()).code == Err::OUT_OF_MEMORY);  // not begun, invalid task
+  CHECK(executor.begin(slots, 1U).ok());
+  int count = 0;
+  CHECK(executor.spawn(yielder(&count)).ok());
+  CHECK(executor.spawn(yielder(&count)).code == Err::OUT_OF_MEMORY);  // full
+  CHECK_EQ(executor.tasks(), 1U);
+  CHECK(executor.begin(slots, 1U).code == Err::RESOURCE_BUSY);
+}
+
+void testSleepForKeepsGrid() {
+  Deadline* slots[4];
+  Executor executor;
+  CHECK(executor.begin(slots, 4U).ok());
+  std::vector<int64_t> wakes;
+  int64_t absolute = -1;
+  CHECK(executor.spawn(sleeper(&wakes, &executor, 3)).ok());
+  CHECK(executor.spawn(absoluteSleeper(&absolute, &executor)).ok());
+  CHECK_EQ(executor.nextWakeUs(), 0);  // spawned tasks are due at once
+  CHECK_EQ(executor.runAt(1000), 2U);
+  CHECK_EQ(executor.nextWakeUs(), 5000);
+  CHECK_EQ(executor.runAt(4999), 0U);
+  CHECK_EQ(executor.runAt(5000), 1U);
+  CHECK_EQ(absolute, 5000);
+  CHECK_EQ(executor.tasks(), 1U);
+  CHECK_EQ(executor.nextWakeUs(), 251000);
+
+  // A late run resumes once; the next sleep counts from the run time.
+  CHECK_EQ(executor.runAt(260000), 1U);
+  CHECK_EQ(executor.nextWakeUs(), 510000);
+  CHECK_EQ(executor.runAt(510000), 1U);
+  CHECK_EQ(executor.runAt(760000), 1U);
+  CHECK_EQ(wakes.size(), 3U);
+  CHECK_EQ(wakes[2], 760000);
+  CHECK_EQ(executor.tasks(), 0U);
+  CHECK_EQ(executor.nextWakeUs(), DEADLINE_NONE);
+}
+
+void testSignalAndTimeout() {
+  Deadline* slots[4];
+  Executor executor;
+  CHECK(executor.begin(slots, 4U).ok());
+  Signal early;
+  Signal never;
+  Signal preset;
+  int earlyResult = -1;
+  int neverResult = -1;
+  int presetResult = -1;
+  preset.set();
+  CHECK(executor.spawn(waiter(&early, 10_ms, &earlyResult)).ok());
+  CHECK(executor.spawn(waiter(&never, 10_ms, &neverResult)).ok());
+  CHECK(executor.spawn(waiter(&preset, 10_ms, &presetResult)).ok());
+  CHECK_EQ(executor.runAt(0), 3U);
+  CHECK_EQ(presetResult, 1);  // already set: no suspension
+  CHECK(!preset.isSet());     // consumed
+  CHECK_EQ(executor.nextWakeUs(), 10000);
+
+  early.set();
+  CHECK_EQ(executor.nextWakeUs(), 0);  // due now, never the internal sentinel
+  CHECK_EQ(executor.runAt(3000), 1U);
+  CHECK_EQ(earlyResult, 1);
+  CHECK_EQ(neverResult, -1);
+  CHECK_EQ(executor.runAt(10000), 1U);
+  CHECK_EQ(neverResult, 0);
+  CHECK_EQ(executor.tasks(), 0U);
+
+  // Without a timeout the task is not a wake-up source.
+  Signal bell;
+  int rings = 0;
+  CHECK(executor.spawn(foreverWaiter(&bell, &rings)).ok());
+  CHECK_EQ(executor.runAt(20000), 1U);
+  CHECK_EQ(executor.nextWakeUs(), DEADLINE_NONE);
+  bell.set();
+  CHECK_EQ(executor.nextWakeUs(), 20000);  // already due
+  bell.set();  // not counted twice
+  CHECK_EQ(executor.runAt(20001), 1U);
+  CHECK_EQ(rings, 1);
+  CHECK_EQ(executor.nextWakeUs(), DEADLINE_NONE);
+}
+
+void testExtremeDurations() {
+  Deadline* slots[4];
+  Executor executor;
+  CHECK(executor.begin(slots, 4U).ok());
+  int hugeSleep = 0;
+  int hugeTimeout = -1;
+  int negative = 0;
+  Signal silent;
+  CHECK(executor.spawn(sleepOnce(std::chrono::microseconds::max(), &hugeSleep)).ok());
+  CHECK(executor.spawn(waiter(&silent, std::chrono::microseconds::max(), &hugeTimeout)).ok());
+  CHECK_EQ(executor.runAt(INT64_MAX / 2), 2U);
+  CHECK_EQ(executor.nextWakeUs(), DEADLINE_NONE);  // saturated, not wrapped into the past
+  CHECK_EQ(executor.runAt(INT64_MAX / 2 + 1), 0U);
+
+  // A negative sleep is a yield to a later run, even with other tasks queued.
+  const int64_t now = INT64_MAX / 2 + 2;
+  CHECK(executor.spawn(sleepOnce(std::chrono::microseconds(-5000), &negative)).ok());
+  CHECK_EQ(executor.runAt(now), 1U);
+  CHECK_EQ(executor.nextWakeUs(), now + 1);
+  CHECK_EQ(negative, 0);
+  CHECK_EQ(executor.runAt(now), 0U);
+  CHECK_EQ(executor.runAt(now + 1), 1U);
+  CHECK_EQ(negative, 1);
+  CHECK_EQ(hugeSleep, 0);
+  CHECK_EQ(hugeTimeout, -1);
+}
+
+void testYieldDoesNotLoop() {
+  Deadline* slots[2];
+  Executor executor;
+  CHECK(executor.begin(slots, 2U).ok());
+  int a = 0;
+  int b = 0;
+  CHECK(executor.spawn(yielder(&a)).ok());
+  CHECK(executor.spawn(yielder(&b)).ok());
+  for (int i = 0; i < 10; ++i) {
+    CHECK_EQ(executor.runAt(i), 2U);
+  }
+  CHECK_EQ(a, 10);
+  CHECK_EQ(b, 10);
+}
+
+void testPoolExhaustionAndRelease() {
+  const size_t before = coroutinePoolStats().used;
+  std::vector<Deadline*> slots(CORO_FRAMES + 4U);
+  {
+    Executor executor;
+    CHECK(executor.begin(slots.data(), slots.size()).ok());
+    Signal signal;
+    int wakes = 0;
+    size_t spawned = 0U;
+    Status last;
+    for (size_t i = 0; i < CORO_FRAMES + 4U; ++i) {
+      last = executor.spawn(foreverWaiter(&signal, &wakes));
+      spawned += last.ok() ? 1U : 0U;
+    }
+    CHECK(last.code == Err::OUT_OF_MEMORY);
+    CHECK_EQ(spawned, CORO_FRAMES - before);
+    CHECK_EQ(coroutinePoolStats().used, CORO_FRAMES);
+    CHECK(coroutinePoolStats().rejected >= 4U);
+    CHECK_EQ(executor.runAt(0), spawned);
+  }  // the executor destroys its suspended frames
+  CHECK_EQ(coroutinePoolStats().used, before);
+  CHECK(coroutinePoolStats().largestFrame <= CORO_FRAME_BYTES);
+}
+
+}  // namespace
+
+int main() {
+  testLiterals();
+  testConfig();
+  testSleepForKeepsGrid();
+  testSignalAndTimeout();
+  testExtremeDurations();
+  testYieldDoesNotLoop();
+  testPoolExhaustionAndRelease();
+  return test::testExitCode();
+}
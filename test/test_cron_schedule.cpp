@@ -0,0 +1,253 @@
+/**
+ * @file test_cron_schedule.cpp
+ * @brief Cron parsing, known next-fire times across month/leap-year edges,
+ *        agreement with a minute-by-minute gmtime() reference, and
+ *        CronTimer re-arming through a DeadlineRegistry.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <string>
+
+#include "SystemChrono/CronSchedule.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t MINUTE_US = 60000000LL;
+
+test::Lcg g_rng(0xC207U);
+
+int64_t utcUs(int year, int month, int day, int hour, int minute) {
+  struct tm t = {};
+  t.tm_year = year - 1900;
+  t.tm_mon = month - 1;
+  t.tm_mday = day;
+  t.tm_hour = hour;
+  t.tm_min = minute;
+  return static_cast<int64_t>(timegm(&t)) * 1000000LL;
+}
+
+int64_t nextOf(const char* expression, int64_t afterUs) {
+  CronSchedule schedule;
+  CHECK(schedule.parse(expression).ok());
+  return schedule.nextAfter(afterUs);
+}
+
+void testParse() {
+  CronSchedule schedule;
+  CHECK(!schedule.valid());
+  CHECK_EQ(schedule.nextAfter(0), DEADLINE_NONE);
+  CHECK(schedule.parse(nullptr).code == Err::INVALID_CONFIG);
+  CHECK_EQ(schedule.parse("60 * * * *").detail, 1);
+  CHECK_EQ(schedule.parse("* 24 * * *").detail, 2);
+  CHECK_EQ(schedule.parse("* * 0 * *").detail, 3);
+  CHECK_EQ(schedule.parse("* * * 13 *").detail, 4);
+  CHECK_EQ(schedule.parse("* * * *").detail, 5);
+  CHECK_EQ(schedule.parse("* * * * 8").detail, 5);
+  CHECK_EQ(schedule.parse("* * * * * *").detail, 6);
+  CHECK(schedule.parse("*/0 * * * *").code == Err::INVALID_CONFIG);
+  CHECK(schedule.parse("5- * * * *").code == Err::INVALID_CONFIG);
+  CHECK(schedule.parse("9-5 * * * *").code == Err::INVALID_CONFIG);
+  CHECK(schedule.parse("1,,2 * * * *").code == Err::INVALID_CONFIG);
+  CHECK(schedule.parse("@daily now").code == Err::INVALID_CONFIG);
+  CHECK(schedule.parse("@often").code == Err::INVALID_CONFIG);
+  CHECK(!schedule.valid());  // failures keep the previous (empty) schedule
+
+  const Status never = schedule.parse("0 0 31 2,4 *");
+  CHECK(never.code == Err::INVALID_CONFIG);
+  CHECK_EQ(never.detail, 3);
+  CHECK(schedule.parse("0 0 30 2,4 *").ok());  // April has a 30th
+  CHECK(schedule.parse(" 0,30  */6\t1-7 1-12/3 1-5 ").ok());
+  CHECK(schedule.valid());
+}
+
+void testKnownTimes() {
+  const int64_t newYear = utcUs(2024, 1, 1, 0, 0);
+  CHECK_EQ(nextOf("7-59/15 * * * *", newYear), utcUs(2024, 1, 1, 0, 7));
+  CHECK_EQ(nextOf("7/15 * * * *", utcUs(2024, 1, 1, 0, 7)), utcUs(2024, 1, 1, 0, 22));
+  CHECK_EQ(nextOf("7/15 * * * *", utcUs(2024, 1, 1, 0, 52)), utcUs(2024, 1, 1, 1, 7));
+  // Strictly after: a time inside the firing minute moves on.
+  CHECK_EQ(nextOf("30 2 * * *", utcUs(2024, 3, 10, 2, 30) + 1), utcUs(2024, 3, 11, 2, 30));
+  CHECK_EQ(nextOf("30 2 * * *", utcUs(2024, 3, 10, 2, 30) - 1), utcUs(2024, 3, 10, 2, 30));
+  // Year, month and leap-day rollover.
+  CHECK_EQ(nextOf("@yearly", utcUs(2024, 6, 1, 0, 0)), utcUs(2025, 1, 1, 0, 0));
+  CHECK_EQ(nextOf("0 0 31 * *", utcUs(2024, 4, 1, 0, 0)), utcUs(2024, 5, 31, 0, 0));
+  CHECK_EQ(nextOf("0 0 29 2 *", utcUs(2025, 1, 1, 0, 0)), utcUs(2028, 2, 29, 0, 0));
+  CHECK_EQ(nextOf("0 0 29 2 *", utcUs(2096, 3, 1, 0, 0)), utcUs(2104, 2, 29, 0, 0));
+  CHECK_EQ(nextOf("59 23 31 12 *", utcUs(2024, 12, 31, 23, 59)), utcUs(2025, 12, 31, 23, 59));
+  // Weekdays: 2024-09-01 is a Sunday; 0 and 7 are both Sunday.
+  CHECK_EQ(nextOf("0 0 * * 7", utcUs(2024, 9, 1, 0, 0)), utcUs(2024, 9, 8, 0, 0));
+  CHECK_EQ(nextOf("0 0 * * 0", utcUs(2024, 9, 1, 0, 0)), utcUs(2024, 9, 8, 0, 0));
+  CHECK_EQ(nextOf("@weekly", utcUs(2024, 9, 2, 0, 0)), utcUs(2024, 9, 8, 0, 0));
+  // Day-of-month and weekday both restricted: either matches (13th or Friday).
+  CHECK_EQ(nextOf("0 12 13 * 5", utcUs(2024, 9, 1, 0, 0)), utcUs(2024, 9, 6, 12, 0));
+  CHECK_EQ(nextOf("0 12 13 * 5", utcUs(2024, 9, 6, 12, 0)), utcUs(2024, 9, 13, 12, 0));
+  CHECK_EQ(nextOf("0 12 13 * 5", utcUs(2024, 9, 13, 12, 0)), utcUs(2024, 9, 20, 12, 0));
+  // A '*'-led field is AND-ed instead: a 13th that is a Sunday.
+  CHECK_EQ(nextOf("0 12 13 * */7", utcUs(2024, 9, 1, 0, 0)), utcUs(2024, 10, 13, 12, 0));
+  CHECK_EQ(nextOf("0 12 * * *", utcUs(2024, 9, 1, 0, 0)), utcUs(2024, 9, 1, 12, 0));
+  // Feb 29 on a Sunday: 2004, 2032, then 2060.
+  CHECK_EQ(nextOf("0 0 29 2 */1", utcUs(2017, 1, 1, 0, 0)), utcUs(2020, 2, 29, 0, 0));
+  CHECK_EQ(nextOf("0 0 29 2 */7", utcUs(2032, 3, 1, 0, 0)), utcUs(2060, 2, 29, 0, 0));
+  // Before 1970.
+  CHECK_EQ(nextOf("@daily", utcUs(1969, 12, 31, 12, 0)), utcUs(1970, 1, 1, 0, 0));
+}
+
+/// Random field: '*', a value, a range, a stepped range, or a two-item list.
+std::string randomField(uint32_t lo, uint32_t hi) {
+  char text[32];
+  const uint32_t a = lo + g_rng.next(hi - lo + 1U);
+  const uint32_t b = a + g_rng.next(hi - a + 1U);
+  switch (g_rng.next(6U)) {
+    case 0:
+      return "*";
+    case 1:
+      snprintf(text, sizeof(text), "%u", a);
+      break;
+    case 2:
+      snprintf(text, sizeof(text), "%u-%u", a, b);
+      break;
+    case 3:
+      snprintf(text, sizeof(text), "%u-%u/%u", a, b, 1U + g_rng.next(7U));
+      break;
+    case 4:
+      snprintf(text, sizeof(text), "*/%u", 1U + g_rng.next(7U));
+      break;
+    default:
+      snprintf(text, sizeof(text), "%u,%u", a, b);
+      break;
+  }
+  return text;
+}
+
+/// Whether a field text selects a value (same grammar, no validation).
+bool fieldMatches(const std::string& field, uint32_t lo, uint32_t hi, uint32_t value) {
+  size_t start = 0U;
+  while (start <= field.size()) {
+    const size_t comma = field.find(',', start);
+    const std::string item = field.substr(start, comma - start);
+    uint32_t first = lo;
+    uint32_t last = hi;
+    uint32_t step = 1U;
+    const size_t slash = item.find('/');
+    const std::string range = item.substr(0, slash);
+    if (slash != std::string::npos) {
+      step = static_cast<uint32_t>(std::stoul(item.substr(slash + 1U)));
+    }
+    if (range != "*") {
+      const size_t dash = range.find('-');
+      first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+      if (dash != std::string::npos) {
+        last = static_cast<uint32_t>(std::stoul(range.substr(dash + 1U)));
+      } else {
+        last = first;
+      }
+    }
+    if ((value >= first) && (value <= last) && ((value - first) % step == 0U)) {
+      return true;
+    }
+    if (comma == std::string::npos) {
+      break;
+    }
+    start = comma + 1U;
+  }
+  return false;
+}
+
+void testMatchesReference() {
+  int compared = 0;
+  for (int round = 0; round < 200; ++round) {
+    const std::string f[5] = {randomField(0U, 59U), randomField(0U, 23U), randomField(1U, 31U),
+                              randomField(1U, 12U), randomField(0U, 6U)};
+    const std::string expression = f[0] + " " + f[1] + " " + f[2] + " " + f[3] + " " + f[4];
+    CronSchedule schedule;
+    if (!schedule.parse(expression.c_str()).ok()) {
+      continue;  // never fires
+    }
+    const int64_t after = utcUs(2023, 1, 1, 0, 0) +
+                          static_cast<int64_t>(g_rng.next(3U * 365U * 1440U)) * MINUTE_US +
+                          static_cast<int64_t>(g_rng.next(60000000U));
+    const int64_t got = schedule.nextAfter(after);
+
+    // Reference: walk minutes with gmtime_r() for up to two years.
+    bool selected[5][60] = {};
+    static const uint32_t RANGES[5][2] = {{0U, 59U}, {0U, 23U}, {1U, 31U}, {1U, 12U}, {0U, 6U}};
+    for (int field = 0; field < 5; ++field) {
+      for (uint32_t v = RANGES[field][0]; v <= RANGES[field][1]; ++v) {
+        selected[field][v] = fieldMatches(f[field], RANGES[field][0], RANGES[field][1], v);
+      }
+    }
+    int64_t expected = DEADLINE_NONE;
+    int64_t minute = (after / MINUTE_US + 1) * MINUTE_US;
+    for (int i = 0; i < 2 * 366 * 1440; ++i, minute += MINUTE_US) {
+      const time_t seconds = static_cast<time_t>(minute / 1000000LL);
+      struct tm t;
+      gmtime_r(&seconds, &t);
+      const bool day = selected[2][t.tm_mday];
+      const bool weekday = selected[4][t.tm_wday];
+      const bool dayOk =
+          ((f[2][0] == '*') || (f[4][0] == '*')) ? (day && weekday) : (day || weekday);
+      if (selected[0][t.tm_min] && selected[1][t.tm_hour] && selected[3][t.tm_mon + 1] &&
+          dayOk) {
+        expected = minute;
+        break;
+      }
+    }
+    if (expected != DEADLINE_NONE) {
+      if (got != expected) {
+        printf("  mismatch for '%s'\n", expression.c_str());
+      }
+      CHECK_EQ(got, expected);
+      ++compared;
+    } else {
+      CHECK(got > minute);  // rarer than the reference window (Feb 29)
+    }
+  }
+  CHECK(compared > 150);
+}
+
+void testCronTimer() {
+  Deadline* slots[2];
+  DeadlineRegistry registry;
+  CHECK(registry.begin(slots, 2U).ok());
+  CronSchedule quarter;
+  CHECK(quarter.parse("7/15 * * * *").ok());
+
+  const int64_t boot = utcUs(2024, 1, 1, 0, 0);  // wall time at micros64() == 0
+  CronTimer timer(&registry);
+  CHECK(timer.startAt(0, CronSchedule(), boot).code == Err::INVALID_CONFIG);
+  CHECK(timer.startAt(0, quarter, boot).ok());
+  CHECK_EQ(timer.dueUs(), 7 * MINUTE_US);
+  CHECK_EQ(registry.nextDueUs(), 7 * MINUTE_US);
+  CHECK(!timer.pollAt(7 * MINUTE_US - 1));
+  CHECK(timer.pollAt(7 * MINUTE_US));
+  CHECK_EQ(timer.dueUs(), 22 * MINUTE_US);
+
+  // A late poll fires once and skips the missed firings.
+  CHECK(timer.pollAt(60 * MINUTE_US));
+  CHECK(!timer.pollAt(60 * MINUTE_US));
+  CHECK_EQ(timer.dueUs(), 67 * MINUTE_US);
+
+  // Clock sync moves wall time 10 minutes ahead (01:11): next is 01:22.
+  CHECK(timer.rebaseAt(61 * MINUTE_US, boot + 10 * MINUTE_US).ok());
+  CHECK_EQ(timer.dueUs(), 72 * MINUTE_US);
+  CHECK_EQ(registry.size(), 1U);
+  timer.stop();
+  CHECK(!timer.running());
+  CHECK_EQ(registry.size(), 0U);
+}
+
+}  // namespace
+
+int main() {
+  testParse();
+  testKnownTimes();
+  testMatchesReference();
+  testCronTimer();
+  return test::testExitCode();
+}
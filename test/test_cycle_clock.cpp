@@ -0,0 +1,87 @@
+/**
+ * @file test_cycle_clock.cpp
+ * @brief Cycle counter extension, calibration and nanos64() tracking.
+ */
+
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/SystemChrono.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+void testUncalibratedFallback() {
+  CHECK_EQ(cycleClockHz(), 0);
+  CHECK_EQ(cyclesToNanos(1000U), 0);
+  CycleClockDrift drift;
+  CHECK(checkCycleClockDrift(CYCLE_CLOCK_DEFAULT_WINDOW_US, 100U, drift).code ==
+        Err::NOT_INITIALIZED);
+
+  const int64_t us = micros64();
+  const int64_t ns = nanos64();
+  CHECK(ns >= us * 1000LL);
+  CHECK(ns - us * 1000LL < 1000000LL);
+}
+
+void testCyclesMonotonic() {
+  uint64_t prev = cycles64();
+  for (int i = 0; i < 100000; ++i) {
+    const uint64_t now = cycles64();
+    CHECK(now >= prev);
+    prev = now;
+  }
+}
+
+void testInvalidWindow() {
+  CHECK(calibrateCycleClock(999U).code == Err::INVALID_CONFIG);
+  CHECK(calibrateCycleClock(1000001U).code == Err::INVALID_CONFIG);
+}
+
+void testCalibration() {
+  CHECK(calibrateCycleClock().ok());
+  const uint64_t hz = cycleClockHz();
+  CHECK(hz > 0U);
+  if (!hasCycleCounter()) {
+    CHECK_EQ(hz, 1000000);
+  }
+
+  // One second worth of cycles converts to one second, within rounding.
+  CHECK_NEAR(cyclesToNanos(hz), 1000000000.0, 2.0);
+  CHECK_NEAR(cyclesToNanos(hz * 3600U), 3600000000000.0, 3600.0 * 2.0);
+
+  // The drift check re-measures the same frequency (generous bound for CI noise).
+  CycleClockDrift drift;
+  CHECK(checkCycleClockDrift(CYCLE_CLOCK_DEFAULT_WINDOW_US, 20000U, drift).ok());
+  CHECK_EQ(drift.calibratedHz, hz);
+  CHECK(!drift.drifted);
+}
+
+void testNanosTracksMicros() {
+  // nanos64() stays anchored to the micros64() time base.
+  for (int i = 0; i < 5; ++i) {
+    const int64_t beforeUs = micros64();
+    const int64_t ns = nanos64();
+    const int64_t afterUs = micros64();
+    CHECK(ns >= (beforeUs - 50) * 1000LL);
+    CHECK(ns <= (afterUs + 50) * 1000LL);
+  }
+
+  int64_t prev = nanos64();
+  for (int i = 0; i < 100000; ++i) {
+    const int64_t now = nanos64();
+    CHECK(now >= prev);
+    prev = now;
+  }
+}
+
+}  // namespace
+
+int main() {
+  testUncalibratedFallback();
+  testCyclesMonotonic();
+  testInvalidWindow();
+  testCalibration();
+  testNanosTracksMicros();
+  return test::testExitCode();
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_deadline_registry.cpp
+ * @brief Deadline / Interval semantics and the registry minimum against a
+ *        brute-force scan under random arm, re-arm, cancel and destroy.
+ */
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "SystemChrono/DeadlineRegistry.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0xD1A7U);
+
+void testConfig() {
+  DeadlineRegistry registry;
+  Deadline* slots[2];
+  CHECK(registry.begin(nullptr, 2U).code == Err::INVALID_CONFIG);
+  CHECK(registry.begin(slots, 0U).code == Err::INVALID_CONFIG);
+  CHECK_EQ(registry.nextWakeUs(), DEADLINE_NONE);
+  CHECK_EQ(registry.idleForAt(0), DEADLINE_NONE);
+
+  Deadline early(&registry);
+  CHECK(early.armAt(10).code == Err::OUT_OF_MEMORY);  // no storage yet
+  CHECK(!early.armed());
+
+  CHECK(registry.begin(slots, 2U).ok());
+  Deadline a(&registry);
+  Deadline b(&registry);
+  CHECK(a.armAt(100).ok());
+  CHECK(b.armAt(50).ok());
+  CHECK(early.armAt(10).code == Err::OUT_OF_MEMORY);  // full
+  CHECK(registry.begin(slots, 2U).code == Err::RESOURCE_BUSY);
+  CHECK_EQ(registry.size(), 2U);
+  CHECK_EQ(registry.nextWakeUs(), 50);
+}
+
+void testDeadline() {
+  Deadline* slots[4];
+  DeadlineRegistry registry;
+  CHECK(registry.begin(slots, 4U).ok());
+  {
+    Deadline timeout(&registry);
+    CHECK(!timeout.expiredAt(0));
+    CHECK(timeout.armAt(1000).ok());
+    CHECK_EQ(registry.nextDueUs(), 1000);
+    CHECK_EQ(timeout.remainingAt(400), 600);
+    CHECK(!timeout.pollAt(999));
+    CHECK(timeout.expiredAt(1000));
+    CHECK(timeout.pollAt(1000));
+    CHECK(!timeout.pollAt(1001));  // consumed
+    CHECK_EQ(registry.size(), 0U);
+
+    CHECK(timeout.armAt(2000).ok());
+    CHECK(timeout.armAt(1500).ok());  // re-arm in place
+    CHECK_EQ(registry.size(), 1U);
+    CHECK_EQ(registry.nextDueUs(), 1500);
+  }
+  // Destruction unregisters.
+  CHECK_EQ(registry.size(), 0U);
+
+  Deadline standalone;  // no registry
+  CHECK(standalone.armAt(5).ok());
+  CHECK(standalone.pollAt(5));
+
+  // attach() moves to a registry, disarming first.
+  CHECK(standalone.armAt(7).ok());
+  standalone.attach(&registry);
+  CHECK(!standalone.armed());
+  CHECK(standalone.armAt(7).ok());
+  CHECK_EQ(registry.nextDueUs(), 7);
+  standalone.attach(nullptr);
+  CHECK_EQ(registry.size(), 0U);
+}
+
+void testInterval() {
+  Deadline* slots[2];
+  DeadlineRegistry registry;
+  CHECK(registry.begin(slots, 2U).ok());
+  Interval tick(&registry);
+  CHECK(tick.startAt(0, 0).code == Err::INVALID_CONFIG);
+  CHECK(tick.startAt(0, 100).ok());
+  CHECK_EQ(registry.nextDueUs(), 100);
+  CHECK(!tick.pollAt(99));
+  CHECK(tick.pollAt(130));  // late poll keeps the grid
+  CHECK_EQ(tick.dueUs(), 200);
+  CHECK(tick.pollAt(200));
+  CHECK(tick.pollAt(655));  // 300, 400, 500, 600 passed: three skipped
+  CHECK_EQ(tick.dueUs(), 700);
+  CHECK_EQ(tick.missed(), 3U);
+  CHECK_EQ(registry.nextDueUs(), 700);
+  tick.stop();
+  CHECK(!tick.running());
+  CHECK_EQ(registry.size(), 0U);
+}
+
+void testSlackGroupsWakeups() {
+  Deadline* slots[8];
+  DeadlineRegistry registry;
+  DeadlineRegistryConfig cfg;
+  cfg.slackUs = 500U;
+  CHECK(registry.begin(slots, 8U, cfg).ok());
+  Deadline a(&registry);
+  Deadline b(&registry);
+  Deadline c(&registry);
+  CHECK(a.armAt(1000).ok());
+  CHECK(b.armAt(1300).ok());
+  CHECK(c.armAt(1800).ok());
+  CHECK_EQ(registry.nextWakeUs(), 1500);
+  CHECK_EQ(registry.idleForAt(900), 600);
+  // One wake-up at 1500 handles a and b; c needs a second one.
+  int64_t now = registry.nextWakeUs();
+  CHECK(a.pollAt(now));
+  CHECK(b.pollAt(now));
+  CHECK(!c.pollAt(now));
+  CHECK_EQ(registry.nextWakeUs(), 2300);
+  CHECK_EQ(registry.idleForAt(2400), 0);
+}
+
+/// Random operations on 300 timers over a 64-slot heap; the minimum always
+/// matches a scan and every armed timer is registered exactly once.
+void testMatchesBruteForce() {
+  static constexpr int TIMERS = 300;
+  Deadline* slots[64];
+  DeadlineRegistry registry;
+  CHECK(registry.begin(slots, 64U).ok());
+  std::unique_ptr<Deadline> timers[TIMERS];
+  for (int i = 0; i < TIMERS; ++i) {
+    timers[i].reset(new Deadline(&registry));
+  }
+  int64_t now = 0;
+  for (int step = 0; step < 50000; ++step) {
+    const uint32_t index = g_rng.next(TIMERS);
+    Deadline& d = *timers[index];
+    const uint32_t op = g_rng.next(10U);
+    if (op < 5U) {
+      const Status st = d.armAt(now + static_cast<int64_t>(g_rng.next(100000U)));
+      CHECK(st.ok() || (st.code == Err::OUT_OF_MEMORY && registry.size() == 64U));
+    } else if (op < 7U) {
+      d.cancel();
+    } else if (op < 9U) {
+      now += g_rng.next(2000U);
+      (void)d.pollAt(now);
+    } else {
+      timers[index].reset(new Deadline(&registry));  // destroy and replace
+    }
+    int64_t expected = DEADLINE_NONE;
+    size_t armed = 0U;
+    for (int i = 0; i < TIMERS; ++i) {
+      if (timers[i]->armed()) {
+        ++armed;
+        expected = timers[i]->dueUs() < expected ? timers[i]->dueUs() : expected;
+      }
+    }
+    CHECK_EQ(registry.size(), armed);
+    CHECK_EQ(registry.nextDueUs(), expected);
+  }
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testDeadline();
+  testInterval();
+  testSlackGroupsWakeups();
+  testMatchesBruteForce();
+  return test::testExitCode();
+}
@@ -0,0 +1,208 @@
+/**
+ * @file test_disciplined_clock.cpp
+ * @brief PI/FLL discipline against a synthetic drifting oscillator.
+ *
+ * The local clock is simulated: it runs basePpm fast or slow plus a slow
+ * sinusoidal "temperature" wander. References are true time plus bounded
+ * noise.
+ */
+
+#include <math.h>
+#include <stdint.h>
+
+#include "SystemChrono/DisciplinedClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t STEP_US = 10000;
+static constexpr int64_t SAMPLE_EVERY_US = 1000000;
+static constexpr int64_t REFERENCE_EPOCH_US = 1700000000000000LL;
+
+struct Oscillator {
+  double basePpm = 0.0;
+  double wanderPpm = 0.0;
+  double wanderPeriodS = 600.0;
+  double trueUs = 0.0;
+  double localUs = 5000000.0;
+
+  double ppmNow() const {
+    return basePpm + wanderPpm * sin(2.0 * 3.14159265358979 * trueUs / 1e6 / wanderPeriodS);
+  }
+
+  void advance(int64_t dtUs) {
+    localUs += static_cast<double>(dtUs) * (1.0 + ppmNow() * 1e-6);
+    trueUs += static_cast<double>(dtUs);
+  }
+};
+
+Oscillator g_osc;
+
+int64_t localClock() {
+  return static_cast<int64_t>(g_osc.localUs);
+}
+
+int64_t referenceNow() {
+  return REFERENCE_EPOCH_US + static_cast<int64_t>(g_osc.trueUs);
+}
+
+test::Lcg g_rng(0xD15CU);
+
+DisciplinedClockConfig simConfig() {
+  DisciplinedClockConfig cfg;
+  cfg.clock = &localClock;
+  cfg.holdoverAfterUs = 3000000U;
+  return cfg;
+}
+
+struct RunResult {
+  bool monotonic = true;
+  int64_t worstErrorUs = 0;  // after settleUs
+};
+
+/// Run the simulation; noiseAmplitude == UINT32_MAX withholds references.
+RunResult simulate(DisciplinedClock& clock, int64_t durationUs, int64_t settleUs,
+                   uint32_t noiseAmplitude, int64_t referenceShiftUs = 0) {
+  RunResult r;
+  int64_t last = clock.correctedMicros64();
+  int64_t sinceSample = 0;
+  for (int64_t t = 0; t < durationUs; t += STEP_US) {
+    g_osc.advance(STEP_US);
+    sinceSample += STEP_US;
+    if ((sinceSample >= SAMPLE_EVERY_US) && (noiseAmplitude != UINT32_MAX)) {
+      sinceSample = 0;
+      const int64_t ref = referenceNow() + referenceShiftUs + g_rng.noise(noiseAmplitude);
+      CHECK(clock.addSample(localClock(), ref).ok());
+    }
+    const int64_t now = clock.correctedMicros64();
+    if (now < last) {
+      r.monotonic = false;
+    }
+    last = now;
+    if (t >= settleUs) {
+      int64_t err = now - (referenceNow() + referenceShiftUs);
+      err = err < 0 ? -err : err;
+      r.worstErrorUs = err > r.worstErrorUs ? err : r.worstErrorUs;
+    }
+  }
+  return r;
+}
+
+void testConfigAndState() {
+  DisciplinedClock clock;
+  CHECK(clock.addSample(0, 0).code == Err::NOT_INITIALIZED);
+  CHECK(clock.state() == DisciplineState::UNSYNCHRONIZED);
+
+  DisciplinedClockConfig bad = simConfig();
+  bad.phaseShift = 17U;
+  CHECK(clock.begin(bad).code == Err::INVALID_CONFIG);
+  bad = simConfig();
+  bad.acquireSamples = 0U;
+  CHECK(clock.begin(bad).code == Err::INVALID_CONFIG);
+  bad = simConfig();
+  bad.maxSlewPpm = 2000U;
+  CHECK(clock.begin(bad).code == Err::INVALID_CONFIG);
+  bad = simConfig();
+  bad.holdoverAfterUs = 0U;
+  CHECK(clock.begin(bad).code == Err::INVALID_CONFIG);
+
+  g_osc = Oscillator();
+  CHECK(clock.begin(simConfig()).ok());
+  CHECK(clock.state() == DisciplineState::UNSYNCHRONIZED);
+  CHECK_EQ(clock.correctedMicros64(), localClock());  // follows the local clock
+  CHECK(clock.addSample(localClock() + 1, 0).code == Err::INVALID_CONFIG);  // future
+
+  // First sample aligns the phase forward to the reference epoch.
+  CHECK(clock.addSample(localClock(), referenceNow()).ok());
+  CHECK(clock.state() == DisciplineState::ACQUIRING);
+  CHECK_EQ(clock.correctedMicros64(), referenceNow());
+  CHECK(clock.addSample(localClock(), referenceNow()).code == Err::INVALID_CONFIG);  // order
+  CHECK_EQ(clock.telemetry().samples, 1U);
+}
+
+void testTracksDriftingOscillator(double basePpm) {
+  g_osc = Oscillator();
+  g_osc.basePpm = basePpm;
+  g_osc.wanderPpm = 5.0;
+  DisciplinedClock clock;
+  CHECK(clock.begin(simConfig()).ok());
+
+  const RunResult r = simulate(clock, 1800000000, 120000000, 20U);
+  CHECK(r.monotonic);
+  CHECK(r.worstErrorUs < 100);
+  const DisciplineTelemetry t = clock.telemetry();
+  CHECK(t.state == DisciplineState::LOCKED);
+  // Local runs p ppm fast, so the correction converges to about -p.
+  CHECK_NEAR(t.frequencyPpb, static_cast<int32_t>(-g_osc.ppmNow() * 1000.0), 2000);
+  CHECK(t.lastOffsetUs < 100 && t.lastOffsetUs > -100);
+}
+
+void testHoldoverAndRelock() {
+  g_osc = Oscillator();
+  g_osc.basePpm = 37.0;
+  DisciplinedClock clock;
+  CHECK(clock.begin(simConfig()).ok());
+  CHECK(simulate(clock, 120000000, 60000000, 5U).monotonic);
+  CHECK(clock.state() == DisciplineState::LOCKED);
+
+  // References stop for a minute: free-run on the learned frequency.
+  const RunResult holdover = simulate(clock, 60000000, 0, UINT32_MAX);
+  CHECK(holdover.monotonic);
+  CHECK(clock.state() == DisciplineState::HOLDOVER);
+  CHECK(holdover.worstErrorUs < 200);  // < 3.3 ppm residual over 60 s
+  CHECK_NEAR(clock.telemetry().rateAdjustPpb, clock.telemetry().frequencyPpb, 0);
+
+  const RunResult relock = simulate(clock, 60000000, 30000000, 5U);
+  CHECK(relock.monotonic);
+  CHECK(clock.state() == DisciplineState::LOCKED);
+  CHECK(relock.worstErrorUs < 50);
+}
+
+void testBackwardCorrectionSlews() {
+  g_osc = Oscillator();
+  g_osc.basePpm = -50.0;
+  DisciplinedClockConfig cfg = simConfig();
+  DisciplinedClock clock;
+  CHECK(clock.begin(cfg).ok());
+  CHECK(simulate(clock, 60000000, 30000000, 0U).worstErrorUs < 10);
+
+  // The reference jumps 5 ms into the past: slew at most maxSlewPpm, never step.
+  int64_t last = clock.correctedMicros64();
+  int64_t sinceSample = 0;
+  bool monotonic = true;
+  bool slewLimited = true;
+  for (int64_t t = 0; t < 120000000; t += STEP_US) {
+    const int64_t localBefore = localClock();
+    g_osc.advance(STEP_US);
+    sinceSample += STEP_US;
+    if (sinceSample >= SAMPLE_EVERY_US) {
+      sinceSample = 0;
+      CHECK(clock.addSample(localClock(), referenceNow() - 5000).ok());
+    }
+    const int64_t now = clock.correctedMicros64();
+    const int64_t localStep = localClock() - localBefore;
+    const int64_t maxPpm = cfg.maxFrequencyPpm + cfg.maxSlewPpm;
+    const int64_t minStep = localStep - (localStep * maxPpm) / 1000000 - 1;
+    monotonic = monotonic && (now >= last);
+    slewLimited = slewLimited && (now - last >= minStep);
+    last = now;
+  }
+  CHECK(monotonic);
+  CHECK(slewLimited);
+  CHECK_NEAR(clock.correctedMicros64(), referenceNow() - 5000, 20);
+  // Anti-windup: the phase step did not leak into the frequency estimate.
+  CHECK_NEAR(clock.telemetry().frequencyPpb, 50000, 1000);
+}
+
+}  // namespace
+
+int main() {
+  testConfigAndState();
+  testTracksDriftingOscillator(50.0);
+  testTracksDriftingOscillator(-50.0);
+  testHoldoverAndRelock();
+  testBackwardCorrectionSlews();
+  return test::testExitCode();
+}
@@ -0,0 +1,193 @@
+/**
+ * @file test_event_merger.cpp
+ * @brief K-way merge ordering, tie-breaking and the lateness bound.
+ */
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "SystemChrono/EventMerger.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0x3E76U);
+
+/// Queue that producers append to and the merger drains.
+struct QueueSource : EventSource {
+  std::vector<TimedEvent> events;
+  size_t next_ = 0U;
+
+  void push(int64_t micros, uint32_t payload) {
+    TimedEvent ev;
+    ev.micros = micros;
+    ev.payload = payload;
+    events.push_back(ev);
+  }
+
+  bool next(TimedEvent& out) override {
+    if (next_ == events.size()) {
+      return false;
+    }
+    out = events[next_++];
+    return true;
+  }
+};
+
+void testConfig() {
+  EventMerger merger;
+  TimedEvent ev;
+  CHECK(!merger.pop(0, ev));
+  QueueSource a;
+  EventSource* sources[EVENT_MERGE_MAX_SOURCES + 1U] = {};
+  CHECK(merger.begin(nullptr, 1U).code == Err::INVALID_CONFIG);
+  CHECK(merger.begin(sources, 0U).code == Err::INVALID_CONFIG);
+  CHECK(merger.begin(sources, 1U).code == Err::INVALID_CONFIG);  // null source
+  for (size_t i = 0; i <= EVENT_MERGE_MAX_SOURCES; ++i) {
+    sources[i] = &a;
+  }
+  CHECK(merger.begin(sources, EVENT_MERGE_MAX_SOURCES + 1U).code == Err::INVALID_CONFIG);
+  CHECK(merger.begin(sources, EVENT_MERGE_MAX_SOURCES).ok());
+  CHECK(!merger.pop(INT64_MAX, ev));  // all empty
+}
+
+void testMergesSortedSources() {
+  static constexpr size_t K = 5U;  // not a power of two: padding leaves
+  QueueSource queues[K];
+  EventSource* sources[K];
+  for (size_t s = 0; s < K; ++s) {
+    int64_t t = 0;
+    const size_t n = 20U + g_rng.next(200U);
+    for (size_t i = 0; i < n; ++i) {
+      t += g_rng.next(50U);  // duplicates within and across sources
+      queues[s].push(t, static_cast<uint32_t>(i));
+    }
+    sources[s] = &queues[s];
+  }
+  queues[2].events.clear();  // one source never produces
+  size_t expected = 0U;
+  for (size_t s = 0; s < K; ++s) {
+    expected += queues[s].events.size();
+  }
+
+  EventMerger merger;
+  CHECK(merger.begin(sources, K).ok());
+  std::vector<TimedEvent> out(expected + 8U);
+  const size_t n = merger.drain(INT64_MAX, out.data(), out.size());
+  CHECK_EQ(n, expected);
+  CHECK_EQ(merger.merged(), expected);
+  CHECK_EQ(merger.late(), 0U);
+  std::vector<uint32_t> perSource(K, 0U);
+  for (size_t i = 0; i < n; ++i) {
+    if (i != 0U) {
+      const bool ordered = (out[i - 1U].micros < out[i].micros) ||
+                           ((out[i - 1U].micros == out[i].micros) &&
+                            (out[i - 1U].source <= out[i].source));
+      CHECK(ordered);
+    }
+    // Each source's events come out in their own order.
+    CHECK_EQ(out[i].payload, perSource[out[i].source]++);
+  }
+}
+
+void testHoldsForLateness() {
+  QueueSource a;
+  QueueSource b;
+  EventSource* sources[] = {&a, &b};
+  EventMergerConfig cfg;
+  cfg.latenessUs = 100U;
+  EventMerger merger;
+  CHECK(merger.begin(sources, 2U, cfg).ok());
+  a.push(1000, 1U);
+  a.push(1200, 2U);
+
+  TimedEvent ev;
+  CHECK(!merger.pop(1050, ev));  // b is empty and 1000 is not yet 100 us old
+  CHECK(merger.pop(1100, ev));
+  CHECK_EQ(ev.micros, 1000);
+  CHECK(!merger.pop(1250, ev));
+
+  b.push(1150, 7U);  // b publishes late but within the bound
+  CHECK(merger.pop(1250, ev));
+  CHECK_EQ(ev.micros, 1150);
+  CHECK_EQ(ev.source, 1U);
+  CHECK(merger.pop(1300, ev));
+  CHECK_EQ(ev.micros, 1200);
+
+  // Both sources have heads: the winner is emitted without waiting.
+  a.push(2000, 3U);
+  b.push(2100, 8U);
+  CHECK(merger.pop(0, ev));
+  CHECK_EQ(ev.micros, 2000);
+
+  // Older than what was already emitted: still delivered, counted late.
+  a.push(1900, 4U);
+  CHECK(merger.pop(0, ev));
+  CHECK_EQ(ev.micros, 1900);
+  CHECK_EQ(merger.late(), 1U);
+}
+
+/// 16 producers publish with a random delay; the consumer merges as it goes.
+uint32_t simulate(uint32_t maxDelayUs, uint32_t latenessUs, bool& ordered, size_t& emitted) {
+  static constexpr size_t K = 16U;
+  QueueSource queues[K];
+  EventSource* sources[K];
+  int64_t nextEventUs[K];
+  int64_t publishUs[K];
+  for (size_t s = 0; s < K; ++s) {
+    sources[s] = &queues[s];
+    nextEventUs[s] = g_rng.next(1000U);
+    publishUs[s] = nextEventUs[s] + g_rng.next(maxDelayUs + 1U);
+  }
+  EventMergerConfig cfg;
+  cfg.latenessUs = latenessUs;
+  EventMerger merger;
+  CHECK(merger.begin(sources, K, cfg).ok());
+
+  ordered = true;
+  emitted = 0U;
+  int64_t last = INT64_MIN;
+  TimedEvent ev;
+  for (int64_t now = 0; now < 200000; now += 100) {
+    for (size_t s = 0; s < K; ++s) {
+      // Publish in event order, each no later than its delay allows.
+      while (publishUs[s] <= now) {
+        queues[s].push(nextEventUs[s], 0U);
+        nextEventUs[s] += 50 + g_rng.next(1000U);
+        const int64_t due = nextEventUs[s] + g_rng.next(maxDelayUs + 1U);
+        publishUs[s] = due > publishUs[s] ? due : publishUs[s];
+      }
+    }
+    while (merger.pop(now, ev)) {
+      ordered = ordered && (ev.micros >= last);
+      last = ev.micros > last ? ev.micros : last;
+      ++emitted;
+    }
+  }
+  return merger.late();
+}
+
+void testStreamingWithinBound() {
+  bool ordered = false;
+  size_t emitted = 0U;
+  CHECK_EQ(simulate(2000U, 2000U, ordered, emitted), 0U);
+  CHECK(ordered);
+  CHECK(emitted > 5000U);
+
+  // Producers slower than the bound: disorder is reported, not hidden.
+  CHECK(simulate(8000U, 500U, ordered, emitted) > 0U);
+  CHECK(!ordered);
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testMergesSortedSources();
+  testHoldsForLateness();
+  testStreamingWithinBound();
+  return test::testExitCode();
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_ewma.cpp
+ * @brief Table-driven decay against exp(), irregular-interval EWMA and rate
+ *        against a double-precision reference, and load averages.
+ */
+
+#include <math.h>
+#include <stdint.h>
+
+#include "SystemChrono/Ewma.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0xE3A1U);
+
+void testConfig() {
+  DecayFactor decay;
+  TimeEwma ewma;
+  DecayingRate rate;
+  CHECK(decay.begin(0U).code == Err::INVALID_CONFIG);
+  CHECK(ewma.begin(0U).code == Err::INVALID_CONFIG);
+  CHECK(rate.begin(0U).code == Err::INVALID_CONFIG);
+  ewma.updateAt(0, 5);  // ignored before begin()
+  CHECK(!ewma.hasValue());
+  CHECK(rate.begin(1000000U).ok());
+  CHECK_EQ(rate.rateAt(0), 0U);
+}
+
+void testDecayMatchesExp() {
+  const uint32_t taus[] = {1000U, 1000000U, 60000000U, 900000000U, 4000000000U};
+  for (uint32_t tau : taus) {
+    DecayFactor decay;
+    CHECK(decay.begin(tau).ok());
+    CHECK_EQ(decay.at(0), EWMA_ONE_Q31);
+    CHECK_EQ(decay.at(-5), EWMA_ONE_Q31);
+    CHECK_EQ(decay.at(static_cast<int64_t>(tau) * 40), 0U);
+    double worst = 0.0;
+    uint32_t previous = EWMA_ONE_Q31;
+    for (int i = 1; i <= 20000; ++i) {
+      const int64_t t = static_cast<int64_t>(static_cast<double>(tau) * 25.0 * i / 20000.0);
+      const uint32_t q = decay.at(t);
+      const double err = fabs(q / 2147483648.0 - exp(-static_cast<double>(t) / tau));
+      worst = err > worst ? err : worst;
+      CHECK(q <= previous);  // non-increasing
+      previous = q;
+    }
+    CHECK(worst < 1e-8);
+  }
+}
+
+void testEwmaMatchesReferenceAtIrregularIntervals() {
+  TimeEwma ewma;
+  CHECK(ewma.begin(60000000U).ok());
+  const double tau = 60e6;
+  double reference = 0.0;
+  int64_t t = 1000000;
+  double worst = 0.0;
+  for (int i = 0; i < 20000; ++i) {
+    const int32_t x = static_cast<int32_t>(g_rng.next(200001U)) - 100000;
+    if (i == 0) {
+      reference = x;
+    } else {
+      const int64_t dt = 1000 + static_cast<int64_t>(g_rng.next(5000000U));
+      t += dt;
+      reference = x + (reference - x) * exp(-static_cast<double>(dt) / tau);
+    }
+    ewma.updateAt(t, x);
+    const double err = fabs(ewma.valueQ16() / 65536.0 - reference);
+    worst = err > worst ? err : worst;
+  }
+  CHECK(worst < 0.5);  // on values of +/-100000
+  CHECK_NEAR(ewma.value(), reference, 1);
+}
+
+void testTimeAwareness() {
+  // Ten 1 s updates of the same value equal one 10 s update.
+  TimeEwma fine;
+  TimeEwma coarse;
+  CHECK(fine.begin(30000000U).ok());
+  CHECK(coarse.begin(30000000U).ok());
+  fine.updateAt(0, 0);
+  coarse.updateAt(0, 0);
+  for (int i = 1; i <= 10; ++i) {
+    fine.updateAt(i * 1000000LL, 1000);
+  }
+  coarse.updateAt(10000000, 1000);
+  CHECK_NEAR(fine.valueQ16(), coarse.valueQ16(), 16);
+  CHECK_NEAR(coarse.valueQ16() / 65536.0, 1000.0 * (1.0 - exp(-1.0 / 3.0)), 0.01);
+
+  // A repeated timestamp changes nothing but does not move time back.
+  const int64_t before = coarse.valueQ16();
+  coarse.updateAt(10000000, 5000);
+  CHECK_EQ(coarse.valueQ16(), before);
+}
+
+void testDecayingRate() {
+  DecayingRate rate;
+  CHECK(rate.begin(10000000U).ok());  // 10 s
+  int64_t t = 5000000;
+  // 200 events/s with jittered spacing; right after 1 s thanks to the
+  // start-up correction, and steady later.
+  for (int i = 0; i < 200; ++i) {
+    rate.addAt(t);
+    t += 2500 + g_rng.next(5001U);
+  }
+  CHECK_NEAR(rate.rateAt(t), 200, 10);
+  for (int i = 0; i < 20000; ++i) {
+    rate.addAt(t);
+    t += 2500 + g_rng.next(5001U);
+  }
+  CHECK_NEAR(rate.rateAt(t), 200, 4);
+  CHECK_NEAR(rate.rateAt(t, 60000000U), 12000, 240);  // per minute
+  // Silence: decays by e per tau.
+  CHECK_NEAR(rate.rateAt(t + 10000000), 200.0 * exp(-1.0), 3);
+  CHECK_EQ(rate.rateAt(t + 400000000), 0U);
+}
+
+void testLoadAverage() {
+  LoadAverage load;
+  CHECK(load.begin().ok());
+  // Idle, then two runnable tasks for 60 s, sampled every 5 s.
+  load.sampleAt(0, 0);
+  for (int i = 1; i <= 12; ++i) {
+    load.sampleAt(i * 5000000LL, 2);
+  }
+  CHECK_NEAR(load.oneMinute().valueQ16() / 65536.0, 2.0 * (1.0 - exp(-1.0)), 0.001);
+  CHECK_NEAR(load.fiveMinutes().valueQ16() / 65536.0, 2.0 * (1.0 - exp(-0.2)), 0.001);
+  CHECK_NEAR(load.fifteenMinutes().valueQ16() / 65536.0, 2.0 * (1.0 - exp(-1.0 / 15.0)), 0.001);
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testDecayMatchesExp();
+  testEwmaMatchesReferenceAtIrregularIntervals();
+  testTimeAwareness();
+  testDecayingRate();
+  testLoadAverage();
+  return test::testExitCode();
+}
@@ -0,0 +1,175 @@
+/**
+ * @file test_fifo_timestamper.cpp
+ * @brief FIFO back-fill against a simulated sensor with an off-nominal ODR
+ *        and a jittery reader, with and without watermark interrupts.
+ */
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "SystemChrono/FifoTimestamper.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0xF1F0U);
+
+/// Sensor producing samples at a true period that differs from nominal.
+struct SimSensor {
+  double periodUs;
+  double startUs;
+  double nowUs = 0.0;  // reader's time
+  int64_t next = 0;    // index of the oldest unread sample
+
+  double sampleTime(int64_t k) const { return startUs + k * periodUs; }
+
+  /// Samples produced at or before t, not yet read.
+  int64_t available(double t) const {
+    const int64_t produced = static_cast<int64_t>((t - startUs) / periodUs) + 1;
+    return produced > next ? produced - next : 0;
+  }
+};
+
+struct Result {
+  int64_t worstErrorUs = 0;
+  bool ordered = true;
+};
+
+/// Run for durationUs; error is tracked after settleUs.
+Result run(FifoTimestamper& stamper, SimSensor& sensor, bool watermark, int64_t durationUs,
+           int64_t settleUs) {
+  static constexpr int64_t WATERMARK = 16;
+  Result r;
+  std::vector<int64_t> out(512);
+  int64_t lastStamp = 0;
+  double& now = sensor.nowUs;
+  now = now < sensor.startUs ? sensor.startUs : now;
+  const double endUs = now + durationUs;
+  const double settleAtUs = now + settleUs;
+  while (now < endUs) {
+    FifoWatermark mark;
+    if (watermark) {
+      // Interrupt when the FIFO reaches the watermark, read shortly after.
+      const double wmTime = sensor.sampleTime(sensor.next + WATERMARK - 1);
+      mark.micros = static_cast<int64_t>(wmTime) + g_rng.uniform(10, 40);
+      mark.index = static_cast<uint16_t>(WATERMARK - 1);
+      now = static_cast<double>(mark.micros + g_rng.uniform(0, 3000));
+    } else {
+      now += static_cast<double>(g_rng.uniform(17000, 33000));  // polled every 25 +/- 8 ms
+    }
+    const int64_t count = sensor.available(now);
+    if (count == 0) {
+      continue;
+    }
+    const int64_t readUs = static_cast<int64_t>(now);
+    const FifoWatermark* marks = watermark ? &mark : nullptr;
+    const size_t markCount = watermark ? 1U : 0U;
+    CHECK(stamper.stamp(readUs, static_cast<size_t>(count), out.data(), marks, markCount).ok());
+    for (int64_t i = 0; i < count; ++i) {
+      r.ordered = r.ordered && (out[i] > lastStamp);
+      lastStamp = out[i];
+      if (now >= settleAtUs) {
+        int64_t err = out[i] - static_cast<int64_t>(sensor.sampleTime(sensor.next + i) + 0.5);
+        err = err < 0 ? -err : err;
+        r.worstErrorUs = err > r.worstErrorUs ? err : r.worstErrorUs;
+      }
+    }
+    sensor.next += count;
+  }
+  return r;
+}
+
+FifoTimestamperConfig config833Hz() {
+  FifoTimestamperConfig cfg;
+  cfg.nominalPeriodNs = 1000000000UL / 833U;  // 1200480 ns
+  cfg.watermarkLatencyUs = 25U;
+  return cfg;
+}
+
+void testConfigAndArguments() {
+  FifoTimestamper s;
+  int64_t out[4];
+  CHECK(s.stamp(0, 4U, out).code == Err::NOT_INITIALIZED);
+  FifoTimestamperConfig cfg = config833Hz();
+  cfg.nominalPeriodNs = 0U;
+  CHECK(s.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg = config833Hz();
+  cfg.resyncPeriods = 0U;
+  CHECK(s.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg = config833Hz();
+  cfg.maxPeriodErrorPpm = 600000U;
+  CHECK(s.begin(cfg).code == Err::INVALID_CONFIG);
+
+  CHECK(s.begin(config833Hz()).ok());
+  CHECK_EQ(s.periodNs(), 1200480);
+  CHECK(s.stamp(1000000, 0U, nullptr).ok());  // empty batch
+  CHECK(s.stamp(1000000, 4U, nullptr).code == Err::INVALID_CONFIG);
+  FifoWatermark bad;
+  bad.index = 4U;
+  CHECK(s.stamp(1000000, 4U, out, &bad, 1U).code == Err::INVALID_CONFIG);
+  CHECK_EQ(s.batches(), 0U);
+
+  // First batch: newest sample half a period before the read, evenly spaced.
+  CHECK(s.stamp(1000000, 4U, out).ok());
+  CHECK_NEAR(out[3], 1000000 - 600, 1);
+  CHECK_NEAR(out[3] - out[2], 1200, 1);
+  CHECK_NEAR(out[1] - out[0], 1200, 1);
+
+  // A batch reaching back before time zero gets negative, floored stamps.
+  CHECK(s.begin(config833Hz()).ok());
+  CHECK(s.stamp(2000, 4U, out).ok());  // newest at 1399.8, oldest at -2201.7
+  CHECK_EQ(out[0], -2202);
+  CHECK_EQ(out[1], -1001);
+  CHECK_NEAR(out[2], 200, 1);
+  CHECK_NEAR(out[3], 1400, 1);
+}
+
+void testLearnsOffNominalRateFromReadTimes() {
+  FifoTimestamper stamper;
+  CHECK(stamper.begin(config833Hz()).ok());
+  SimSensor sensor{1200480.0 / 1000.0 * 1.021, 5000000.0};  // ODR 2.1% slow
+  const Result r = run(stamper, sensor, false, 20000000, 5000000);
+  CHECK(r.ordered);
+  CHECK_NEAR(stamper.periodNs(), static_cast<int64_t>(sensor.periodUs * 1000.0), 2000);
+  // Read times alone locate the newest sample only within a period.
+  CHECK(r.worstErrorUs < static_cast<int64_t>(sensor.periodUs / 3.0));
+  CHECK_EQ(stamper.resyncs(), 0U);
+}
+
+void testWatermarksTightenAccuracy() {
+  FifoTimestamper stamper;
+  CHECK(stamper.begin(config833Hz()).ok());
+  SimSensor sensor{1200480.0 / 1000.0 * 0.985, 5000000.0};  // ODR 1.5% fast
+  const Result r = run(stamper, sensor, true, 20000000, 3000000);
+  CHECK(r.ordered);
+  CHECK_NEAR(stamper.periodNs(), static_cast<int64_t>(sensor.periodUs * 1000.0), 200);
+  CHECK(r.worstErrorUs < 40);
+}
+
+void testResyncAfterOverflow() {
+  FifoTimestamper stamper;
+  CHECK(stamper.begin(config833Hz()).ok());
+  SimSensor sensor{1200.48, 5000000.0};
+  CHECK(run(stamper, sensor, false, 3000000, 0).ordered);
+
+  // The reader stalls for 1 s; the FIFO overflows and 800 samples are lost.
+  sensor.nowUs += 1000000.0;
+  sensor.next = static_cast<int64_t>((sensor.nowUs - sensor.startUs) / sensor.periodUs) - 32;
+  const Result r = run(stamper, sensor, false, 6000000, 3000000);
+  CHECK_EQ(stamper.resyncs(), 1U);
+  CHECK(r.ordered);
+  CHECK(r.worstErrorUs < static_cast<int64_t>(sensor.periodUs / 3.0));
+}
+
+}  // namespace
+
+int main() {
+  testConfigAndArguments();
+  testLearnsOffNominalRateFromReadTimes();
+  testWatermarksTightenAccuracy();
+  testResyncAfterOverflow();
+  return test::testExitCode();
+}
@@ -0,0 +1,213 @@
+/**
+ * @file test_hybrid_logical_clock.cpp
+ * @brief HLC update rules, max-offset guard, and an N-node skewed-clock simulation.
+ */
+
+#include <thread>
+#include <vector>
+
+#include "SystemChrono/HybridLogicalClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+void testEncodingAndOrdering() {
+  const HlcTimestamp a = HlcTimestamp::make(1000, 5);
+  CHECK_EQ(a.physicalUs(), 1000);
+  CHECK_EQ(a.logical(), 5U);
+  CHECK(a < HlcTimestamp::make(1000, 6));
+  CHECK(a < HlcTimestamp::make(1001, 0));
+  CHECK(HlcTimestamp::make(999, HLC_MAX_LOGICAL) < a);
+  CHECK(a == HlcTimestamp(a.packed));
+  CHECK(a != HlcTimestamp());
+  CHECK(a >= a);
+  CHECK(a <= a);
+  static_assert(HlcTimestamp::make(7, 3).logical() == 3U, "constexpr encoding");
+}
+
+void testUpdateRules() {
+  HybridLogicalClock hlc;
+  HlcConfig cfg;
+  CHECK(hlc.begin(cfg).ok());
+
+  // Physical time moves: logical resets.
+  HlcTimestamp t = hlc.sendAt(100);
+  CHECK(t == HlcTimestamp::make(100, 0));
+  // Physical time stalls: logical counts.
+  t = hlc.sendAt(100);
+  CHECK(t == HlcTimestamp::make(100, 1));
+  // Physical time goes backwards: stay ahead of last.
+  t = hlc.sendAt(50);
+  CHECK(t == HlcTimestamp::make(100, 2));
+
+  // Message from the future: adopt its physical part, logical + 1.
+  HlcTimestamp out;
+  CHECK(hlc.receiveAt(HlcTimestamp::make(500, 7), 120, out).ok());
+  CHECK(out == HlcTimestamp::make(500, 8));
+  // Message from the past: local rules win.
+  CHECK(hlc.receiveAt(HlcTimestamp::make(10, 0), 120, out).ok());
+  CHECK(out == HlcTimestamp::make(500, 9));
+  // Physical time overtakes everything.
+  CHECK(hlc.receiveAt(HlcTimestamp::make(10, 0), 900, out).ok());
+  CHECK(out == HlcTimestamp::make(900, 0));
+  CHECK(hlc.last() == out);
+}
+
+void testMaxOffsetGuard() {
+  HybridLogicalClock hlc;
+  HlcConfig cfg;
+  cfg.maxOffsetUs = -1;
+  CHECK(hlc.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg.maxOffsetUs = 1000;
+  CHECK(hlc.begin(cfg).ok());
+  (void)hlc.sendAt(10000);
+
+  HlcTimestamp out;
+  const Status far = hlc.receiveAt(HlcTimestamp::make(50000, 0), 10000, out);
+  CHECK(far.code == Err::INVALID_CONFIG);
+  CHECK_EQ(far.detail, 40);
+  CHECK(hlc.last() == HlcTimestamp::make(10000, 0));  // unchanged
+  CHECK(hlc.receiveAt(HlcTimestamp::make(11000, 0), 10000, out).ok());
+  CHECK(out == HlcTimestamp::make(11000, 1));
+}
+
+void testRealClockMonotonicAcrossThreads() {
+  static HybridLogicalClock hlc;
+  HlcConfig cfg;
+  cfg.epochOffsetUs = 1700000000000000LL;  // Unix epoch microseconds
+  CHECK(hlc.begin(cfg).ok());
+  CHECK(hlc.send().physicalUs() >= cfg.epochOffsetUs);
+
+  std::vector<std::thread> workers;
+  std::vector<int> failures(4, 0);
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([t, &failures] {
+      HlcTimestamp prev;
+      for (int i = 0; i < 20000; ++i) {
+        const HlcTimestamp now = hlc.send();
+        if (!(now > prev)) {
+          ++failures[t];
+        }
+        prev = now;
+      }
+    });
+  }
+  for (std::thread& w : workers) {
+    w.join();
+  }
+  for (int f : failures) {
+    CHECK_EQ(f, 0);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// N-node simulation with skewed, drifting clocks and delayed messages.
+// ---------------------------------------------------------------------------
+
+struct SimMessage {
+  int64_t deliverAtUs;
+  int dest;
+  HlcTimestamp stamp;
+};
+
+struct SimNode {
+  HybridLogicalClock hlc;
+  int64_t offsetUs;
+  int64_t driftPpm;
+  HlcTimestamp lastStamp;
+
+  int64_t physicalUs(int64_t trueUs) const {
+    return trueUs + offsetUs + (trueUs / 1000000LL) * driftPpm;
+  }
+};
+
+test::Lcg g_rng(0xC0FFEEU);
+
+void testSkewedSimulation() {
+  static constexpr int NODES = 8;
+  static constexpr int EVENTS = 200000;
+  static constexpr int64_t MAX_OFFSET_US = 50000;  // +/- 50 ms
+  static constexpr int64_t MAX_DRIFT_PPM = 100;
+
+  SimNode nodes[NODES];
+  for (int i = 0; i < NODES; ++i) {
+    HlcConfig cfg;
+    CHECK(nodes[i].hlc.begin(cfg).ok());
+    nodes[i].offsetUs = static_cast<int64_t>(g_rng.next(2 * MAX_OFFSET_US + 1)) - MAX_OFFSET_US;
+    nodes[i].driftPpm = static_cast<int64_t>(g_rng.next(2 * MAX_DRIFT_PPM + 1)) - MAX_DRIFT_PPM;
+  }
+
+  std::vector<SimMessage> inFlight;
+  int64_t trueUs = 1000000;  // keep every physical clock positive
+  int violations = 0;
+  int causalityChecks = 0;
+  int64_t worstLeadUs = 0;
+  uint16_t worstLogical = 0;
+
+  for (int e = 0; e < EVENTS; ++e) {
+    trueUs += 1 + static_cast<int64_t>(g_rng.next(200));
+    const int n = static_cast<int>(g_rng.next(NODES));
+    SimNode& node = nodes[n];
+    const int64_t pt = node.physicalUs(trueUs);
+    HlcTimestamp stamp;
+
+    // Deliver one due message for this node, otherwise send or tick.
+    bool received = false;
+    for (size_t m = 0; m < inFlight.size(); ++m) {
+      if ((inFlight[m].dest == n) && (inFlight[m].deliverAtUs <= trueUs)) {
+        const HlcTimestamp sent = inFlight[m].stamp;
+        CHECK(node.hlc.receiveAt(sent, pt, stamp).ok());
+        ++causalityChecks;
+        if (!(stamp > sent)) {
+          ++violations;  // send must happen-before receive
+        }
+        inFlight[m] = inFlight.back();
+        inFlight.pop_back();
+        received = true;
+        break;
+      }
+    }
+    if (!received) {
+      stamp = node.hlc.sendAt(pt);
+      if (g_rng.next(2) == 0U) {
+        SimMessage msg;
+        msg.deliverAtUs = trueUs + 100 + static_cast<int64_t>(g_rng.next(5000));
+        msg.dest = static_cast<int>(g_rng.next(NODES));
+        msg.stamp = stamp;
+        inFlight.push_back(msg);
+      }
+    }
+
+    if (!(stamp > node.lastStamp)) {
+      ++violations;  // local events strictly increase
+    }
+    node.lastStamp = stamp;
+    if (stamp.physicalUs() < pt) {
+      ++violations;  // never behind local physical time
+    }
+    const int64_t lead = stamp.physicalUs() - pt;
+    worstLeadUs = lead > worstLeadUs ? lead : worstLeadUs;
+    worstLogical = stamp.logical() > worstLogical ? stamp.logical() : worstLogical;
+  }
+
+  // HLC bound: lead over local physical time <= max pairwise clock skew.
+  const int64_t simSeconds = trueUs / 1000000LL + 1;
+  const int64_t skewBoundUs = 2 * MAX_OFFSET_US + 2 * MAX_DRIFT_PPM * simSeconds;
+  CHECK_EQ(violations, 0);
+  CHECK(causalityChecks > 1000);
+  CHECK(worstLeadUs <= skewBoundUs);
+  CHECK(worstLogical < HLC_MAX_LOGICAL);  // logical never carried
+}
+
+}  // namespace
+
+int main() {
+  testEncodingAndOrdering();
+  testUpdateRules();
+  testMaxOffsetGuard();
+  testRealClockMonotonicAcrossThreads();
+  testSkewedSimulation();
+  return test::testExitCode();
+}
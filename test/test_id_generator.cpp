@@ -0,0 +1,195 @@
+/**
+ * @file test_id_generator.cpp
+ * @brief Snowflake IDs: layout, exhaustion policies, re-base, thread uniqueness.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "SystemChrono/IdGenerator.h"
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/VirtualClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+void testConfigValidation() {
+  IdGenerator ids;
+  uint64_t id = 0;
+  CHECK(ids.next(id).code == Err::NOT_INITIALIZED);
+
+  IdGeneratorConfig cfg;
+  cfg.nodeId = 1024U;
+  CHECK(ids.begin(cfg).code == Err::INVALID_CONFIG);
+
+  cfg.nodeId = 5U;
+  cfg.epochMs = millis64() + 60000;  // epoch in the future
+  CHECK(ids.begin(cfg).ok());
+  const Status early = ids.next(id);
+  CHECK(early.code == Err::INVALID_CONFIG);
+  CHECK_EQ(early.detail, 0);
+}
+
+void testLayoutAndOrdering() {
+  IdGenerator ids;
+  IdGeneratorConfig cfg;
+  cfg.epochMs = 1000;
+  cfg.timeBaseMs = 1700000000000LL;
+  cfg.nodeId = 0x2A5U;
+  CHECK(ids.begin(cfg).ok());
+  CHECK_EQ(ids.nodeId(), 0x2A5U);
+
+  uint64_t prev = 0;
+  for (int i = 0; i < 20000; ++i) {
+    uint64_t id = 0;
+    const int64_t before = millis64() + cfg.timeBaseMs;
+    CHECK(ids.next(id).ok());
+    const int64_t after = millis64() + cfg.timeBaseMs;
+    CHECK(id > prev);
+    CHECK((id >> 63) == 0U);  // positive as int64_t
+    CHECK_EQ(IdGenerator::nodeOf(id), 0x2A5U);
+    const int64_t t = IdGenerator::timestampMs(id, cfg.epochMs);
+    CHECK(t >= before);
+    CHECK(t <= after);
+    prev = id;
+  }
+}
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+void testExhaustionAndRebase() {
+  CHECK(enableVirtualClock(10000000).ok());  // 10 s, frozen
+  IdGenerator ids;
+  IdGeneratorConfig cfg;
+  cfg.policy = IdExhaustPolicy::FAIL;
+  CHECK(ids.begin(cfg).ok());
+
+  uint64_t id = 0;
+  uint64_t prev = 0;
+  int issued = 0;
+  while (ids.next(id).ok()) {
+    CHECK(id > prev);
+    prev = id;
+    ++issued;
+  }
+  CHECK_EQ(issued, ID_MAX_SEQUENCE + 1);
+  CHECK_EQ(IdGenerator::sequenceOf(prev), ID_MAX_SEQUENCE);
+  CHECK(ids.next(id).code == Err::RESOURCE_BUSY);
+
+  CHECK(advanceVirtualClock(1000).ok());  // next millisecond
+  CHECK(ids.next(id).ok());
+  CHECK(id > prev);
+  CHECK_EQ(IdGenerator::sequenceOf(id), 0U);
+  CHECK_EQ(IdGenerator::timestampMs(id, 0), 10001);
+  prev = id;
+
+  // Re-base 5 s backwards: IDs continue from the last issued time, and a
+  // burst does not run ahead of the old time base (still at 10001).
+  ids.rebase(-5000);
+  CHECK_EQ(ids.timeBase(), -5000);
+  int continued = 0;
+  for (int i = 0; i < 3 * (ID_MAX_SEQUENCE + 1); ++i) {
+    if (ids.next(id).ok()) {
+      CHECK(id > prev);
+      prev = id;
+      ++continued;
+    }
+  }
+  CHECK_EQ(continued, ID_MAX_SEQUENCE);
+  CHECK_EQ(IdGenerator::timestampMs(prev, 0), 10001);
+
+  // Re-base forwards: time jumps ahead, sequence restarts.
+  ids.rebase(60000);
+  CHECK(ids.next(id).ok());
+  CHECK(id > prev);
+  CHECK_EQ(IdGenerator::timestampMs(id, 0), 70001);
+  CHECK_EQ(IdGenerator::sequenceOf(id), 0U);
+
+  disableVirtualClock();
+}
+
+void testExhaustionAfterBackwardsRebase() {
+  CHECK(enableVirtualClock(20000000).ok());  // 20 s, frozen
+  IdGenerator ids;
+  IdGeneratorConfig cfg;
+  cfg.policy = IdExhaustPolicy::FAIL;
+  CHECK(ids.begin(cfg).ok());
+  uint64_t id = 0;
+  while (ids.next(id).ok()) {
+  }
+  CHECK_EQ(IdGenerator::timestampMs(id, 0), 20000);
+
+  // 2 ms back: the old time base is still at 20000, so there is nothing to
+  // borrow, and a burst fails instead of running ahead.
+  ids.rebase(-2);
+  CHECK(ids.next(id).code == Err::RESOURCE_BUSY);
+  uint64_t prev = id;
+  for (int ms = 1; ms <= 3; ++ms) {
+    CHECK(advanceVirtualClock(1000).ok());
+    int issued = 0;
+    for (int i = 0; i < 3 * (ID_MAX_SEQUENCE + 1); ++i) {
+      if (ids.next(id).ok()) {
+        CHECK(id > prev);
+        prev = id;
+        ++issued;
+      }
+    }
+    CHECK_EQ(issued, ID_MAX_SEQUENCE + 1);  // one millisecond's worth
+    CHECK_EQ(IdGenerator::timestampMs(prev, 0), 20000 + ms);
+  }
+
+  // Forwards past the lead: sequence restarts on the new time base.
+  ids.rebase(10);
+  CHECK(ids.next(id).ok());
+  CHECK_EQ(IdGenerator::timestampMs(id, 0), 20013);
+  disableVirtualClock();
+}
+#endif
+
+void testUniqueAcrossThreads() {
+  static IdGenerator ids;
+  IdGeneratorConfig cfg;
+  cfg.nodeId = 3U;
+  CHECK(ids.begin(cfg).ok());
+
+  static constexpr int THREADS = 4;
+  static constexpr int PER_THREAD = 20000;
+  std::vector<std::vector<uint64_t>> out(THREADS);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < THREADS; ++t) {
+    workers.emplace_back([&out, t] {
+      for (int i = 0; i < PER_THREAD; ++i) {
+        uint64_t id = 0;
+        if (ids.next(id).ok()) {
+          out[t].push_back(id);
+        }
+      }
+    });
+  }
+  for (std::thread& w : workers) {
+    w.join();
+  }
+  std::vector<uint64_t> all;
+  for (const std::vector<uint64_t>& ids_ : out) {
+    CHECK_EQ(ids_.size(), static_cast<size_t>(PER_THREAD));
+    CHECK(std::is_sorted(ids_.begin(), ids_.end()));
+    all.insert(all.end(), ids_.begin(), ids_.end());
+  }
+  std::sort(all.begin(), all.end());
+  CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+}  // namespace
+
+int main() {
+  testConfigValidation();
+  testLayoutAndOrdering();
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+  testExhaustionAndRebase();
+  testExhaustionAfterBackwardsRebase();
+#endif
+  testUniqueAcrossThreads();
+  return test::testExitCode();
+}
@@ -0,0 +1,167 @@
+/**
+ * @file test_precise_sleep.cpp
+ * @brief sleepUntil() never wakes early, and on a simulated scheduler wakes
+ *        close to the deadline, spends most of a long wait in OS sleep, and
+ *        learns its guard band in both directions.
+ */
+
+#include <stdint.h>
+
+#include "SystemChrono/PreciseSleep.h"
+#include "SystemChrono/SystemChrono.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+void testConfig() {
+  Sleeper sleeper;
+  SleeperConfig cfg;
+  cfg.maxGuardUs = 0U;
+  CHECK(sleeper.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg.maxGuardUs = 1000U;
+  cfg.initialGuardUs = 1001U;
+  CHECK(sleeper.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg.initialGuardUs = 500U;
+  cfg.minSpinUs = 2000U;
+  CHECK(sleeper.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg.minSpinUs = 7U;
+  CHECK(sleeper.begin(cfg).ok());
+  CHECK_EQ(sleeper.sleepGuardUs(), 500U);
+  CHECK_EQ(sleeper.spinGuardUs(), 7U);
+}
+
+void testPastDeadline() {
+  Sleeper sleeper;
+  SleepReport report;
+  const int64_t now = micros64();
+  const int64_t late = sleeper.sleepUntil(now - 1000, &report);
+  CHECK(late >= 1000);
+  CHECK_EQ(report.lateUs, late);
+  CHECK_EQ(report.osSleeps, 0U);
+  CHECK_EQ(report.sleptUs, 0);
+
+  // Far past: no overflow into a huge sleep budget.
+  const int64_t start = micros64();
+  CHECK_EQ(sleeper.sleepUntil(INT64_MIN, &report), INT64_MAX);
+  CHECK_EQ(report.osSleeps, 0U);
+  CHECK(micros64() - start < 1000000);
+  CHECK(sleeper.sleepFor(INT64_MIN) >= 0);
+}
+
+// Simulated scheduler: every clock read costs 1 us, a yield 3 us, and an
+// OS sleep oversleeps by g_oversleepUs plus a repeating 0..40 us jitter.
+int64_t g_simNowUs = 0;
+int64_t g_oversleepUs = 0;
+uint32_t g_simSleeps = 0U;
+
+int64_t simClock() {
+  return ++g_simNowUs;
+}
+
+int64_t simSleep(int64_t budgetUs) {
+  g_simNowUs += budgetUs + g_oversleepUs + static_cast<int64_t>(g_simSleeps++ % 5U) * 10;
+  return budgetUs;
+}
+
+void simYield() {
+  g_simNowUs += 3;
+}
+
+SleeperConfig simConfig(uint32_t initialGuardUs, int64_t oversleepUs) {
+  g_simNowUs = 0;
+  g_oversleepUs = oversleepUs;
+  g_simSleeps = 0U;
+  SleeperConfig cfg;
+  cfg.initialGuardUs = initialGuardUs;
+  cfg.clock = simClock;
+  cfg.osSleep = simSleep;
+  cfg.osYield = simYield;
+  return cfg;
+}
+
+void testNeverEarly() {
+  // Real time: only the ordering is deterministic on a loaded machine.
+  Sleeper sleeper;
+  int64_t deadline = micros64();
+  for (int i = 0; i < 10; ++i) {
+    deadline += 2000;
+    SleepReport report;
+    const int64_t late = sleeper.sleepUntil(deadline, &report);
+    CHECK(micros64() >= deadline);
+    CHECK(late >= 0);
+    CHECK_EQ(report.lateUs, late);
+  }
+}
+
+void testMostlySleeping() {
+  Sleeper sleeper;
+  CHECK(sleeper.begin(simConfig(2000U, 80)).ok());
+  int64_t worstLate = 0;
+  int64_t slept = 0;
+  int64_t busy = 0;
+  int64_t deadline = 0;
+  for (int i = 0; i < 40; ++i) {
+    deadline += 4000;
+    SleepReport report;
+    const int64_t late = sleeper.sleepUntil(deadline, &report);
+    CHECK(g_simNowUs >= deadline);
+    CHECK(late >= 0);
+    CHECK_EQ(report.lateUs, late);
+    if (i >= 10) {  // after the guard has adapted
+      worstLate = late > worstLate ? late : worstLate;
+      slept += report.sleptUs;
+      busy += report.yieldedUs + report.spunUs;
+    }
+  }
+  CHECK(worstLate <= 1);
+  CHECK(slept > 10 * busy);
+  CHECK(sleeper.sleepGuardUs() >= 80U);
+  CHECK(sleeper.sleepGuardUs() < 400U);
+}
+
+void testGuardLearnsDown() {
+  Sleeper sleeper;
+  CHECK(sleeper.begin(simConfig(5000U, 50)).ok());
+  for (int i = 0; i < 40; ++i) {
+    (void)sleeper.sleepFor(8000);
+  }
+  CHECK(sleeper.sleepGuardUs() >= 50U);
+  CHECK(sleeper.sleepGuardUs() < 300U);
+  CHECK(sleeper.spinGuardUs() >= SleeperConfig().minSpinUs);
+  CHECK(sleeper.spinGuardUs() < 20U);
+}
+
+void testGuardLearnsUp() {
+  // A 3 ms oversleep against a 100 us guard: late at first, on time once
+  // the guard has doubled its way up.
+  Sleeper sleeper;
+  CHECK(sleeper.begin(simConfig(100U, 3000)).ok());
+  int64_t lastLate = -1;
+  for (int i = 0; i < 40; ++i) {
+    lastLate = sleeper.sleepFor(10000);
+  }
+  CHECK(sleeper.sleepGuardUs() >= 3000U);
+  CHECK(lastLate <= 1);
+}
+
+void testDefaultSleeper() {
+  const int64_t deadline = micros64() + 3000;
+  CHECK(sleepUntil(deadline) >= 0);
+  CHECK(micros64() >= deadline);
+  CHECK(&defaultSleeper() == &defaultSleeper());
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testPastDeadline();
+  testNeverEarly();
+  testMostlySleeping();
+  testGuardLearnsDown();
+  testGuardLearnsUp();
+  testDefaultSleeper();
+  return test::testExitCode();
+}
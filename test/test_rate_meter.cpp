@@ -0,0 +1,111 @@
+/**
+ * @file test_rate_meter.cpp
+ * @brief RateMeter counts against a timestamp-list reference, start-up and
+ *        idle behaviour, and rate units.
+ */
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "SystemChrono/RateMeter.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0x5A7EU);
+
+void testConfig() {
+  RateMeter meter;
+  CHECK_EQ(meter.countAt(0), 0U);
+  meter.recordAt(0);  // ignored before begin()
+  RateMeterConfig cfg;
+  cfg.buckets = 0U;
+  CHECK(meter.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg.buckets = RATE_METER_MAX_BUCKETS + 1U;
+  CHECK(meter.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg.buckets = 7U;  // 10 s does not divide into 7 buckets
+  CHECK(meter.begin(cfg).code == Err::INVALID_CONFIG);
+  CHECK(meter.begin(RateMeterConfig()).ok());
+  CHECK_EQ(meter.countAt(0), 0U);
+  CHECK_EQ(meter.rateAt(0), 0U);
+}
+
+/// The meter counts exactly the events in its slot-aligned window.
+void testMatchesTimestampList() {
+  RateMeterConfig cfg;
+  cfg.windowUs = 1000000U;
+  cfg.buckets = 20U;  // 50 ms slots
+  RateMeter meter;
+  CHECK(meter.begin(cfg).ok());
+  const int64_t bucketUs = 50000;
+  const int64_t firstUs = 123456;
+  std::vector<int64_t> stamps;
+  int64_t t = firstUs;
+  for (int i = 0; i < 20000; ++i) {
+    if (g_rng.next(7U) == 0U) {
+      // Query: slots start at firstUs; the window is the newest slot plus 19.
+      const int64_t headStart = firstUs + ((t - firstUs) / bucketUs) * bucketUs;
+      const int64_t from = headStart - (cfg.buckets - 1) * bucketUs;
+      uint32_t expected = 0U;
+      for (int64_t s : stamps) {
+        expected += s >= from ? 1U : 0U;
+      }
+      CHECK_EQ(meter.countAt(t), expected);
+    } else {
+      const uint32_t n = 1U + g_rng.next(3U);
+      meter.recordAt(t, n);
+      stamps.insert(stamps.end(), n, t);
+    }
+    // Mostly dense traffic with occasional idle stretches longer than the window.
+    t += g_rng.next(200U) == 0U ? 1000000 + g_rng.next(3000000U) : g_rng.next(2000U);
+  }
+}
+
+void testSteadyRateAndStartup() {
+  RateMeter meter;
+  CHECK(meter.begin(RateMeterConfig()).ok());  // 10 s, 1 s slots
+  int64_t t = 5000000;
+  // 100 events/s; after 2 s the rate is already right, the count is not.
+  for (int i = 0; i < 200; ++i) {
+    meter.recordAt(t);
+    t += 10000;
+  }
+  CHECK_NEAR(meter.rateAt(t), 100, 1);
+  CHECK_EQ(meter.countAt(t), 200U);
+
+  int32_t worst = 0;
+  for (int i = 0; i < 3000; ++i) {
+    meter.recordAt(t);
+    t += 10000;
+    if ((i % 37) == 0) {
+      const int32_t err = static_cast<int32_t>(meter.rateAt(t)) - 100;
+      worst = err < 0 ? (-err > worst ? -err : worst) : (err > worst ? err : worst);
+    }
+  }
+  CHECK(worst <= 1);
+  CHECK(meter.countAt(t) >= 900U);
+  CHECK(meter.countAt(t) <= 1000U);
+  CHECK_NEAR(meter.rateAt(t, 60000000U), 6000, 60);  // per minute
+
+  // Idle: the window drains slot by slot, then empties.
+  CHECK(meter.countAt(t + 5000000) <= 500U);
+  CHECK_EQ(meter.countAt(t + 10000000), 0U);
+  CHECK_EQ(meter.rateAt(t + 60000000), 0U);
+
+  meter.reset();
+  CHECK_EQ(meter.countAt(t), 0U);
+  meter.recordAt(t, 4U);
+  CHECK_EQ(meter.rateAt(t), 4U);  // at least one slot is assumed covered
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testMatchesTimestampList();
+  testSteadyRateAndStartup();
+  return test::testExitCode();
+}
@@ -0,0 +1,165 @@
+/**
+ * @file test_system_chrono.cpp
+ * @brief Core API: time accessors, elapsed helpers, formatting, timers.
+ */
+
+#include <string.h>
+
+#include <limits>
+
+#include "SystemChrono/SystemChrono.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+static constexpr int64_t INT64_MIN_VALUE = (std::numeric_limits<int64_t>::min)();
+static constexpr int64_t INT64_MAX_VALUE = (std::numeric_limits<int64_t>::max)();
+
+void busyWaitUs(int64_t us) {
+  const int64_t start = micros64();
+  while (microsSince(start) < us) {
+  }
+}
+
+void testAccessorsMonotonic() {
+  int64_t prev = micros64();
+  for (int i = 0; i < 10000; ++i) {
+    const int64_t now = micros64();
+    CHECK(now >= prev);
+    prev = now;
+  }
+  const int64_t us = micros64();
+  const int64_t ms = millis64();
+  const int64_t s = seconds64();
+  CHECK(ms >= us / 1000);
+  CHECK(ms - us / 1000 <= 1);
+  CHECK(s >= us / 1000000);
+  CHECK(s - us / 1000000 <= 1);
+}
+
+void testElapsedHelpers() {
+  const int64_t startUs = micros64();
+  const int64_t startMs = millis64();
+  busyWaitUs(3000);
+  CHECK(microsSince(startUs) >= 3000);
+  CHECK(millisSince(startMs) >= 2);
+  CHECK_EQ(secondsSince(seconds64()), 0);
+  CHECK_EQ(microsSince(INT64_MIN_VALUE), INT64_MAX_VALUE);  // saturates
+}
+
+void testFormatTimeTo() {
+  char buf[TIME_FORMAT_BUFFER_SIZE];
+  CHECK(formatTimeTo(0, buf, sizeof(buf)).ok());
+  CHECK(strcmp(buf, "0:00:00.000") == 0);
+
+  CHECK(formatTimeTo(5025678000LL, buf, sizeof(buf)).ok());
+  CHECK(strcmp(buf, "1:23:45.678") == 0);
+
+  CHECK(formatTimeTo(-1500000LL, buf, sizeof(buf)).ok());
+  CHECK(strcmp(buf, "-0:00:01.500") == 0);
+
+  CHECK(formatTimeTo(INT64_MIN_VALUE, buf, sizeof(buf)).ok());
+  CHECK(buf[0] == '-');
+
+  CHECK(formatTimeTo(0, nullptr, sizeof(buf)).code == Err::INVALID_CONFIG);
+  CHECK(formatTimeTo(0, buf, 0U).code == Err::INVALID_CONFIG);
+  const Status small = formatTimeTo(0, buf, TIME_FORMAT_BUFFER_SIZE - 1U);
+  CHECK(small.code == Err::INVALID_CONFIG);
+  CHECK_EQ(small.detail, TIME_FORMAT_BUFFER_SIZE);
+  CHECK(buf[0] == '\0');
+
+  CHECK(formatNowTo(buf, sizeof(buf)).ok());
+  CHECK(strlen(buf) > 0U);
+}
+
+void testFormatString() {
+  CHECK(formatTime(5025678000LL) == "1:23:45.678");
+  CHECK(formatNow().length() > 0U);
+}
+
+void testStopwatch() {
+  Stopwatch sw;
+  CHECK(!sw.isRunning());
+  CHECK_EQ(sw.elapsedMicros(), 0);
+
+  sw.start();
+  CHECK(sw.isRunning());
+  busyWaitUs(2000);
+  sw.stop();
+  CHECK(!sw.isRunning());
+  const int64_t first = sw.elapsedMicros();
+  CHECK(first >= 2000);
+  CHECK_EQ(sw.elapsedMillis(), first / 1000);
+  CHECK_EQ(sw.elapsedSeconds(), 0);
+
+  busyWaitUs(1000);
+  CHECK_EQ(sw.elapsedMicros(), first);  // stopped: no accumulation
+
+  sw.resume();
+  busyWaitUs(1000);
+  sw.stop();
+  CHECK(sw.elapsedMicros() >= first + 1000);
+
+  sw.reset();
+  CHECK_EQ(sw.elapsedMicros(), 0);
+  CHECK(!sw.isRunning());
+}
+
+void testElapsedMicros64() {
+  ElapsedMicros64 timer(5000);
+  CHECK(static_cast<int64_t>(timer) >= 5000);
+
+  timer = 0;
+  CHECK(static_cast<int64_t>(timer) < 5000);
+
+  timer += 10000;
+  CHECK(static_cast<int64_t>(timer) >= 10000);
+  timer -= 10000;
+  CHECK(static_cast<int64_t>(timer) < 5000);
+
+  const int64_t oneSecondUs = 1000000;
+  const ElapsedMicros64 later = timer + oneSecondUs;
+  CHECK(static_cast<int64_t>(later) >= 1000000);
+  const ElapsedMicros64 copy(later);
+  CHECK(static_cast<int64_t>(copy) >= 1000000);
+  const ElapsedMicros64 earlier = later - oneSecondUs;
+  CHECK(static_cast<int64_t>(earlier) < 1000000);
+}
+
+void testElapsedMillisAndSeconds() {
+  ElapsedMillis64 ms(1500);
+  CHECK(static_cast<int64_t>(ms) >= 1500);
+  ms = 0;
+  CHECK_EQ(static_cast<int64_t>(ms), 0);
+  ms += 42;
+  CHECK(static_cast<int64_t>(ms) >= 42);
+
+  ElapsedSeconds64 s(3600);
+  CHECK_EQ(static_cast<int64_t>(s), 3600);
+  s -= 3600;
+  CHECK_EQ(static_cast<int64_t>(s), 0);
+  const int64_t hourS = 3600;
+  const ElapsedSeconds64 hour = s + hourS;
+  CHECK_EQ(static_cast<int64_t>(hour), 3600);
+
+  // Saturating arithmetic: no signed overflow on extreme offsets.
+  ElapsedSeconds64 huge(INT64_MAX_VALUE);
+  CHECK(static_cast<int64_t>(huge) > 0);
+  elapsedMillis64 legacy;
+  CHECK(static_cast<int64_t>(legacy) >= 0);
+}
+
+}  // namespace
+
+int main() {
+  testAccessorsMonotonic();
+  testElapsedHelpers();
+  testFormatTimeTo();
+  testFormatString();
+  testStopwatch();
+  testElapsedMicros64();
+  testElapsedMillisAndSeconds();
+  return test::testExitCode();
+}
@@ -0,0 +1,159 @@
+/**
+ * @file test_tick_correlator.cpp
+ * @brief Tick-to-micros fit: exact lines, wrap, outliers, restarts, batch conversion.
+ */
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "SystemChrono/TickCorrelator.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+/// Synthetic 32.768 kHz counter running ppm fast, starting at startTicks.
+struct SyntheticCounter {
+  double hz = 32768.0;
+  double ppm = 0.0;
+  uint32_t startTicks = 0U;
+  int64_t startMicros = 1000000;
+
+  uint32_t ticksAt(double us) const {
+    const double ticks = (us - startMicros) * 1e-6 * hz * (1.0 + ppm * 1e-6);
+    return startTicks + static_cast<uint32_t>(static_cast<uint64_t>(ticks));
+  }
+
+  /// Micros at which the counter is `elapsedTicks` past the start.
+  double microsAtTick(double elapsedTicks) const {
+    return startMicros + elapsedTicks / (hz * (1.0 + ppm * 1e-6)) * 1e6;
+  }
+};
+
+test::Lcg g_rng(0x71C4U);
+
+void testConfig() {
+  TickCorrelator c;
+  CHECK(c.addSample(0U, 0).code == Err::NOT_INITIALIZED);
+  TickCorrelatorConfig cfg;
+  cfg.weightShift = 0U;
+  CHECK(c.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg = TickCorrelatorConfig();
+  cfg.minSamples = 1U;
+  CHECK(c.begin(cfg).code == Err::INVALID_CONFIG);
+  cfg = TickCorrelatorConfig();
+  cfg.maxRejects = 0U;
+  CHECK(c.begin(cfg).code == Err::INVALID_CONFIG);
+  CHECK(c.begin(TickCorrelatorConfig()).ok());
+  CHECK(!c.isValid());
+  CHECK_EQ(c.toMicros(1234U), 0);
+  CHECK(c.microsPerTick() == 0.0);
+}
+
+void testExactLineAcrossWrap() {
+  // 1 MHz-ish counter: 3 ticks per 2 us, starting just before the 32-bit wrap.
+  TickCorrelator c;
+  CHECK(c.begin(TickCorrelatorConfig()).ok());
+  const uint32_t start = 0xFFFFF000U;
+  for (uint32_t i = 0; i < 20U; ++i) {
+    const uint32_t ticks = start + i * 3000U;  // wraps after two samples
+    CHECK(c.addSample(ticks, 5000000 + static_cast<int64_t>(i) * 2000).ok());
+    CHECK_EQ(c.isValid(), i + 1U >= 4U);
+  }
+  CHECK_EQ(c.stats().wraps, 1U);
+  CHECK_NEAR(c.microsPerTick(), 2.0 / 3.0, 1e-9);
+  // Before, between and after samples, across the wrap in both directions.
+  CHECK_NEAR(c.toMicros(start), 5000000, 1);
+  CHECK_NEAR(c.toMicros(start + 1500U), 5001000, 1);
+  CHECK_NEAR(c.toMicros(start + 19U * 3000U), 5038000, 1);
+  CHECK_NEAR(c.toMicros(start + 30U * 3000U), 5060000, 1);
+  CHECK_NEAR(c.toMicros(start - 3000U), 4998000, 1);
+}
+
+void testNoisyDriftingCounter() {
+  SyntheticCounter counter;
+  counter.ppm = 42.0;
+  counter.startTicks = 0xFFFF0000U;
+  TickCorrelator c;
+  CHECK(c.begin(TickCorrelatorConfig()).ok());
+
+  // One observation per 10 +/- 1 ms with +/-20 us stamping jitter and 1% late outliers.
+  for (int i = 0; i < 2000; ++i) {
+    const double us = counter.startMicros + i * 10000.0 + static_cast<double>(g_rng.noise(1000U));
+    int64_t stamp = static_cast<int64_t>(us) + g_rng.noise(20U);
+    if (i % 100 == 50) {
+      stamp += 3000;  // ISR held off
+    }
+    CHECK(c.addSample(counter.ticksAt(us), stamp).ok());
+  }
+  CHECK(c.isValid());
+  CHECK_EQ(c.stats().rejected, 20U);
+  CHECK_EQ(c.stats().restarts, 0U);
+  CHECK(c.residualUs() < 20.0);
+  const double expectedSlope = 1e6 / (32768.0 * (1.0 + 42e-6));
+  CHECK_NEAR(c.microsPerTick(), expectedSlope, expectedSlope * 2e-6);
+
+  // Convert the last second of ticks; the fit averages away the jitter.
+  int64_t worst = 0;
+  const uint32_t lastTicks = counter.ticksAt(counter.startMicros + 1999 * 10000.0);
+  const uint64_t lastElapsed = static_cast<uint32_t>(lastTicks - counter.startTicks);
+  for (uint64_t e = lastElapsed - 32768U; e <= lastElapsed; e += 97U) {
+    const uint32_t ticks = counter.startTicks + static_cast<uint32_t>(e);
+    // Sampled at random phase within a tick, a count maps to its mid-point.
+    const double truth = counter.microsAtTick(static_cast<double>(e) + 0.5);
+    int64_t err = c.toMicros(ticks) - static_cast<int64_t>(truth + 0.5);
+    err = err < 0 ? -err : err;
+    worst = err > worst ? err : worst;
+  }
+  CHECK(worst < 15);
+}
+
+void testRestartAfterCounterReset() {
+  TickCorrelator c;
+  CHECK(c.begin(TickCorrelatorConfig()).ok());
+  int64_t us = 0;
+  for (uint32_t i = 0; i < 50U; ++i, us += 1000) {
+    CHECK(c.addSample(i * 1000U, us).ok());
+  }
+  // The sensor resets its counter to 0 at us = 50000.
+  for (uint32_t i = 0; i < 30U; ++i, us += 1000) {
+    CHECK(c.addSample(i * 1000U, us).ok());
+  }
+  CHECK_EQ(c.stats().restarts, 1U);
+  CHECK(c.isValid());
+  CHECK_NEAR(c.toMicros(5000U), 55000, 1);
+}
+
+void testBatchMatchesScalar() {
+  TickCorrelator c;
+  CHECK(c.begin(TickCorrelatorConfig()).ok());
+  for (uint32_t i = 0; i < 16U; ++i) {
+    const int64_t us = 7000000 + static_cast<int64_t>(i) * 1000003;
+    CHECK(c.addSample(0x80000000U + i * 32768U, us).ok());
+  }
+  std::vector<uint32_t> ticks(1027);
+  std::vector<int64_t> out(ticks.size());
+  for (size_t i = 0; i < ticks.size(); ++i) {
+    ticks[i] = 0x80000000U + static_cast<uint32_t>(i) * 613U;
+  }
+  c.toMicros(ticks.data(), out.data(), ticks.size());
+  bool same = true;
+  for (size_t i = 0; i < ticks.size(); ++i) {
+    same = same && (out[i] == c.toMicros(ticks[i]));
+  }
+  CHECK(same);
+  CHECK(out.back() > out.front());
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testExactLineAcrossWrap();
+  testNoisyDriftingCounter();
+  testRestartAfterCounterReset();
+  testBatchMatchesScalar();
+  return test::testExitCode();
+}
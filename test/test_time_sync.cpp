@@ -0,0 +1,258 @@
+/**
+ * @file test_time_sync.cpp
+ * @brief Four-timestamp sync engine over an in-process loopback transport.
+ *
+ * Runs on the virtual clock: the loopback delivers packets after injected
+ * latency and jitter, and the client's clock is offset from the server's.
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/TimeSync.h"
+#include "SystemChrono/VirtualClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+
+namespace {
+
+static constexpr int64_t STEP_US = 20;
+
+int64_t g_clientOffsetUs = 0;  // client clock = server clock + this
+int64_t g_clientDriftPpm = 0;
+
+int64_t serverClock() {
+  return micros64();
+}
+
+int64_t clientClock() {
+  const int64_t t = micros64();
+  return t + g_clientOffsetUs + (t * g_clientDriftPpm) / 1000000LL;
+}
+
+int64_t trueOffsetUs() {
+  return serverClock() - clientClock();
+}
+
+test::Lcg g_rng(0x5EEDU);
+
+/// One direction of a lossy, delayed in-process link.
+struct LoopbackEndpoint : public TimeSyncTransport {
+  struct InFlight {
+    uint8_t data[TIMESYNC_PACKET_SIZE];
+    size_t len;
+    int64_t deliverAtUs;
+  };
+
+  LoopbackEndpoint* peer = nullptr;
+  std::vector<InFlight> inbox;
+  int64_t latencyUs = 500;
+  uint32_t jitterUs = 0U;   // uniform 0..jitterUs on every packet
+  uint32_t spikeUs = 0U;    // plus 0..spikeUs on one packet in four (queueing)
+  uint32_t dropEvery = 0U;  // 0 = lossless
+  uint32_t sent = 0U;
+
+  Status send(const uint8_t* data, size_t len) override {
+    ++sent;
+    if ((dropEvery != 0U) && (sent % dropEvery == 0U)) {
+      return Ok();  // lost on the wire
+    }
+    InFlight packet;
+    memcpy(packet.data, data, len);
+    packet.len = len;
+    packet.deliverAtUs = micros64() + latencyUs + g_rng.next(jitterUs + 1U);
+    if ((spikeUs != 0U) && (g_rng.next(4U) == 0U)) {
+      packet.deliverAtUs += g_rng.next(spikeUs + 1U);
+    }
+    peer->inbox.push_back(packet);
+    return Ok();
+  }
+
+  Status receive(uint8_t* data, size_t capacity, size_t& outLen) override {
+    outLen = 0U;
+    size_t due = inbox.size();
+    for (size_t i = 0; i < inbox.size(); ++i) {
+      if ((inbox[i].deliverAtUs <= micros64()) &&
+          ((due == inbox.size()) || (inbox[i].deliverAtUs < inbox[due].deliverAtUs))) {
+        due = i;
+      }
+    }
+    if (due == inbox.size()) {
+      return Ok();
+    }
+    if (inbox[due].len > capacity) {
+      return Status(Err::COMM_FAILURE, 0, "Packet larger than buffer");
+    }
+    memcpy(data, inbox[due].data, inbox[due].len);
+    outLen = inbox[due].len;
+    inbox.erase(inbox.begin() + static_cast<std::ptrdiff_t>(due));
+    return Ok();
+  }
+};
+
+struct Link {
+  LoopbackEndpoint server;
+  LoopbackEndpoint client;
+  Link() {
+    server.peer = &client;
+    client.peer = &server;
+  }
+  void setPath(int64_t latencyUs, uint32_t jitterUs, uint32_t spikeUs = 0U) {
+    server.latencyUs = latencyUs;
+    client.latencyUs = latencyUs;
+    server.jitterUs = jitterUs;
+    client.jitterUs = jitterUs;
+    server.spikeUs = spikeUs;
+    client.spikeUs = spikeUs;
+  }
+};
+
+void runFor(TimeSyncServer& server, TimeSyncClient& client, int64_t durationUs) {
+  const int64_t end = micros64() + durationUs;
+  while (micros64() < end) {
+    CHECK(server.poll().ok());
+    CHECK(client.poll().ok());
+    (void)advanceVirtualClock(STEP_US);
+  }
+}
+
+TimeSyncConfig clientConfig() {
+  TimeSyncConfig cfg;
+  cfg.clock = &clientClock;
+  cfg.intervalUs = 100000U;
+  cfg.timeoutUs = 20000U;
+  return cfg;
+}
+
+void testConfigAndState() {
+  TimeSyncClient client;
+  CHECK(client.poll().code == Err::NOT_INITIALIZED);
+  CHECK(!client.isSynchronized());
+  TimeSyncServer server;
+  CHECK(server.poll().code == Err::NOT_INITIALIZED);
+
+  Link link;
+  TimeSyncConfig cfg = clientConfig();
+  cfg.minSamples = 0U;
+  CHECK(client.begin(link.client, cfg).code == Err::INVALID_CONFIG);
+  cfg.minSamples = TIMESYNC_FILTER_SIZE + 1U;
+  CHECK(client.begin(link.client, cfg).code == Err::INVALID_CONFIG);
+  cfg = clientConfig();
+  cfg.timeoutUs = 0U;
+  CHECK(client.begin(link.client, cfg).code == Err::INVALID_CONFIG);
+}
+
+void testSymmetricPathIsExact() {
+  CHECK(enableVirtualClock(10000000).ok());
+  g_clientOffsetUs = -123456;
+  g_clientDriftPpm = 0;
+
+  Link link;
+  link.setPath(500, 0U);
+  TimeSyncServer server;
+  TimeSyncClient client;
+  CHECK(server.begin(link.server, &serverClock).ok());
+  CHECK(client.begin(link.client, clientConfig()).ok());
+
+  runFor(server, client, 1000000);
+  CHECK(client.isSynchronized());
+  CHECK_NEAR(client.offsetUs(), trueOffsetUs(), STEP_US);
+  CHECK_NEAR(client.delayUs(), 1000, 2 * STEP_US);
+  CHECK_NEAR(client.toServerTime(clientClock()), serverClock(), STEP_US);
+  CHECK(client.stats().samples >= 8U);
+  CHECK_EQ(client.stats().timeouts, 0U);
+  CHECK_EQ(server.answered(), client.stats().requests);
+  disableVirtualClock();
+}
+
+void testJitterFilteredByMinimumRtt() {
+  CHECK(enableVirtualClock(10000000).ok());
+  g_clientOffsetUs = 987654;
+  g_clientDriftPpm = 20;
+
+  Link link;
+  link.setPath(300, 200U, 8000U);  // 0.3-0.5 ms, spikes up to 8 ms, per direction
+  TimeSyncServer server;
+  TimeSyncClient client;
+  CHECK(server.begin(link.server, &serverClock).ok());
+  CHECK(client.begin(link.client, clientConfig()).ok());
+
+  int64_t worstRawErrorUs = 0;
+  int64_t worstFilteredErrorUs = 0;
+  uint32_t lastSamples = 0U;
+  const int64_t end = micros64() + 20000000;
+  while (micros64() < end) {
+    CHECK(server.poll().ok());
+    CHECK(client.poll().ok());
+    (void)advanceVirtualClock(STEP_US);
+    if (client.stats().samples != lastSamples) {
+      lastSamples = client.stats().samples;
+      if (client.isSynchronized()) {
+        int64_t err = client.offsetUs() - trueOffsetUs();
+        err = err < 0 ? -err : err;
+        worstFilteredErrorUs = err > worstFilteredErrorUs ? err : worstFilteredErrorUs;
+      }
+      int64_t raw = client.lastSample().offsetUs - trueOffsetUs();
+      raw = raw < 0 ? -raw : raw;
+      worstRawErrorUs = raw > worstRawErrorUs ? raw : worstRawErrorUs;
+    }
+  }
+  CHECK(client.isSynchronized());
+  CHECK(worstRawErrorUs > 1000);       // single samples are off by milliseconds
+  CHECK(worstFilteredErrorUs < 500);  // the minimum-RTT estimate stays sub-millisecond
+  disableVirtualClock();
+}
+
+void testLossAndTimeouts() {
+  CHECK(enableVirtualClock(10000000).ok());
+  g_clientOffsetUs = 5000;
+  g_clientDriftPpm = 0;
+
+  Link link;
+  link.setPath(200, 0U);
+  link.client.dropEvery = 3U;  // every third request lost
+  TimeSyncServer server;
+  TimeSyncClient client;
+  CHECK(server.begin(link.server, &serverClock).ok());
+  CHECK(client.begin(link.client, clientConfig()).ok());
+
+  runFor(server, client, 2000000);
+  CHECK(client.isSynchronized());
+  CHECK(client.stats().timeouts >= 5U);
+  CHECK_EQ(client.stats().requests, client.stats().samples + client.stats().timeouts);
+  CHECK_NEAR(client.offsetUs(), trueOffsetUs(), STEP_US);
+
+  // Garbage and unsolicited replies are rejected, not fatal.
+  const uint8_t junk[5] = {1, 2, 3, 4, 5};
+  link.client.inbox.clear();
+  CHECK(link.server.send(junk, sizeof(junk)).ok());
+  const uint32_t rejectedBefore = client.stats().rejected;
+  runFor(server, client, 10000);
+  CHECK(client.stats().rejected > rejectedBefore);
+  disableVirtualClock();
+}
+
+}  // namespace
+
+int main() {
+  testConfigAndState();
+  testSymmetricPathIsExact();
+  testJitterFilteredByMinimumRtt();
+  testLossAndTimeouts();
+  return test::testExitCode();
+}
+
+#else  // !SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK
+
+int main() {
+  TimeSyncClient client;
+  CHECK(client.poll().code == Err::NOT_INITIALIZED);
+  return test::testExitCode();
+}
+
+#endif  // SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK
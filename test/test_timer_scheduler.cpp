@@ -0,0 +1,201 @@
+/**
+ * @file test_timer_scheduler.cpp
+ * @brief Coalescing never runs a timer outside its window, merges
+ *        overlapping windows, keeps periodic grids, and needs no more
+ *        wake-ups than an optimal interval-stabbing schedule.
+ */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "SystemChrono/TimerScheduler.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0x7C0AU);
+
+/// Records every call and checks it against the window it was armed for.
+struct Probe : TimerHandler {
+  int64_t windowStart = 0;
+  int64_t windowEnd = 0;
+  int64_t periodUs = 0;
+  uint32_t calls = 0U;
+  int64_t lastUs = -1;
+  bool violated = false;
+
+  void onTimer(int64_t nowUs) override {
+    if ((nowUs < windowStart) || (nowUs > windowEnd)) {
+      violated = true;
+    }
+    ++calls;
+    lastUs = nowUs;
+    windowStart += periodUs;
+    windowEnd += periodUs;
+  }
+};
+
+void testConfig() {
+  TimerScheduler scheduler;
+  Deadline* slots[4];
+  CHECK(scheduler.begin(nullptr, 2U).code == Err::INVALID_CONFIG);
+  CHECK(scheduler.begin(slots, 0U).code == Err::INVALID_CONFIG);
+  CHECK(scheduler.begin(slots, 2U).ok());
+  CHECK_EQ(scheduler.nextWakeUs(), DEADLINE_NONE);
+
+  Probe probe;
+  CoalescedTimer a(scheduler, probe);
+  CoalescedTimer b(scheduler, probe);
+  CoalescedTimer c(scheduler, probe);
+  CHECK(a.startAt(0, 0, 0U).code == Err::INVALID_CONFIG);
+  CHECK(a.startAt(0, 100, 100U).code == Err::INVALID_CONFIG);  // slack >= period
+  CHECK(a.startAt(0, 100, 99U).ok());
+  CHECK(b.armAt(50, 10U).ok());
+  CHECK(c.armAt(70, 10U).code == Err::OUT_OF_MEMORY);
+  CHECK(!c.armed());
+  CHECK_EQ(scheduler.size(), 2U);
+  CHECK(scheduler.begin(slots, 2U).code == Err::RESOURCE_BUSY);
+}
+
+void testOverlappingWindowsShareOneWakeup() {
+  Deadline* slots[8];
+  TimerScheduler scheduler;
+  CHECK(scheduler.begin(slots, 4U).ok());
+  Probe pa, pb, pc;
+  CoalescedTimer a(scheduler, pa);
+  CoalescedTimer b(scheduler, pb);
+  CoalescedTimer c(scheduler, pc);
+  CHECK(a.armAt(1000, 500U).ok());  // [1000, 1500]
+  CHECK(b.armAt(1200, 900U).ok());  // [1200, 2100]
+  CHECK(c.armAt(1600, 100U).ok());  // [1600, 1700]
+  CHECK_EQ(scheduler.nextWakeUs(), 1500);
+  CHECK_EQ(scheduler.idleForAt(1000), 500);
+  CHECK_EQ(scheduler.runAt(1500), 2U);  // a and b
+  CHECK_EQ(pa.lastUs, 1500);
+  CHECK_EQ(pb.lastUs, 1500);
+  CHECK_EQ(scheduler.nextWakeUs(), 1700);
+  CHECK_EQ(scheduler.runAt(1700), 1U);
+  CHECK_EQ(scheduler.batches(), 2U);
+  CHECK_EQ(scheduler.dispatched(), 3U);
+  CHECK_EQ(scheduler.nextWakeUs(), DEADLINE_NONE);
+}
+
+void testPeriodicGridAndAlignment() {
+  Deadline* slots[4];
+  TimerScheduler scheduler;
+  TimerSchedulerConfig cfg;
+  cfg.alignUs = 1000U;
+  CHECK(scheduler.begin(slots, 2U, cfg).ok());
+  Probe probe;
+  CoalescedTimer t(scheduler, probe);
+  CHECK(t.startAt(250, 10000, 3000U).ok());  // windows [10250 + 10000k, +3000]
+  probe.windowStart = 10250;
+  probe.windowEnd = 13250;
+  probe.periodUs = 10000;
+  for (int i = 0; i < 5; ++i) {
+    const int64_t wake = scheduler.nextWakeUs();
+    CHECK_EQ(wake % 1000, 0);  // aligned: 13000, 23000, ...
+    CHECK_EQ(scheduler.runAt(wake), 1U);
+  }
+  CHECK_EQ(probe.calls, 5U);
+  CHECK(!probe.violated);
+  CHECK_EQ(t.dueUs(), 60250);  // on the grid, not shifted by late runs
+
+  // Run very late: missed windows are skipped, the next is still on the grid.
+  CHECK_EQ(scheduler.runAt(95000), 1U);
+  CHECK_EQ(t.dueUs(), 100250);
+  t.cancel();
+
+  // The aligned point 5000 is inside A but before B starts: waking there
+  // would run A alone and need a second batch for B.
+  Probe pa, pb;
+  CoalescedTimer a(scheduler, pa);
+  CoalescedTimer b(scheduler, pb);
+  CHECK(a.armAt(0, 10000U).ok());   // [0, 10000]
+  CHECK(b.armAt(5500, 300U).ok());  // [5500, 5800]
+  const uint32_t batches = scheduler.batches();
+  CHECK_EQ(scheduler.nextWakeUs(), 5800);
+  CHECK_EQ(scheduler.runAt(scheduler.nextWakeUs()), 2U);
+  CHECK_EQ(scheduler.batches(), batches + 1U);
+  CHECK_EQ(scheduler.nextWakeUs(), DEADLINE_NONE);
+}
+
+struct SelfRearm : TimerHandler {
+  CoalescedTimer* timer = nullptr;
+  uint32_t calls = 0U;
+  void onTimer(int64_t nowUs) override {
+    ++calls;
+    (void)timer->armAt(nowUs, 0U);  // due again immediately
+  }
+};
+
+void testHandlerRearmDoesNotLoop() {
+  Deadline* slots[4];
+  TimerScheduler scheduler;
+  CHECK(scheduler.begin(slots, 2U).ok());
+  SelfRearm handler;
+  CoalescedTimer t(scheduler, handler);
+  handler.timer = &t;
+  CHECK(t.armAt(10, 0U).ok());
+  CHECK_EQ(scheduler.runAt(10), 1U);
+  CHECK_EQ(scheduler.runAt(10), 1U);
+  t.cancel();
+  CHECK_EQ(scheduler.size(), 0U);
+}
+
+/// Random one-shot windows: nothing runs outside its window and the number
+/// of batches equals the greedy optimum (stab at the earliest window end).
+void testRandomWindowsMatchOptimum() {
+  static constexpr int TIMERS = 200;
+  std::vector<Deadline*> slots(2 * TIMERS);
+  TimerScheduler scheduler;
+  CHECK(scheduler.begin(slots.data(), TIMERS).ok());
+  std::unique_ptr<Probe> probes[TIMERS];
+  std::unique_ptr<CoalescedTimer> timers[TIMERS];
+  std::vector<std::pair<int64_t, int64_t>> windows;
+  for (int i = 0; i < TIMERS; ++i) {
+    probes[i].reset(new Probe());
+    timers[i].reset(new CoalescedTimer(scheduler, *probes[i]));
+    const int64_t due = static_cast<int64_t>(g_rng.next(1000000U));
+    const uint32_t slack = g_rng.next(50000U);
+    probes[i]->windowStart = due;
+    probes[i]->windowEnd = due + slack;
+    windows.emplace_back(due + slack, due);
+    CHECK(timers[i]->armAt(due, slack).ok());
+  }
+  while (scheduler.nextWakeUs() != DEADLINE_NONE) {
+    CHECK(scheduler.runAt(scheduler.nextWakeUs()) > 0U);
+  }
+  std::sort(windows.begin(), windows.end());
+  uint32_t optimum = 0U;
+  int64_t stab = -1;
+  for (const std::pair<int64_t, int64_t>& w : windows) {
+    if (w.second > stab) {
+      stab = w.first;
+      ++optimum;
+    }
+  }
+  CHECK_EQ(scheduler.batches(), optimum);
+  CHECK(optimum < TIMERS / 2);
+  for (int i = 0; i < TIMERS; ++i) {
+    CHECK_EQ(probes[i]->calls, 1U);
+    CHECK(!probes[i]->violated);
+  }
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testOverlappingWindowsShareOneWakeup();
+  testPeriodicGridAndAlignment();
+  testHandlerRearmDoesNotLoop();
+  testRandomWindowsMatchOptimum();
+  return test::testExitCode();
+}
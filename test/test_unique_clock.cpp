@@ -0,0 +1,99 @@
+/**
+ * @file test_unique_clock.cpp
+ * @brief uniqueMicros64(): strict ordering, multi-thread uniqueness, skew bound.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/UniqueClock.h"
+#include "SystemChrono/VirtualClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+void testStrictlyIncreasingAndBounded() {
+  int64_t prev = uniqueMicros64();
+  for (int i = 0; i < 100000; ++i) {
+    const int64_t before = micros64();
+    const int64_t stamp = uniqueMicros64();
+    const int64_t after = micros64();
+    CHECK(stamp > prev);
+    CHECK(stamp >= before);
+    CHECK(stamp - after <= UNIQUE_MICROS_MAX_SKEW_US);
+    prev = stamp;
+  }
+  CHECK_EQ(lastUniqueMicros64(), prev);
+}
+
+void testUniqueAcrossThreads() {
+  static constexpr int THREADS = 4;
+  static constexpr int PER_THREAD = 50000;
+  std::vector<std::vector<int64_t>> stamps(THREADS);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < THREADS; ++t) {
+    workers.emplace_back([&stamps, t] {
+      stamps[t].reserve(PER_THREAD);
+      for (int i = 0; i < PER_THREAD; ++i) {
+        stamps[t].push_back(uniqueMicros64());
+      }
+    });
+  }
+  for (std::thread& w : workers) {
+    w.join();
+  }
+
+  std::vector<int64_t> all;
+  for (const std::vector<int64_t>& s : stamps) {
+    CHECK(std::is_sorted(s.begin(), s.end()));
+    all.insert(all.end(), s.begin(), s.end());
+  }
+  std::sort(all.begin(), all.end());
+  CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+void testFrozenVirtualClockDoesNotBlock() {
+  const int64_t base = lastUniqueMicros64() + 1000000;
+  CHECK(enableVirtualClock(base).ok());
+  int64_t prev = uniqueMicros64();
+  CHECK_EQ(prev, base);
+  for (int i = 0; i < 5000; ++i) {  // beyond the skew bound, time frozen
+    const int64_t stamp = uniqueMicros64();
+    CHECK_EQ(stamp, prev + 1);
+    prev = stamp;
+  }
+  disableVirtualClock();
+}
+
+void testDisablingAheadVirtualClockDoesNotBlock() {
+  CHECK(enableVirtualClock(micros64()).ok());
+  CHECK(advanceVirtualClock(3600000000LL).ok());  // an hour ahead of real time
+  const int64_t virtualStamp = uniqueMicros64();
+  disableVirtualClock();
+
+  const int64_t start = micros64();
+  const int64_t stamp = uniqueMicros64();
+  CHECK(micros64() - start < 100000);  // restarted, not waiting an hour
+  CHECK(stamp < virtualStamp);
+  CHECK(stamp >= start);
+  CHECK(uniqueMicros64() > stamp);
+  CHECK(uniqueMicros64() - micros64() <= UNIQUE_MICROS_MAX_SKEW_US);
+}
+#endif
+
+}  // namespace
+
+int main() {
+  testStrictlyIncreasingAndBounded();
+  testUniqueAcrossThreads();
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+  testFrozenVirtualClockDoesNotBlock();
+  testDisablingAheadVirtualClockDoesNotBlock();
+#endif
+  return test::testExitCode();
+}
@@ -0,0 +1,145 @@
+/**
+ * @file test_virtual_clock.cpp
+ * @brief Virtual clock: advance, wakeup heap, and timers following virtual time.
+ */
+
+#include "SystemChrono/ClockSource.h"
+#include "SystemChrono/CycleClock.h"
+#include "SystemChrono/SystemChrono.h"
+#include "SystemChrono/VirtualClock.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+#if defined(SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK)
+
+namespace {
+
+static constexpr int64_t HOUR_US = 3600LL * 1000000LL;
+
+VirtualWakeup g_wakeups[8];
+
+void testEnableAndAdvance() {
+  CHECK(enableVirtualClock(-1).code == Err::INVALID_CONFIG);
+  CHECK(enableVirtualClock(0, g_wakeups, 0U).code == Err::INVALID_CONFIG);
+  CHECK(advanceVirtualClock(1).code == Err::NOT_INITIALIZED);
+
+  CHECK(enableVirtualClock(1000).ok());
+  CHECK(isVirtualClockEnabled());
+  CHECK_EQ(micros64(), 1000);
+  CHECK_EQ(micros64(), 1000);  // frozen until advanced
+
+  CHECK(advanceVirtualClock(500).ok());
+  CHECK_EQ(micros64(), 1500);
+  CHECK(advanceVirtualClock(-1).code == Err::INVALID_CONFIG);
+  CHECK(advanceVirtualClockTo(1499).code == Err::INVALID_CONFIG);
+  CHECK(advanceVirtualClockTo(2000000).ok());
+  CHECK_EQ(millis64(), 2000);
+  CHECK_EQ(seconds64(), 2);
+  CHECK_EQ(nanos64(), 2000000000LL);
+  CHECK_EQ(SystemClock::nowMicros(), 2000000);
+
+  disableVirtualClock();
+  CHECK(!isVirtualClockEnabled());
+}
+
+void testDayLongStateMachine() {
+  CHECK(enableVirtualClock(0).ok());
+
+  // A state machine that toggles every 6 hours and logs uptime.
+  ElapsedSeconds64 uptime;
+  ElapsedMillis64 phaseTimer;
+  Stopwatch busy;
+  int toggles = 0;
+  for (int minute = 0; minute < 24 * 60; ++minute) {
+    CHECK(advanceVirtualClock(60LL * 1000000LL).ok());
+    if (phaseTimer >= 6LL * 3600LL * 1000LL) {
+      phaseTimer -= 6LL * 3600LL * 1000LL;
+      ++toggles;
+      if (busy.isRunning()) {
+        busy.stop();
+      } else {
+        busy.resume();
+      }
+    }
+  }
+  CHECK_EQ(static_cast<int64_t>(uptime), 86400);
+  CHECK_EQ(toggles, 4);
+  CHECK_EQ(busy.elapsedMicros(), 12LL * HOUR_US);  // two 6 h busy phases
+  CHECK_EQ(millisSince(0), 86400000);
+  disableVirtualClock();
+}
+
+void testWakeupHeap() {
+  CHECK(enableVirtualClock(100, g_wakeups, 8U).ok());
+  CHECK(scheduleVirtualWakeup(5000, 1U).ok());
+  CHECK(scheduleVirtualWakeup(300, 2U).ok());
+  CHECK(scheduleVirtualWakeup(5000, 3U).ok());
+  CHECK(scheduleVirtualWakeup(50, 4U).ok());  // already in the past
+  CHECK_EQ(pendingVirtualWakeups(), 4U);
+
+  VirtualWakeup fired;
+  CHECK(advanceToNextVirtualWakeup(&fired));
+  CHECK_EQ(fired.tag, 4U);
+  CHECK_EQ(micros64(), 100);  // never moves backwards
+  CHECK(advanceToNextVirtualWakeup(&fired));
+  CHECK_EQ(fired.tag, 2U);
+  CHECK_EQ(micros64(), 300);
+  CHECK(advanceToNextVirtualWakeup(&fired));
+  CHECK_EQ(fired.tag, 1U);  // equal times fire in insertion order
+  CHECK(advanceToNextVirtualWakeup(&fired));
+  CHECK_EQ(fired.tag, 3U);
+  CHECK_EQ(micros64(), 5000);
+  CHECK(!advanceToNextVirtualWakeup(&fired));
+
+  for (uint32_t i = 0; i < 8U; ++i) {
+    CHECK(scheduleVirtualWakeup(10000 - static_cast<int64_t>(i), i).ok());
+  }
+  const Status full = scheduleVirtualWakeup(1, 99U);
+  CHECK(full.code == Err::OUT_OF_MEMORY);
+  CHECK_EQ(full.detail, 8);
+
+  int64_t prev = micros64();
+  size_t popped = 0U;
+  while (advanceToNextVirtualWakeup()) {
+    CHECK(micros64() >= prev);
+    prev = micros64();
+    ++popped;
+  }
+  CHECK_EQ(popped, 8U);
+  CHECK_EQ(micros64(), 10000);
+
+  disableVirtualClock();
+  CHECK_EQ(pendingVirtualWakeups(), 0U);
+  CHECK(!advanceToNextVirtualWakeup());
+  CHECK(scheduleVirtualWakeup(1).code == Err::NOT_INITIALIZED);
+}
+
+void testDisableRestoresRealTime() {
+  const int64_t before = micros64();
+  CHECK(enableVirtualClock(0).ok());
+  CHECK_EQ(micros64(), 0);
+  disableVirtualClock();
+  CHECK(micros64() >= before);
+}
+
+}  // namespace
+
+int main() {
+  testEnableAndAdvance();
+  testDayLongStateMachine();
+  testWakeupHeap();
+  testDisableRestoresRealTime();
+  return test::testExitCode();
+}
+
+#else  // !SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK
+
+int main() {
+  CHECK(enableVirtualClock(0).code == Err::INVALID_CONFIG);
+  CHECK(!isVirtualClockEnabled());
+  CHECK(!advanceToNextVirtualWakeup());
+  return test::testExitCode();
+}
+
+#endif  // SYSTEMCHRONO_ENABLE_VIRTUAL_CLOCK
@@ -0,0 +1,196 @@
+/**
+ * @file test_window_aggregator.cpp
+ * @brief Tumbling, hopping and cascaded windows checked against a brute-force
+ *        recomputation from the raw samples, including gaps and late data.
+ */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "SystemChrono/WindowAggregator.h"
+#include "TestSupport.h"
+
+using namespace SystemChrono;
+
+namespace {
+
+test::Lcg g_rng(0x7A11U);
+
+struct RecordingSink : WindowSink {
+  std::vector<WindowStats> windows;
+  void onWindow(const WindowStats& window) override { windows.push_back(window); }
+};
+
+struct Sample {
+  int64_t micros;
+  int32_t value;
+};
+
+/// Recompute a window from the raw samples (sorted by time).
+WindowStats bruteForce(const std::vector<Sample>& samples, int64_t startUs, int64_t endUs) {
+  WindowStats w;
+  auto it = std::lower_bound(samples.begin(), samples.end(), startUs,
+                             [](const Sample& s, int64_t t) { return s.micros < t; });
+  for (; (it != samples.end()) && (it->micros < endUs); ++it) {
+    const Sample& s = *it;
+    w.min = (w.count == 0U || s.value < w.min) ? s.value : w.min;
+    w.max = (w.count == 0U || s.value > w.max) ? s.value : w.max;
+    w.last = s.value;
+    w.sum += s.value;
+    ++w.count;
+  }
+  return w;
+}
+
+/// Every window matches the raw data; tumbling windows tile the time line.
+void checkWindows(const std::vector<WindowStats>& windows, const std::vector<Sample>& samples,
+                  bool tiled) {
+  for (size_t i = 0; i < windows.size(); ++i) {
+    const WindowStats& w = windows[i];
+    const WindowStats expected = bruteForce(samples, w.startUs, w.endUs);
+    CHECK_EQ(w.count, expected.count);
+    CHECK_EQ(w.sum, expected.sum);
+    CHECK_EQ(w.min, expected.min);
+    CHECK_EQ(w.max, expected.max);
+    CHECK_EQ(w.last, expected.last);
+    if (tiled && (i != 0U)) {
+      CHECK_EQ(w.startUs, windows[i - 1U].endUs);
+    }
+  }
+}
+
+void testConfig() {
+  WindowAggregator agg;
+  WindowConfig cfg;
+  cfg.bucketUs = 0U;
+  CHECK(agg.begin(cfg, nullptr).code == Err::INVALID_CONFIG);
+  cfg = WindowConfig();
+  cfg.hops = 0U;
+  CHECK(agg.begin(cfg, nullptr).code == Err::INVALID_CONFIG);
+  cfg.hops = WINDOW_MAX_HOPS + 1U;
+  CHECK(agg.begin(cfg, nullptr).code == Err::INVALID_CONFIG);
+
+  WindowAggregator minutes;
+  CHECK(agg.begin(WindowConfig(), nullptr).ok());
+  CHECK(agg.cascadeTo(minutes).code == Err::NOT_INITIALIZED);
+  cfg = WindowConfig();
+  cfg.bucketUs = 1500000U;  // not a multiple of 1 s
+  CHECK(minutes.begin(cfg, nullptr).ok());
+  CHECK(agg.cascadeTo(minutes).code == Err::INVALID_CONFIG);
+  CHECK(agg.cascadeTo(agg).code == Err::INVALID_CONFIG);
+}
+
+void testTumblingWithGapAndFlush() {
+  RecordingSink sink;
+  WindowAggregator agg;
+  CHECK(agg.begin(WindowConfig(), &sink).ok());
+  std::vector<Sample> samples;
+  // 1 kHz from 2.5 s to 6.0 s, then silence until 65.3 s.
+  for (int64_t t = 2500000; t < 6000000; t += 1000) {
+    const int32_t v = static_cast<int32_t>(g_rng.next(2001U)) - 1000;
+    samples.push_back(Sample{t, v});
+    agg.add(t, v);
+  }
+  CHECK_EQ(sink.windows.size(), 3U);  // [2,3) [3,4) [4,5); [5,6) still open
+  CHECK_EQ(sink.windows[0].startUs, 2000000);
+  CHECK_EQ(sink.windows[0].count, 500U);
+  CHECK_EQ(sink.windows[1].count, 1000U);
+
+  agg.flush(6000000);  // completes [5,6) without a new sample
+  CHECK_EQ(sink.windows.size(), 4U);
+  CHECK_EQ(sink.windows[3].endUs, 6000000);
+
+  samples.push_back(Sample{65300000, 7});
+  agg.add(65300000, 7);
+  CHECK_EQ(sink.windows.size(), 5U);  // the 59 s gap is one empty record
+  CHECK(sink.windows[4].empty());
+  CHECK_EQ(sink.windows[4].startUs, 6000000);
+  CHECK_EQ(sink.windows[4].endUs, 65000000);
+  CHECK_EQ(agg.openBucket().startUs, 65000000);
+
+  agg.add(64999999, 1);  // belongs to a completed bucket: dropped
+  CHECK_EQ(agg.late(), 1U);
+  agg.flush(70000000);
+  checkWindows(sink.windows, samples, true);
+  CHECK_EQ(sink.windows.back().endUs, 70000000);
+}
+
+void testHoppingWindow() {
+  RecordingSink sink;
+  WindowAggregator agg;
+  WindowConfig cfg;
+  cfg.bucketUs = 100000U;  // 100 ms hop
+  cfg.hops = 10U;          // 1 s window
+  CHECK(agg.begin(cfg, &sink).ok());
+  std::vector<Sample> samples;
+  int64_t t = 0;
+  while (t < 20000000) {
+    // Irregular rate with occasional 0.5..3 s dropouts.
+    t += g_rng.next(3000U) == 0U ? 500000 + g_rng.next(2500000U) : 1 + g_rng.next(3000U);
+    const int32_t v = static_cast<int32_t>(g_rng.next(100000U));
+    samples.push_back(Sample{t, v});
+    agg.add(t, v);
+  }
+  CHECK(sink.windows.size() > 150U);
+  checkWindows(sink.windows, samples, false);
+  size_t hops = 0U;
+  for (const WindowStats& w : sink.windows) {
+    hops += (w.endUs - w.startUs == 1000000) ? 1U : 0U;
+  }
+  CHECK(hops > 150U);
+}
+
+void testCascadeSecondsMinutesHours() {
+  RecordingSink secondSink;
+  RecordingSink minuteSink;
+  RecordingSink hourSink;
+  WindowAggregator seconds;
+  WindowAggregator minutes;
+  WindowAggregator hours;
+  WindowConfig cfg;
+  CHECK(seconds.begin(cfg, &secondSink).ok());
+  cfg.bucketUs = 60000000U;
+  CHECK(minutes.begin(cfg, &minuteSink).ok());
+  cfg.bucketUs = 3600000000U;
+  CHECK(hours.begin(cfg, &hourSink).ok());
+  CHECK(seconds.cascadeTo(minutes).ok());
+  CHECK(minutes.cascadeTo(hours).ok());
+
+  std::vector<Sample> samples;
+  int64_t t = 3540000000;  // 59 min: crosses an hour boundary early
+  const int64_t endUs = t + 7200000000;
+  while (t < endUs) {
+    const uint32_t r = g_rng.next(20000U);
+    t += r == 0U ? 30000000 + g_rng.next(600000000U) : 5000 + g_rng.next(10000U);
+    const int32_t v = static_cast<int32_t>(g_rng.next(1u << 20)) - (1 << 19);
+    samples.push_back(Sample{t, v});
+    seconds.add(t, v);
+  }
+  seconds.flush(t + 3600000000);
+
+  CHECK(minuteSink.windows.size() > 60U);
+  CHECK(hourSink.windows.size() >= 2U);
+  checkWindows(secondSink.windows, samples, true);
+  checkWindows(minuteSink.windows, samples, true);
+  checkWindows(hourSink.windows, samples, true);
+  for (const WindowStats& w : minuteSink.windows) {
+    CHECK_EQ(w.startUs % 60000000, 0);
+  }
+  uint64_t total = 0U;
+  for (const WindowStats& w : hourSink.windows) {
+    total += w.count;
+  }
+  CHECK_EQ(total, samples.size());
+}
+
+}  // namespace
+
+int main() {
+  testConfig();
+  testTumblingWithGapAndFlush();
+  testHoppingWindow();
+  testCascadeSecondsMinutesHours();
+  return test::testExitCode();
+}